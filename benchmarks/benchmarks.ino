@@ -0,0 +1,254 @@
+// Host side benchmarks: measures the throughput and heap allocations of
+// repeatable workloads. Each result is printed as a JSON line, so that the
+// output can be collected and compared to detect regressions.
+#include <chrono>
+#include <new>
+
+#include "DLNA.h"
+#include "../examples/tests/NullUDPService.h"
+#include "../examples/tests/device-xml-parser/device.h"
+#include "basic/NullPrint.h"
+
+// number of executions of each workload
+#ifndef BENCHMARK_COUNT
+#define BENCHMARK_COUNT 10000
+#endif
+
+// heap allocations: Vector, Str and List use new and delete unless
+// USE_ALLOCATOR is active
+static uint64_t alloc_count = 0;
+static uint64_t alloc_bytes = 0;
+
+void* operator new(size_t size) {
+  alloc_count++;
+  alloc_bytes += size;
+  void* result = malloc(size == 0 ? 1 : size);
+  if (result == nullptr) throw std::bad_alloc();
+  return result;
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* ptr) noexcept { free(ptr); }
+void operator delete[](void* ptr) noexcept { free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { free(ptr); }
+
+/// Executes a workload and reports the result as JSON line
+template <class Fn>
+void benchmark(const char* name, int count, Fn fn) {
+  // warm up: e.g. fill the pools and reserve the vectors
+  for (int j = 0; j < count / 10 + 1; j++) fn(j);
+
+  uint64_t allocs = alloc_count;
+  uint64_t bytes = alloc_bytes;
+  auto start = std::chrono::steady_clock::now();
+  for (int j = 0; j < count; j++) fn(j);
+  auto end = std::chrono::steady_clock::now();
+  allocs = alloc_count - allocs;
+  bytes = alloc_bytes - bytes;
+
+  double ns =
+      std::chrono::duration<double, std::nano>(end - start).count() / count;
+  char line[256];
+  snprintf(line, sizeof(line),
+           "{\"benchmark\":\"%s\",\"iterations\":%d,\"ns_per_op\":%.1f,"
+           "\"ops_per_sec\":%.0f,\"allocs_per_op\":%.2f,\"bytes_per_op\":%.1f}",
+           name, count, ns, ns > 0 ? 1e9 / ns : 0.0, (double)allocs / count,
+           (double)bytes / count);
+  Serial.println(line);
+}
+
+/// Schedule which does nothing but is repeated
+struct NopSchedule : public Schedule {
+  NopSchedule() { repeat_ms = 1000; }
+  bool process(IUDPService& udp) override { return true; }
+  const char* name() override { return "Nop"; }
+};
+
+/// Exposes the request dispatching of the HttpServer w/o a client
+class BenchmarkHttpServer : public HttpServer {
+ public:
+  BenchmarkHttpServer(WiFiServer& server) : HttpServer(server) {}
+
+  bool dispatch(char* header) {
+    request_header.parse(header);
+    return onRequest(resolveRewrite(request_header.urlPath()));
+  }
+};
+
+const char* msearch =
+    "M-SEARCH * HTTP/1.1\r\n"
+    "HOST: 239.255.255.250:1900\r\n"
+    "MAN: \"ssdp:discover\"\r\n"
+    "MX: 0\r\n"
+    "ST: urn:schemas-upnp-org:device:MediaRenderer:1\r\n"
+    "USER-AGENT: Google Chrome/124.0.6367.201 Linux\r\n\r\n";
+
+const char* notify =
+    "NOTIFY * HTTP/1.1\r\n"
+    "HOST: 239.255.255.250:1900\r\n"
+    "CACHE-CONTROL: max-age=1800\r\n"
+    "LOCATION: http://192.168.1.44:49152/description.xml\r\n"
+    "NT: urn:schemas-upnp-org:device:MediaRenderer:1\r\n"
+    "NTS: ssdp:alive\r\n"
+    "SERVER: Linux/5.10 UPnP/1.0 Test/1.0\r\n"
+    "USN: uuid:09349455-2941-4cf7-9847-0dd5ab210e97::urn:schemas-upnp-org:"
+    "device:MediaRenderer:1\r\n\r\n";
+
+const char* msearch_reply =
+    "HTTP/1.1 200 OK\r\n"
+    "CACHE-CONTROL: max-age=1800\r\n"
+    "EXT:\r\n"
+    "LOCATION: http://192.168.1.44:49152/description.xml\r\n"
+    "SERVER: Linux/5.10 UPnP/1.0 Test/1.0\r\n"
+    "ST: urn:schemas-upnp-org:device:MediaRenderer:1\r\n"
+    "USN: uuid:09349455-2941-4cf7-9847-0dd5ab210e97::urn:schemas-upnp-org:"
+    "device:MediaRenderer:1\r\n\r\n";
+
+const char* http_request =
+    "GET /dlna/device/5.xml HTTP/1.1\r\n"
+    "Host: 192.168.1.33:9000\r\n"
+    "User-Agent: Linux/5.10 UPnP/1.0 Test/1.0\r\n"
+    "Accept: */*\r\n"
+    "Connection: keep-alive\r\n\r\n";
+
+NullUDPService udp;
+WiFiServer wifi;
+Icon icon;
+
+void setupDevice(DLNADevice& device) {
+  device.setBaseURL("http://192.168.1.33:9000/dlna");
+  device.setDeviceType("urn:schemas-upnp-org:device:MediaRenderer:1");
+  device.setUDN("uuid:09349455-2941-4cf7-9847-0dd5ab210e97");
+  device.addIcon(icon);
+  DLNAServiceInfo rc, cm, avt;
+  avt.setup("urn:schemas-upnp-org:service:AVTransport:1",
+            "urn:upnp-org:serviceId:AVTransport", "/AVT/service.xml", nullptr,
+            "/AVT/control", nullptr, "/AVT/event", nullptr);
+  cm.setup("urn:schemas-upnp-org:service:ConnectionManager:1",
+           "urn:upnp-org:serviceId:ConnectionManager", "/CM/service.xml",
+           nullptr, "/CM/control", nullptr, "/CM/event", nullptr);
+  rc.setup("urn:schemas-upnp-org:service:RenderingControl:1",
+           "urn:upnp-org:serviceId:RenderingControl", "/RC/service.xml",
+           nullptr, "/RC/control", nullptr, "/RC/event", nullptr);
+  device.addService(rc);
+  device.addService(cm);
+  device.addService(avt);
+}
+
+void benchmarkSSDP() {
+  DLNADevice device;
+  setupDevice(device);
+  DLNADeviceRequestParser device_parser;
+  device_parser.addMSearchST("urn:schemas-upnp-org:device:MediaRenderer:1");
+  RequestData req;
+  // different peers, so that we are not limited by the rate limit
+  benchmark("ssdp_device_msearch", BENCHMARK_COUNT, [&](int j) {
+    req.data = msearch;
+    req.peer.address = IPAddress(10, 0, (j >> 8) & 0xFF, j & 0xFF);
+    req.peer.port = 1900 + (j % 1000);
+    Schedule* p_schedule = device_parser.parse(device, req);
+    if (p_schedule != nullptr) p_schedule->p_allocator->remove(p_schedule);
+  });
+
+  DLNAControlPointRequestParser cp_parser;
+  benchmark("ssdp_cp_notify", BENCHMARK_COUNT, [&](int j) {
+    req.data = notify;
+    Schedule* p_schedule = cp_parser.parse(req);
+    if (p_schedule != nullptr) p_schedule->p_allocator->remove(p_schedule);
+  });
+  benchmark("ssdp_cp_msearch_reply", BENCHMARK_COUNT, [&](int j) {
+    req.data = msearch_reply;
+    Schedule* p_schedule = cp_parser.parse(req);
+    if (p_schedule != nullptr) p_schedule->p_allocator->remove(p_schedule);
+  });
+}
+
+void benchmarkXML() {
+  // captured device xml
+  benchmark("xml_device_parse", BENCHMARK_COUNT / 10, [&](int j) {
+    DLNADevice device;
+    StringRegistry strings;
+    XMLDeviceParser parser;
+    parser.parse(device, strings, (const char*)device_xml);
+  });
+
+  NullPrint out;
+  DLNADevice device;
+  setupDevice(device);
+  benchmark("device_print", BENCHMARK_COUNT / 10,
+            [&](int j) { device.print(out); });
+
+  DLNADevice parsed;
+  StringRegistry strings;
+  XMLDeviceParser parser;
+  parser.parse(parsed, strings, (const char*)device_xml);
+  benchmark("device_print_parsed", BENCHMARK_COUNT / 10,
+            [&](int j) { parsed.print(out); });
+}
+
+void benchmarkHttpServer(int handlerCount) {
+  BenchmarkHttpServer server(wifi);
+  auto nop = [](HttpServer* server, const char* requestPath,
+                HttpRequestHandlerLine* hl) {};
+  char path[40];
+  for (int j = 0; j < handlerCount; j++) {
+    snprintf(path, sizeof(path), "/dlna/device/%d.xml", j);
+    server.on(path, T_GET, nop);
+  }
+  server.rewrite("/", "/dlna/device/0.xml");
+
+  char name[40];
+  snprintf(name, sizeof(name), "http_dispatch_%d", handlerCount);
+  char header[256];
+  benchmark(name, BENCHMARK_COUNT, [&](int j) {
+    strncpy(header, http_request, sizeof(header));
+    server.dispatch(header);
+  });
+}
+
+void benchmarkScheduler(int scheduleCount) {
+  Scheduler scheduler;
+  Vector<NopSchedule*> schedules;
+  for (int j = 0; j < scheduleCount; j++) {
+    NopSchedule* p_schedule = new NopSchedule();
+    schedules.push_back(p_schedule);
+    scheduler.add(p_schedule);
+  }
+
+  // make all schedules due, so that each execute processes all of them
+  char name[40];
+  snprintf(name, sizeof(name), "scheduler_execute_%d", scheduleCount);
+  benchmark(name, BENCHMARK_COUNT / scheduleCount + 10, [&](int j) {
+    for (auto p_schedule : schedules) p_schedule->time = 0;
+    scheduler.execute(udp);
+  });
+
+  // not due: measures the overhead of the loop
+  snprintf(name, sizeof(name), "scheduler_idle_%d", scheduleCount);
+  benchmark(name, BENCHMARK_COUNT,
+            [&](int j) { scheduler.execute(udp); });
+
+  // the scheduler deletes the schedules
+  for (auto p_schedule : schedules) p_schedule->active = false;
+  for (auto p_schedule : schedules) p_schedule->time = 0;
+  scheduler.execute(udp);
+}
+
+void setup() {
+  Serial.begin(119200);
+  // logging would dominate the measurements
+  DlnaLogger.begin(Serial, DlnaError);
+
+  benchmarkSSDP();
+  benchmarkXML();
+  benchmarkHttpServer(10);
+  benchmarkHttpServer(100);
+  benchmarkScheduler(10);
+  benchmarkScheduler(100);
+  benchmarkScheduler(1000);
+
+  exit(0);
+}
+
+void loop() {}
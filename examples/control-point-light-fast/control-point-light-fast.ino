@@ -49,6 +49,8 @@ void setup() {
 
   setupWifi();
   setupDevice();
+  // reuse the connection to the light for the actions
+  http.setKeepAlive(true);
   if (!cp.begin(http, udp, device_type, 20000, true)) {
     Serial.println("Dimmable Light not found");
     while (true);  // stop processing
@@ -47,17 +47,20 @@ void setupDeviceInfo() {
   // provide 
   auto transportCB = [](HttpServer* server, const char* requestPath,
                         HttpRequestHandlerLine* hl) {
-    server->reply("text/xml", transport_xml);
+    server->replyGzip("text/xml", transport_xml_gz, transport_xml_gz_len,
+                      transport_xml_len);
   };
 
   auto connmgrCB = [](HttpServer* server, const char* requestPath,
                       HttpRequestHandlerLine* hl) {
-    server->reply("text/xml", connmgr_xml);
+    server->replyGzip("text/xml", connmgr_xml_gz, connmgr_xml_gz_len,
+                      connmgr_xml_len);
   };
 
   auto controlCB = [](HttpServer* server, const char* requestPath,
                       HttpRequestHandlerLine* hl) {
-    server->reply("text/xml", control_xml);
+    server->replyGzip("text/xml", control_xml_gz, control_xml_gz_len,
+                      control_xml_len);
   };
 
   // define services
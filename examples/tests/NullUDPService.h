@@ -0,0 +1,24 @@
+#pragma once
+
+#include "dlna/IUDPService.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief UDP service for the tests and benchmarks which does not send or
+ * receive anything: subclasses can override send() and receive() to simulate
+ * the network.
+ * @author Phil Schatzmann
+ */
+class NullUDPService : public IUDPService {
+ public:
+  bool begin(int port) override { return true; }
+  bool begin(IPAddressAndPort addr) override { return true; }
+  bool send(uint8_t* data, int len) override { return true; }
+  bool send(IPAddressAndPort addr, uint8_t* data, int len) override {
+    return true;
+  }
+  RequestData receive() override { return RequestData{}; }
+};
+
+}  // namespace tiny_dlna
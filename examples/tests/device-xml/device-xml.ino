@@ -1,8 +1,24 @@
 // Test XML generation for Device
 #include "DLNA.h"
+#include "basic/BufferedPrint.h"
+
+#define BENCHMARK_COUNT 1000
 
 DLNADevice device;
 
+/// Output which counts the writes (e.g. to a WiFiClient)
+class CountingPrint : public Print {
+ public:
+  size_t write(uint8_t ch) override { return write(&ch, 1); }
+  size_t write(const uint8_t* data, size_t len) override {
+    writes++;
+    bytes += len;
+    return len;
+  }
+  size_t writes = 0;
+  size_t bytes = 0;
+};
+
 void setupDevice() {
   device.setBaseURL("http:/localhost:80/test");
   device.setDeviceType("urn:schemas-upnp-org:device:MediaRenderer:1");
@@ -16,17 +32,20 @@ void setupDevice() {
 
   auto transportCB = [](HttpServer* server, const char* requestPath,
                         HttpRequestHandlerLine* hl) {
-    server->reply("text/xml", transport_xml);
+    server->replyGzip("text/xml", transport_xml_gz, transport_xml_gz_len,
+                      transport_xml_len);
   };
 
   auto connmgrCB = [](HttpServer* server, const char* requestPath,
                       HttpRequestHandlerLine* hl) {
-    server->reply("text/xml", connmgr_xml);
+    server->replyGzip("text/xml", connmgr_xml_gz, connmgr_xml_gz_len,
+                      connmgr_xml_len);
   };
 
   auto controlCB = [](HttpServer* server, const char* requestPath,
                       HttpRequestHandlerLine* hl) {
-    server->reply("text/xml", control_xml);
+    server->replyGzip("text/xml", control_xml_gz, control_xml_gz_len,
+                      control_xml_len);
   };
 
   // define services
@@ -46,6 +65,35 @@ void setupDevice() {
   device.addService(avt);
 }
 
+void report(const char* title, CountingPrint& out, uint32_t ms) {
+  Serial.print(title);
+  Serial.print(": writes/render=");
+  Serial.print((int)(out.writes / BENCHMARK_COUNT));
+  Serial.print(" bytes/render=");
+  Serial.print((int)(out.bytes / BENCHMARK_COUNT));
+  Serial.print(" throughput KB/s=");
+  Serial.println((int)(ms == 0 ? 0 : out.bytes / ms));
+}
+
+// measure number of writes and throughput w/o and with BufferedPrint
+void benchmark() {
+  CountingPrint direct;
+  uint32_t start = millis();
+  for (int j = 0; j < BENCHMARK_COUNT; j++) {
+    device.print(direct);
+  }
+  report("direct", direct, millis() - start);
+
+  CountingPrint buffered;
+  BufferedPrint buffer{buffered};
+  start = millis();
+  for (int j = 0; j < BENCHMARK_COUNT; j++) {
+    device.print(buffer);
+    buffer.flush();
+  }
+  report("buffered", buffered, millis() - start);
+}
+
 void setup() {
   Serial.begin(119200);
   DlnaLogger.begin(Serial, DlnaInfo);
@@ -53,6 +101,8 @@ void setup() {
   setupDevice();
   // render device XML
   device.print(Serial);
+
+  benchmark();
 }
 
 void loop() {}
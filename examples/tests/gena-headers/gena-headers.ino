@@ -0,0 +1,131 @@
+// Checks the headers of the GENA messages which are sent by the
+// DLNAControlPointMgr: SUBSCRIBE, renewal (with the fallback after a 412)
+// and UNSUBSCRIBE. The device is simulated by a Client which records the
+// requests and provides the prepared replies.
+#include "DLNA.h"
+#include "../NullUDPService.h"
+
+const int max_requests = 5;
+
+/// Client which records the requests and answers with the prepared replies
+class MockClient : public Client {
+ public:
+  Str requests[max_requests];
+  const char* replies[max_requests] = {nullptr};
+  int request_count = 0;
+
+  int connect(IPAddress ip, uint16_t port) override { return open(); }
+  int connect(const char* host, uint16_t port) override { return open(); }
+  size_t write(uint8_t ch) override { return write(&ch, 1); }
+  size_t write(const uint8_t* buf, size_t size) override {
+    if (!is_open) return 0;
+    Str& req = requests[request_count - 1];
+    req.append((const char*)buf, size);
+    // the requests have no body: we reply at the end of the header
+    if (req.endsWith("\r\n\r\n") && replies[request_count - 1] != nullptr) {
+      input = replies[request_count - 1];
+      pos = 0;
+    }
+    return size;
+  }
+  int available() override { return input.length() - pos; }
+  int read() override { return available() > 0 ? input[pos++] : -1; }
+  int read(uint8_t* buf, size_t size) override {
+    int len = available() < (int)size ? available() : size;
+    memcpy(buf, input.c_str() + pos, len);
+    pos += len;
+    return len;
+  }
+  int peek() override { return available() > 0 ? input[pos] : -1; }
+  void flush() override {}
+  void stop() override { is_open = false; }
+  uint8_t connected() override { return is_open; }
+  operator bool() override { return is_open; }
+
+ protected:
+  Str input;
+  int pos = 0;
+  bool is_open = false;
+
+  int open() {
+    assert(request_count < max_requests);
+    request_count++;
+    input = "";
+    pos = 0;
+    is_open = true;
+    return 1;
+  }
+};
+
+const char* REPLY_SID =
+    "HTTP/1.1 200 OK\r\nSID: uuid:sid-1\r\nTIMEOUT: Second-60\r\n"
+    "Content-Length: 0\r\n\r\n";
+const char* REPLY_SID2 =
+    "HTTP/1.1 200 OK\r\nSID: uuid:sid-2\r\nTIMEOUT: Second-60\r\n"
+    "Content-Length: 0\r\n\r\n";
+const char* REPLY_412 =
+    "HTTP/1.1 412 Precondition Failed\r\nContent-Length: 0\r\n\r\n";
+const char* REPLY_OK = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+
+bool hasHeader(Str& request, const char* name) {
+  char key[40];
+  snprintf(key, sizeof(key), "\r\n%s:", name);
+  return request.indexOf(key) >= 0;
+}
+
+/// checks the method and which of the GENA headers are defined
+void check(Str& request, const char* method, bool sid, bool nt,
+           bool callback, bool timeout) {
+  Serial.print(request.c_str());
+  assert(request.startsWith(method));
+  assert(hasHeader(request, "SID") == sid);
+  assert(hasHeader(request, "NT") == nt);
+  assert(hasHeader(request, "CALLBACK") == callback);
+  assert(hasHeader(request, "TIMEOUT") == timeout);
+}
+
+MockClient client;
+HttpRequest http(client);
+NullUDPService udp;
+DLNAControlPointMgr cp;
+
+void setup() {
+  Serial.begin(115200);
+  DlnaLogger.begin(Serial, DlnaWarning);
+
+  DLNADevice device;
+  device.setBaseURL("http://127.0.0.1:49152");
+  device.setUDN("uuid:gena-test");
+  DLNAServiceInfo avt;
+  avt.setup("urn:schemas-upnp-org:service:AVTransport:1",
+            "urn:upnp-org:serviceId:AVTransport", "/AVT/scpd.xml", nullptr,
+            "/AVT/control", nullptr, "/AVT/event", nullptr);
+  device.addService(avt);
+  cp.addDevice(device);
+  cp.setLocalURL(Url("http://127.0.0.1:9001/events"));
+  cp.begin(http, udp, "ssdp:all", 0, false);
+
+  client.replies[0] = REPLY_SID;
+  client.replies[1] = REPLY_412;
+  client.replies[2] = REPLY_SID2;
+  client.replies[3] = REPLY_OK;
+
+  // new subscription
+  assert(cp.subscribe("AVTransport", 60));
+  // renewal: the device does not know the SID, so we subscribe again
+  assert(cp.subscribe("AVTransport", 60));
+  assert(StrView(cp.getSubscription("AVTransport")->sid.c_str())
+             .equals("uuid:sid-2"));
+  assert(cp.unsubscribe("AVTransport"));
+
+  assert(client.request_count == 4);
+  check(client.requests[0], "SUBSCRIBE", false, true, true, true);
+  check(client.requests[1], "SUBSCRIBE", true, false, false, true);
+  check(client.requests[2], "SUBSCRIBE", false, true, true, true);
+  check(client.requests[3], "UNSUBSCRIBE", true, false, false, false);
+
+  Serial.println("OK");
+  exit(0);
+}
+
+void loop() {}
@@ -0,0 +1,83 @@
+// Randomized comparison of the HttpRouter with a linear search over the same
+// patterns and of StrView::matches() with a simple recursive matcher
+#include "DLNA.h"
+
+#ifndef ROUTER_TEST_ROUNDS
+#define ROUTER_TEST_ROUNDS 200
+#endif
+
+const int pattern_count = 40;
+const int path_count = 200;
+char patterns[pattern_count][12];
+uint8_t keys[pattern_count];
+char paths[path_count][12];
+
+/// reference implementation of the wildcard matching
+bool refMatches(const char* str, const char* pattern) {
+  if (*pattern == 0) return *str == 0;
+  if (*pattern == '*') {
+    return refMatches(str, pattern + 1) ||
+           (*str != 0 && refMatches(str + 1, pattern));
+  }
+  if (*str == 0) return false;
+  if (*pattern == '?' || *pattern == *str) {
+    return refMatches(str + 1, pattern + 1);
+  }
+  return false;
+}
+
+/// random string from a small alphabet, so that we get many matches
+void randomString(char* result, int maxLen, const char* alphabet) {
+  int len = 1 + random(maxLen - 1);
+  int alphabet_len = strlen(alphabet);
+  result[0] = '/';
+  for (int j = 1; j < len; j++) result[j] = alphabet[random(alphabet_len)];
+  result[len] = 0;
+}
+
+void testRound(int round) {
+  HttpRouter router;
+  for (int j = 0; j < pattern_count; j++) {
+    randomString(patterns[j], sizeof(patterns[j]), "ab/*?");
+    keys[j] = random(3);
+    router.add(patterns[j], keys[j], patterns[j]);
+  }
+  router.build();
+
+  for (int j = 0; j < path_count; j++) {
+    randomString(paths[j], sizeof(paths[j]), "ab/");
+    uint8_t key = random(3);
+    StrView path(paths[j]);
+
+    // linear search in the sequence of the registration
+    Vector<void*> expected;
+    for (int k = 0; k < pattern_count; k++) {
+      bool matches = path.matches(patterns[k]);
+      if (matches != refMatches(paths[j], patterns[k])) {
+        Serial.print("matches() failed for ");
+        Serial.print(paths[j]);
+        Serial.print(" with ");
+        Serial.println(patterns[k]);
+        assert(false);
+      }
+      if (keys[k] == key && matches) expected.push_back(patterns[k]);
+    }
+
+    Vector<void*>& result = router.find(key, paths[j]);
+    assert(result.size() == expected.size());
+    for (int k = 0; k < expected.size(); k++) {
+      assert(result[k] == expected[k]);
+    }
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  DlnaLogger.begin(Serial, DlnaWarning);
+  randomSeed(1);
+  for (int round = 0; round < ROUTER_TEST_ROUNDS; round++) testRound(round);
+  Serial.println("OK");
+  exit(0);
+}
+
+void loop() {}
@@ -0,0 +1,616 @@
+// Load generator and soak test for the DLNADeviceMgr: a MediaRenderer is
+// started on the local host and simulated control points send M-SEARCH
+// bursts with a random MX, GET the device xml and the SCPDs and post SOAP
+// actions. The SSDP traffic is exchanged via an in memory IUDPService, so
+// that each control point has its own address (and is rate limited like in
+// a real network), the http requests are sent via TCP. The reply latency
+// percentiles, drop rates and the heap high-water mark are reported as JSON
+// lines.
+//
+// Configuration via environment variables: LOAD_DURATION_SEC (0 = run
+// forever) and LOAD_REPORT_SEC.
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <stdarg.h>
+
+#include "DLNA.h"
+#include "basic/List.h"
+#include "../NullUDPService.h"
+
+// default duration of a run in seconds
+#ifndef LOAD_DURATION_SEC
+#define LOAD_DURATION_SEC 3600
+#endif
+
+// default interval of the reports in seconds
+#ifndef LOAD_REPORT_SEC
+#define LOAD_REPORT_SEC 60
+#endif
+
+// number of simulated control points
+#ifndef LOAD_CONTROL_POINTS
+#define LOAD_CONTROL_POINTS 50
+#endif
+
+// max number of M-SEARCH requests in one burst
+#ifndef LOAD_MSEARCH_BURST
+#define LOAD_MSEARCH_BURST 20
+#endif
+
+// max ms between two M-SEARCH bursts
+#ifndef LOAD_MSEARCH_INTERVAL_MS
+#define LOAD_MSEARCH_INTERVAL_MS 2000
+#endif
+
+// max MX of the M-SEARCH requests
+#ifndef LOAD_MAX_MX
+#define LOAD_MAX_MX 5
+#endif
+
+// ms after MX after which a reply is considered to be late
+#ifndef LOAD_LATE_MS
+#define LOAD_LATE_MS 200
+#endif
+
+// ms after MX after which a missing reply is counted as dropped
+#ifndef LOAD_MISSING_MS
+#define LOAD_MISSING_MS 2000
+#endif
+
+// number of parallel http requests
+#ifndef LOAD_HTTP_CONCURRENCY
+#define LOAD_HTTP_CONCURRENCY 4
+#endif
+
+// ms after which a http request is aborted
+#ifndef LOAD_HTTP_TIMEOUT_MS
+#define LOAD_HTTP_TIMEOUT_MS 5000
+#endif
+
+// number of received packets which fit into the simulated socket
+#ifndef LOAD_UDP_QUEUE_SIZE
+#define LOAD_UDP_QUEUE_SIZE 32
+#endif
+
+#define LOAD_PORT 9876
+
+// heap usage: Vector, Str and List use new and delete unless USE_ALLOCATOR
+// is active. The allocations of the load generator are included, but they
+// are small compared to the device.
+static std::atomic<size_t> heap_current{0};
+static std::atomic<size_t> heap_peak{0};
+static std::atomic<uint64_t> heap_allocs{0};
+static const size_t heap_header = 16;
+
+void* operator new(size_t size) {
+  char* ptr = (char*)malloc(size + heap_header);
+  if (ptr == nullptr) throw std::bad_alloc();
+  *(size_t*)ptr = size;
+  size_t current = heap_current += size;
+  if (current > heap_peak) heap_peak = current;
+  heap_allocs++;
+  return ptr + heap_header;
+}
+
+void operator delete(void* ptr) noexcept {
+  if (ptr == nullptr) return;
+  char* start = (char*)ptr - heap_header;
+  heap_current -= *(size_t*)start;
+  free(start);
+}
+
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete[](void* ptr) noexcept { operator delete(ptr); }
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { operator delete(ptr); }
+
+/// Time in us
+static uint64_t nowUs() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/// Prints formatted output to Serial
+static void printOut(const char* fmt, ...) {
+  char line[200];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  Serial.print(line);
+}
+
+/**
+ * @brief Latency histogram with fixed buckets (10us up to 10ms, 1ms up to
+ * 10s), so that the memory does not grow with the duration of the run.
+ */
+class LatencyStats {
+ public:
+  void record(uint64_t us) {
+    int bucket = us < 10000 ? us / 10 : 1000 + (us - 10000) / 1000;
+    if (bucket >= bucket_count) bucket = bucket_count - 1;
+    buckets[bucket]++;
+    count++;
+    if (us > max_us) max_us = us;
+  }
+
+  void addError() { errors++; }
+
+  /// Provides the upper limit of the bucket which contains the percentile
+  double percentileMs(double percent) {
+    if (count == 0) return 0;
+    uint64_t limit = (uint64_t)(count * percent / 100.0);
+    uint64_t total = 0;
+    for (int j = 0; j < bucket_count; j++) {
+      total += buckets[j];
+      if (total > limit) {
+        return j < 1000 ? (j + 1) * 0.01 : 10.0 + (j - 999);
+      }
+    }
+    return max_us / 1000.0;
+  }
+
+  void printTo(const char* name) {
+    printOut(
+        "\"%s\":{\"count\":%llu,\"errors\":%llu,\"p50_ms\":%.2f,"
+        "\"p90_ms\":%.2f,\"p99_ms\":%.2f,\"max_ms\":%.2f}",
+        name, (unsigned long long)count, (unsigned long long)errors,
+        percentileMs(50), percentileMs(90), percentileMs(99), max_us / 1000.0);
+  }
+
+ protected:
+  static const int bucket_count = 11000;
+  uint32_t buckets[bucket_count] = {0};
+  uint64_t count = 0;
+  uint64_t errors = 0;
+  uint64_t max_us = 0;
+};
+
+/**
+ * @brief In memory UDP service of the device: the received packets are
+ * provided by the load generator and the sent packets are forwarded to it.
+ */
+class LoadUDPService : public NullUDPService {
+ public:
+  typedef void (*SendCallback)(IPAddressAndPort addr, const char* data,
+                               int len);
+
+  void setSendCallback(SendCallback cb) { send_cb = cb; }
+
+  bool send(uint8_t* data, int len) override {
+    return send(DLNABroadcastAddress, data, len);
+  }
+  bool send(IPAddressAndPort addr, uint8_t* data, int len) override {
+    if (send_cb != nullptr) send_cb(addr, (const char*)data, len);
+    return true;
+  }
+
+  RequestData receive() override {
+    RequestData result;
+    queue.pop_front(result);
+    return result;
+  }
+
+  /// Simulates a received packet: returns false if it was filtered or
+  /// dropped
+  bool push(IPAddressAndPort peer, const char* data) {
+    if (!isAccepted(data, strlen(data))) return false;
+    if (queue.size() >= LOAD_UDP_QUEUE_SIZE) {
+      addDropped();
+      return false;
+    }
+    RequestData req;
+    req.data = data;
+    req.peer = peer;
+    queue.push_back(req);
+    return true;
+  }
+
+ protected:
+  List<RequestData> queue;
+  SendCallback send_cb = nullptr;
+};
+
+/// Http request of the simulated control points
+struct LoadRequest {
+  const char* path;
+  // nullptr for a GET
+  const char* service_type;
+  const char* action;
+  const char* arguments;
+};
+
+static const LoadRequest load_requests[] = {
+    {"/dlna/device.xml", nullptr, nullptr, nullptr},
+    {"/dlna/AVT/service.xml", nullptr, nullptr, nullptr},
+    {"/dlna/RC/service.xml", nullptr, nullptr, nullptr},
+    {"/dlna/CM/service.xml", nullptr, nullptr, nullptr},
+    {"/dlna/AVT/control", "urn:schemas-upnp-org:service:AVTransport:1",
+     "GetTransportInfo", "<InstanceID>0</InstanceID>"},
+    {"/dlna/AVT/control", "urn:schemas-upnp-org:service:AVTransport:1",
+     "GetPositionInfo", "<InstanceID>0</InstanceID>"},
+    {"/dlna/RC/control", "urn:schemas-upnp-org:service:RenderingControl:1",
+     "GetVolume", "<InstanceID>0</InstanceID><Channel>Master</Channel>"},
+    {"/dlna/RC/control", "urn:schemas-upnp-org:service:RenderingControl:1",
+     "SetVolume",
+     "<InstanceID>0</InstanceID><Channel>Master</Channel>"
+     "<DesiredVolume>%d</DesiredVolume>"},
+    {"/dlna/CM/control", "urn:schemas-upnp-org:service:ConnectionManager:1",
+     "GetProtocolInfo", ""},
+};
+
+static const char* search_targets[] = {
+    "ssdp:all", "upnp:rootdevice",
+    "urn:schemas-upnp-org:device:MediaRenderer:1",
+    // not relevant for the device: must be filtered
+    "urn:schemas-upnp-org:device:MediaServer:1"};
+
+/**
+ * @brief Http request in progress: we only keep the header, the body is just
+ * counted.
+ */
+struct HttpSlot {
+  WiFiClient client;
+  bool active = false;
+  bool is_soap = false;
+  uint64_t start_us = 0;
+  uint32_t start_ms = 0;
+  char header[1024];
+  int header_len = 0;
+  bool header_complete = false;
+  int status = 0;
+  long content_length = -1;
+  bool is_chunked = false;
+  long body_len = 0;
+  char tail[5] = {0};
+};
+
+/**
+ * @brief Simulates the control points and collects the statistics.
+ */
+class LoadGenerator {
+ public:
+  void begin(LoadUDPService& udp, uint32_t durationSec, uint32_t reportSec) {
+    p_udp = &udp;
+    duration_ms = durationSec * 1000;
+    report_ms = reportSec * 1000;
+    start_ms = millis();
+    next_report_ms = start_ms + report_ms;
+    next_burst_ms = start_ms + 1000;
+  }
+
+  /// Generates the load: returns false when the run has ended
+  bool loop() {
+    uint32_t now = millis();
+    if (now >= next_burst_ms) {
+      sendBurst();
+      next_burst_ms = now + random(LOAD_MSEARCH_INTERVAL_MS);
+    }
+    checkMissing(now);
+    for (auto& slot : slots) processHttp(slot);
+    if (now >= next_report_ms) {
+      report();
+      next_report_ms = now + report_ms;
+    }
+    if (duration_ms > 0 && now - start_ms >= duration_ms) {
+      report();
+      return false;
+    }
+    return true;
+  }
+
+  /// Processes the UDP messages that were sent by the device
+  void onSend(IPAddressAndPort addr, const char* data, int len) {
+    if (StrView(data).startsWith("NOTIFY")) {
+      notify_count++;
+      return;
+    }
+    if (!StrView(data).startsWith("HTTP/1.1 200 OK")) return;
+    // a reply covers all open requests of the control point: ssdp:all is
+    // answered with several replies
+    msearch_replies++;
+    uint32_t now = millis();
+    uint64_t now_us = nowUs();
+    for (int j = pending.size() - 1; j >= 0; j--) {
+      PendingSearch& search = pending[j];
+      if (search.peer.address == addr.address &&
+          search.peer.port == addr.port) {
+        msearch_stats.record(now_us - search.sent_us);
+        if (now > search.sent_ms + search.mx * 1000ul + LOAD_LATE_MS) {
+          msearch_late++;
+        }
+        pending.erase(j);
+      }
+    }
+  }
+
+ protected:
+  struct PendingSearch {
+    IPAddressAndPort peer;
+    uint64_t sent_us = 0;
+    uint32_t sent_ms = 0;
+    int mx = 0;
+  };
+  LoadUDPService* p_udp = nullptr;
+  Vector<PendingSearch> pending;
+  HttpSlot slots[LOAD_HTTP_CONCURRENCY];
+  LatencyStats msearch_stats;
+  LatencyStats get_stats;
+  LatencyStats soap_stats;
+  uint64_t msearch_sent = 0;
+  uint64_t msearch_filtered = 0;
+  uint64_t msearch_missing = 0;
+  uint64_t msearch_late = 0;
+  uint64_t msearch_replies = 0;
+  uint64_t notify_count = 0;
+  uint32_t duration_ms = 0;
+  uint32_t report_ms = 0;
+  uint32_t start_ms = 0;
+  uint32_t next_report_ms = 0;
+  uint32_t next_burst_ms = 0;
+
+  IPAddressAndPort controlPoint(int idx) {
+    IPAddressAndPort result;
+    result.address = IPAddress(10, 1, idx / 250, idx % 250 + 1);
+    result.port = 50000 + idx;
+    return result;
+  }
+
+  void sendBurst() {
+    int count = random(LOAD_MSEARCH_BURST) + 1;
+    char msg[300];
+    for (int j = 0; j < count; j++) {
+      IPAddressAndPort peer = controlPoint(random(LOAD_CONTROL_POINTS));
+      int mx = random(LOAD_MAX_MX) + 1;
+      int st = random(sizeof(search_targets) / sizeof(search_targets[0]));
+      snprintf(msg, sizeof(msg),
+               "M-SEARCH * HTTP/1.1\r\n"
+               "HOST: 239.255.255.250:1900\r\n"
+               "MAN: \"ssdp:discover\"\r\n"
+               "MX: %d\r\n"
+               "ST: %s\r\n"
+               "USER-AGENT: LoadGenerator/1.0 UPnP/1.1\r\n\r\n",
+               mx, search_targets[st]);
+      msearch_sent++;
+      PendingSearch search;
+      search.peer = peer;
+      search.mx = mx;
+      search.sent_ms = millis();
+      search.sent_us = nowUs();
+      // filtered requests do not expect a reply: dropped ones are counted
+      // by the udp service and as missing
+      uint32_t filtered = p_udp->filteredCount();
+      if (!p_udp->push(peer, msg) && p_udp->filteredCount() != filtered) {
+        msearch_filtered++;
+        continue;
+      }
+      pending.push_back(search);
+    }
+  }
+
+  /// Counts the requests without reply
+  void checkMissing(uint32_t now) {
+    for (int j = pending.size() - 1; j >= 0; j--) {
+      PendingSearch& search = pending[j];
+      if (now > search.sent_ms + search.mx * 1000ul + LOAD_MISSING_MS) {
+        msearch_missing++;
+        msearch_stats.addError();
+        pending.erase(j);
+      }
+    }
+  }
+
+  void startHttp(HttpSlot& slot) {
+    const LoadRequest& request =
+        load_requests[random(sizeof(load_requests) / sizeof(LoadRequest))];
+    slot.is_soap = request.action != nullptr;
+    slot.header_len = 0;
+    slot.header_complete = false;
+    slot.status = 0;
+    slot.content_length = -1;
+    slot.is_chunked = false;
+    slot.body_len = 0;
+    memset(slot.tail, 0, sizeof(slot.tail));
+    slot.start_us = nowUs();
+    slot.start_ms = millis();
+
+    if (!slot.client.connect(IPAddress(127, 0, 0, 1), LOAD_PORT)) {
+      stats(slot).addError();
+      return;
+    }
+    slot.active = true;
+
+    char msg[1024];
+    if (!slot.is_soap) {
+      snprintf(msg, sizeof(msg),
+               "GET %s HTTP/1.1\r\n"
+               "Host: 127.0.0.1:%d\r\n"
+               "User-Agent: LoadGenerator/1.0 UPnP/1.1\r\n"
+               "Accept-Encoding: gzip\r\n"
+               "Connection: close\r\n\r\n",
+               request.path, LOAD_PORT);
+      slot.client.write((const uint8_t*)msg, strlen(msg));
+      return;
+    }
+
+    char arguments[200];
+    snprintf(arguments, sizeof(arguments), request.arguments,
+             (int)random(100));
+    char body[600];
+    snprintf(body, sizeof(body),
+             "<?xml version=\"1.0\"?>"
+             "<s:Envelope "
+             "xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\" "
+             "s:encodingStyle=\"http://schemas.xmlsoap.org/soap/encoding/\">"
+             "<s:Body><u:%s xmlns:u=\"%s\">%s</u:%s></s:Body></s:Envelope>",
+             request.action, request.service_type, arguments, request.action);
+    snprintf(msg, sizeof(msg),
+             "POST %s HTTP/1.1\r\n"
+             "Host: 127.0.0.1:%d\r\n"
+             "Content-Type: text/xml; charset=\"utf-8\"\r\n"
+             "SOAPACTION: \"%s#%s\"\r\n"
+             "Content-Length: %d\r\n"
+             "Connection: close\r\n\r\n%s",
+             request.path, LOAD_PORT, request.service_type, request.action,
+             (int)strlen(body), body);
+    slot.client.write((const uint8_t*)msg, strlen(msg));
+  }
+
+  LatencyStats& stats(HttpSlot& slot) {
+    return slot.is_soap ? soap_stats : get_stats;
+  }
+
+  void processHttp(HttpSlot& slot) {
+    if (!slot.active) {
+      startHttp(slot);
+      return;
+    }
+    uint8_t buffer[512];
+    while (slot.client.available() > 0) {
+      int len = slot.client.read(buffer, sizeof(buffer));
+      if (len <= 0) break;
+      received(slot, buffer, len);
+    }
+    bool is_complete = slot.header_complete && isBodyComplete(slot);
+    bool is_closed = !slot.client.connected() && slot.client.available() == 0;
+    if (is_complete || is_closed) {
+      // w/o content length the body ends when the connection is closed
+      bool ok = slot.header_complete && slot.status == 200 &&
+                (is_complete ||
+                 (slot.content_length < 0 && !slot.is_chunked));
+      if (ok) {
+        stats(slot).record(nowUs() - slot.start_us);
+      } else {
+        stats(slot).addError();
+      }
+      finishHttp(slot);
+    } else if (millis() - slot.start_ms > LOAD_HTTP_TIMEOUT_MS) {
+      stats(slot).addError();
+      finishHttp(slot);
+    }
+  }
+
+  void finishHttp(HttpSlot& slot) {
+    slot.client.stop();
+    slot.active = false;
+  }
+
+  void received(HttpSlot& slot, const uint8_t* data, int len) {
+    int pos = 0;
+    while (!slot.header_complete && pos < len) {
+      // we only keep the beginning of long headers
+      if (slot.header_len < (int)sizeof(slot.header) - 1) {
+        slot.header[slot.header_len++] = data[pos];
+      }
+      slot.header[slot.header_len] = 0;
+      memmove(slot.tail, slot.tail + 1, sizeof(slot.tail) - 1);
+      slot.tail[sizeof(slot.tail) - 1] = data[pos++];
+      if (memcmp(slot.tail + 1, "\r\n\r\n", 4) == 0) parseHeader(slot);
+    }
+    slot.body_len += len - pos;
+    // keep the last bytes to detect the end of the chunks
+    for (; pos < len; pos++) {
+      memmove(slot.tail, slot.tail + 1, sizeof(slot.tail) - 1);
+      slot.tail[sizeof(slot.tail) - 1] = data[pos];
+    }
+  }
+
+  void parseHeader(HttpSlot& slot) {
+    slot.header_complete = true;
+    memset(slot.tail, 0, sizeof(slot.tail));
+    const char* header = slot.header;
+    const char* status = strchr(header, ' ');
+    if (status != nullptr) slot.status = atoi(status + 1);
+    const char* line = header;
+    while ((line = strstr(line, "\r\n")) != nullptr) {
+      line += 2;
+      if (strncasecmp(line, "Content-Length:", 15) == 0) {
+        slot.content_length = atol(line + 15);
+      } else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0 &&
+                 StrView(line + 18).startsWith(" chunked")) {
+        slot.is_chunked = true;
+      }
+    }
+  }
+
+  bool isBodyComplete(HttpSlot& slot) {
+    if (slot.is_chunked) return memcmp(slot.tail, "0\r\n\r\n", 5) == 0;
+    if (slot.content_length >= 0) return slot.body_len >= slot.content_length;
+    return false;
+  }
+
+  void report() {
+    uint64_t answered = msearch_sent - msearch_filtered - pending.size();
+    double drop_rate =
+        answered == 0 ? 0.0 : (double)msearch_missing / answered;
+    printOut("{\"elapsed_s\":%lu,", (unsigned long)(millis() - start_ms) / 1000);
+    printOut(
+        "\"msearch_sent\":%llu,\"msearch_filtered\":%llu,"
+        "\"msearch_missing\":%llu,\"msearch_late\":%llu,"
+        "\"msearch_replies\":%llu,\"msearch_drop_rate\":%.4f,",
+        (unsigned long long)msearch_sent, (unsigned long long)msearch_filtered,
+        (unsigned long long)msearch_missing, (unsigned long long)msearch_late,
+        (unsigned long long)msearch_replies, drop_rate);
+    msearch_stats.printTo("msearch");
+    Serial.print(",");
+    get_stats.printTo("http_get");
+    Serial.print(",");
+    soap_stats.printTo("soap");
+    printOut(
+        ",\"notify_sent\":%llu,\"udp_dropped\":%lu,"
+        "\"device_msearch_dropped\":%lu,\"device_http_requests\":%lu,",
+        (unsigned long long)notify_count, (unsigned long)p_udp->droppedCount(),
+        (unsigned long)DlnaMetrics.value(CNT_MSEARCH_DROPPED),
+        (unsigned long)DlnaMetrics.value(CNT_HTTP_REQUESTS));
+    printOut("\"heap_bytes\":%lu,\"heap_peak_bytes\":%lu,\"heap_allocs\":%llu}",
+             (unsigned long)heap_current, (unsigned long)heap_peak,
+             (unsigned long long)heap_allocs);
+    Serial.println();
+  }
+};
+
+MediaRenderer mr;
+DLNADevice device;
+WiFiServer wifi;
+HttpServer server(wifi);
+LoadUDPService udp;
+LoadGenerator generator;
+Icon icon;
+
+static uint32_t envValue(const char* name, uint32_t defaultValue) {
+  const char* value = getenv(name);
+  return value == nullptr ? defaultValue : atol(value);
+}
+
+void setup() {
+  Serial.begin(115200);
+  // logging would dominate the measurements
+  DlnaLogger.begin(Serial, DlnaError);
+
+  // setup device on the local host
+  device.setBaseURL("http://127.0.0.1:9876/dlna");
+  device.setIPAddress(IPAddress(127, 0, 0, 1));
+  device.setFriendlyName("Load Test Media Renderer");
+  device.addIcon(icon);
+  mr.setEventDrivenLoop(true, 1);
+  udp.setSendCallback([](IPAddressAndPort addr, const char* data, int len) {
+    generator.onSend(addr, data, len);
+  });
+  if (!mr.begin(device, udp, server)) {
+    Serial.println("MediaRenderer failed");
+    exit(1);
+  }
+
+  generator.begin(udp, envValue("LOAD_DURATION_SEC", LOAD_DURATION_SEC),
+                  envValue("LOAD_REPORT_SEC", LOAD_REPORT_SEC));
+}
+
+void loop() {
+  mr.loop();
+  if (!generator.loop()) {
+    mr.end();
+    exit(0);
+  }
+}
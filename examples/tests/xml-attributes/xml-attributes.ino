@@ -0,0 +1,47 @@
+// Checks the attribute parsing of the XMLStreamParser: the spaces around
+// the = are valid XML (e.g. xmlns:u = "urn:...") and must not change the
+// attribute name
+#include "DLNA.h"
+
+/// Parser which records the attributes as name=value;
+class AttributeParser : public XMLStreamParser {
+ public:
+  Str result{80};
+
+ protected:
+  void onAttribute(const char* node, const char* name,
+                   const char* value) override {
+    result += node;
+    result += ":";
+    result += name;
+    result += "=";
+    result += value;
+    result += ";";
+  }
+};
+
+void test(const char* xml, const char* expected) {
+  AttributeParser parser;
+  parser.begin();
+  parser.write((const uint8_t*)xml, strlen(xml));
+  Serial.println(parser.result.c_str());
+  assert(parser.result.equals(expected));
+}
+
+void setup() {
+  Serial.begin(115200);
+  DlnaLogger.begin(Serial, DlnaWarning);
+
+  test("<u:Play xmlns:u=\"urn:x\"/>", "u:Play:xmlns:u=urn:x;");
+  test("<u:Play xmlns:u = \"urn:x\"/>", "u:Play:xmlns:u=urn:x;");
+  test("<u:Play xmlns:u =\"urn:x\"/>", "u:Play:xmlns:u=urn:x;");
+  test("<u:Play xmlns:u=\n  'urn:x'></u:Play>", "u:Play:xmlns:u=urn:x;");
+  test("<a  b = \"1\"\tc\t=\t'2' d=\"&amp;\" >x</a>", "a:b=1;a:c=2;a:d=&;");
+  // an attribute w/o value is ignored
+  test("<a flag b=\"1\"/>", "a:b=1;");
+
+  Serial.println("OK");
+  exit(0);
+}
+
+void loop() {}
@@ -0,0 +1,7 @@
+#include "Allocator.h"
+
+namespace tiny_dlna {
+
+AllocatorExt DefaultAllocator;
+
+}
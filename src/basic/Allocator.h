@@ -1,8 +1,16 @@
 #pragma once
 #include <stdlib.h>
 
+#include <utility>
+
 #include "basic/Logger.h"
 
+// Vector, Str and List use the DefaultAllocator only if this is set to 1:
+// otherwise they use new and delete unless an allocator was set explicitly
+#ifndef USE_ALLOCATOR
+#define USE_ALLOCATOR 0
+#endif
+
 namespace tiny_dlna {
 
 /**
@@ -20,12 +28,13 @@ namespace tiny_dlna {
 
 class Allocator {
  public:
-  // creates an object
-  template <class T>
-  T* create() {
+  // creates an object: returns nullptr if the memory is not available
+  template <class T, class... Args>
+  T* create(Args&&... args) {
     void* addr = allocate(sizeof(T));
+    if (addr == nullptr) return nullptr;
     // call constructor
-    T* ref = new (addr) T();
+    T* ref = new (addr) T(std::forward<Args>(args)...);
     return ref;
   }
 
@@ -61,10 +70,10 @@ class Allocator {
   virtual void* allocate(size_t size) {
     void* result = do_allocate(size);
     if (result == nullptr) {
-      DlnaLogger.log(DlnaError, "Allocateation failed for %zu bytes", size);
+      DLNA_LOG(DlnaError, "Allocateation failed for %zu bytes", size);
       stop();
     } else {
-      DlnaLogger.log(DlnaDebug, "Allocated %zu", size);
+      DLNA_LOG(DlnaDebug, "Allocated %zu", size);
     }
     return result;
   }
@@ -100,7 +109,7 @@ class AllocatorExt : public Allocator {
 #endif
     if (result == nullptr) result = malloc(size);
     if (result == nullptr) {
-      DlnaLogger.log(DlnaError, "allocateation failed for %zu bytes", size);
+      DLNA_LOG(DlnaError, "allocateation failed for %zu bytes", size);
       stop();
     }
     // initialize object
@@ -125,7 +134,7 @@ class AllocatorPSRAM : public Allocator {
     void* result = nullptr;
     result = ps_calloc(1, size);
     if (result == nullptr) {
-      DlnaLogger.log(DlnaError, "allocateation failed for %zu bytes", size);
+      DLNA_LOG(DlnaError, "allocateation failed for %zu bytes", size);
       stop();
     }
     return result;
@@ -134,6 +143,279 @@ class AllocatorPSRAM : public Allocator {
 
 #endif
 
-static AllocatorExt DefaultAllocator;
+extern AllocatorExt DefaultAllocator;
+
+/**
+ * @brief Memory allocator for temporary objects: the memory is handed out
+ * from a single block which is requested only once from the parent allocator
+ * and free() does nothing. All memory is released at once with clear()
+ * (e.g. at the end of a request), so all objects which use it must have been
+ * destroyed by then. If the block is exhausted we fall back to the parent
+ * allocator.
+ * @ingroup memorymgmt
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class ArenaAllocator : public Allocator {
+ public:
+  ArenaAllocator(size_t size, Allocator& allocator = DefaultAllocator) {
+    arena_size = size;
+    p_parent = &allocator;
+  }
+
+  ~ArenaAllocator() {
+    if (p_memory != nullptr) p_parent->free(p_memory);
+  }
+
+  /// Provides the memory from the arena
+  void* allocate(size_t size) override {
+    if (p_memory == nullptr) {
+      p_memory = (uint8_t*)p_parent->allocate(arena_size);
+    }
+    size_t aligned = ((size + align - 1) / align) * align;
+    if (p_memory == nullptr || aligned > arena_size - arena_used) {
+      DLNA_LOG(DlnaDebug, "Arena exhausted for %zu bytes", size);
+      overflow_count++;
+      return p_parent->allocate(size);
+    }
+    uint8_t* result = p_memory + arena_used;
+    arena_used += aligned;
+    if (arena_used > peak_used) peak_used = arena_used;
+    memset(result, 0, aligned);
+    return result;
+  }
+
+  /// The arena memory is only released by clear()
+  void free(void* memory) override {
+    if (memory != nullptr && !contains(memory)) p_parent->free(memory);
+  }
+
+  /// Releases all memory of the arena
+  void clear() { arena_used = 0; }
+
+  /// Number of bytes which are in use
+  size_t used() { return arena_used; }
+
+  /// Max number of bytes which were in use
+  size_t peak() { return peak_used; }
+
+  /// Size of the arena
+  size_t capacity() { return arena_size; }
+
+  /// Number of allocations which were provided by the parent allocator
+  uint32_t overflowCount() { return overflow_count; }
+
+ protected:
+  static const size_t align = sizeof(void*) > 8 ? sizeof(void*) : 8;
+  Allocator* p_parent = nullptr;
+  uint8_t* p_memory = nullptr;
+  size_t arena_size = 0;
+  size_t arena_used = 0;
+  size_t peak_used = 0;
+  uint32_t overflow_count = 0;
+
+  bool contains(void* memory) {
+    uint8_t* ptr = (uint8_t*)memory;
+    return p_memory != nullptr && ptr >= p_memory &&
+           ptr < p_memory + arena_size;
+  }
+};
+
+/**
+ * @brief Memory allocator which provides fixed size blocks from a single
+ * memory area that is requested only once from the parent allocator. If all
+ * blocks are in use, allocate() returns nullptr: we never fall back to the
+ * heap, so that the memory can not get fragmented.
+ * @ingroup memorymgmt
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class AllocatorPool : public Allocator {
+ public:
+  AllocatorPool(size_t blockSize, int blockCount,
+                Allocator& allocator = DefaultAllocator) {
+    // we need to be able to store the next pointer and keep the alignment
+    size_t align = sizeof(void*) > 8 ? sizeof(void*) : 8;
+    block_size = ((blockSize + align - 1) / align) * align;
+    block_count = blockCount;
+    p_parent = &allocator;
+  }
+
+  ~AllocatorPool() {
+    if (p_memory != nullptr) p_parent->free(p_memory);
+  }
+
+  /// Provides a free block (or nullptr if the pool is exhausted)
+  void* allocate(size_t size) override {
+    if (size > block_size) {
+      DLNA_LOG(DlnaError, "Pool block size %zu too small for %zu",
+               block_size, size);
+      return nullptr;
+    }
+    if (p_memory == nullptr) setup();
+    if (p_free == nullptr) {
+      DLNA_LOG(DlnaWarning, "Pool exhausted: %d blocks in use",
+               block_count);
+      return nullptr;
+    }
+    Block* result = p_free;
+    p_free = p_free->next;
+    used_count++;
+    memset(result, 0, block_size);
+    return result;
+  }
+
+  /// Returns the block to the pool
+  void free(void* memory) override {
+    if (memory == nullptr) return;
+    if (!contains(memory)) {
+      DLNA_LOG(DlnaError, "Pool: invalid free");
+      return;
+    }
+    Block* block = (Block*)memory;
+    block->next = p_free;
+    p_free = block;
+    used_count--;
+  }
+
+  /// Number of blocks which are in use
+  int used() { return used_count; }
+
+  /// Number of blocks which are still available
+  int available() { return block_count - used_count; }
+
+  /// Total number of blocks
+  int capacity() { return block_count; }
+
+ protected:
+  struct Block {
+    Block* next;
+  };
+  Allocator* p_parent = nullptr;
+  uint8_t* p_memory = nullptr;
+  Block* p_free = nullptr;
+  size_t block_size = 0;
+  int block_count = 0;
+  int used_count = 0;
+
+  /// allocate the memory for all blocks and link them
+  void setup() {
+    p_memory = (uint8_t*)p_parent->allocate(block_size * block_count);
+    for (int j = block_count - 1; j >= 0; j--) {
+      Block* block = (Block*)(p_memory + j * block_size);
+      block->next = p_free;
+      p_free = block;
+    }
+  }
+
+  bool contains(void* memory) {
+    uint8_t* ptr = (uint8_t*)memory;
+    return ptr >= p_memory && ptr < p_memory + block_size * block_count;
+  }
+};
+
+/**
+ * @brief Allocator which counts the live bytes, the peak bytes and the number
+ * of allocations of a subsystem (e.g. "Vector", "Str" or "Schedule") and
+ * forwards the requests to the parent allocator. Each instance registers
+ * itself, so that printAll() can report the values of all tags. In order to
+ * be able to release the memory with the right size we store the size in
+ * front of each block. Assign it with setAllocator() before any memory has
+ * been allocated.
+ * @ingroup memorymgmt
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class AllocatorTracking : public Allocator {
+ public:
+  AllocatorTracking(const char* tag, Allocator& allocator = DefaultAllocator) {
+    p_tag = tag;
+    p_parent = &allocator;
+    // register
+    p_next = first();
+    first() = this;
+  }
+
+  ~AllocatorTracking() {
+    // unregister
+    for (AllocatorTracking** p = &first(); *p != nullptr; p = &(*p)->p_next) {
+      if (*p == this) {
+        *p = p_next;
+        break;
+      }
+    }
+  }
+
+  /// Allocates the memory with the parent allocator
+  void* allocate(size_t size) override {
+    uint8_t* block = (uint8_t*)p_parent->allocate(size + header_size);
+    if (block == nullptr) return nullptr;
+    *((size_t*)block) = size;
+    live_bytes += size;
+    if (live_bytes > peak_bytes) peak_bytes = live_bytes;
+    allocation_count++;
+    return block + header_size;
+  }
+
+  /// Releases the memory with the parent allocator
+  void free(void* memory) override {
+    if (memory == nullptr) return;
+    uint8_t* block = (uint8_t*)memory - header_size;
+    live_bytes -= *((size_t*)block);
+    free_count++;
+    p_parent->free(block);
+  }
+
+  /// Name of the subsystem
+  const char* tag() { return p_tag; }
+
+  /// Number of bytes which are currently allocated
+  size_t liveBytes() { return live_bytes; }
+
+  /// Max number of bytes which have been allocated at the same time
+  size_t peakBytes() { return peak_bytes; }
+
+  /// Number of allocations
+  uint32_t allocationCount() { return allocation_count; }
+
+  /// Number of blocks which are currently allocated
+  uint32_t liveCount() { return allocation_count - free_count; }
+
+  /// Resets the peak to the actual value
+  void resetPeak() { peak_bytes = live_bytes; }
+
+  /// Provides the next registered AllocatorTracking
+  AllocatorTracking* next() { return p_next; }
+
+  /// Provides the first registered AllocatorTracking
+  static AllocatorTracking*& first() {
+    static AllocatorTracking* p_first = nullptr;
+    return p_first;
+  }
+
+  /// Prints the values of all registered AllocatorTracking
+  static void printAll(Print& out) {
+    char line[120];
+    for (AllocatorTracking* p = first(); p != nullptr; p = p->next()) {
+      snprintf(line, sizeof(line),
+               "%s: live=%lu peak=%lu blocks=%lu allocations=%lu", p->tag(),
+               (unsigned long)p->liveBytes(), (unsigned long)p->peakBytes(),
+               (unsigned long)p->liveCount(),
+               (unsigned long)p->allocationCount());
+      out.println(line);
+    }
+  }
+
+ protected:
+  // we keep the alignment of the parent allocator
+  static const size_t header_size = sizeof(size_t) > 8 ? sizeof(size_t) : 8;
+  const char* p_tag = nullptr;
+  Allocator* p_parent = nullptr;
+  AllocatorTracking* p_next = nullptr;
+  size_t live_bytes = 0;
+  size_t peak_bytes = 0;
+  uint32_t allocation_count = 0;
+  uint32_t free_count = 0;
+};
 
 }  // namespace tiny_dlna
\ No newline at end of file
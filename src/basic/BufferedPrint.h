@@ -0,0 +1,151 @@
+#pragma once
+#include "Print.h"
+#include "basic/Logger.h"
+#include "basic/Vector.h"
+
+// default chunk size: TCP maximum segment size
+#ifndef DLNA_PRINT_BUFFER_SIZE
+#define DLNA_PRINT_BUFFER_SIZE 1460
+#endif
+
+// max time in ms that flush() waits for the output to accept the data
+#ifndef DLNA_PRINT_FLUSH_TIMEOUT
+#define DLNA_PRINT_FLUSH_TIMEOUT 2000
+#endif
+
+namespace tiny_dlna {
+
+/***
+ * @brief Print which collects the (small) writes in a buffer and forwards
+ * them in chunks of the indicated size to the final output. This way e.g. a
+ * WiFiClient receives MSS sized writes instead of many tiny ones.
+ * Call flush() to write out the remaining data.
+ * If the output does not accept all data, the unwritten rest is kept in the
+ * buffer and written first by the next call: write() reports the number of
+ * bytes it could take, so the caller can retry the rest.
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class BufferedPrint : public Print {
+ public:
+  BufferedPrint(int chunkSize = DLNA_PRINT_BUFFER_SIZE) {
+    setChunkSize(chunkSize);
+  }
+  BufferedPrint(Print& out, int chunkSize = DLNA_PRINT_BUFFER_SIZE) {
+    setChunkSize(chunkSize);
+    setOutput(out);
+  }
+  ~BufferedPrint() { flush(); }
+
+  /// Defines the final output
+  void setOutput(Print& out) {
+    flush();
+    discard();
+    p_out = &out;
+  }
+
+  /// Defines the size of the written chunks
+  void setChunkSize(int size) {
+    flush();
+    discard();
+    chunk_size = size;
+    buffer.resize(0);
+  }
+
+  size_t write(uint8_t ch) override { return write(&ch, 1); }
+
+  size_t write(const uint8_t* data, size_t len) override {
+    if (p_out == nullptr) return 0;
+    // big writes are passed on directly
+    if (pos == 0 && (int)len >= chunk_size) return writeOut(data, len);
+    if (buffer.size() < chunk_size) buffer.resize(chunk_size);
+    size_t result = 0;
+    while (result < len) {
+      int remaining = len - result;
+      int n = chunk_size - pos < remaining ? chunk_size - pos : remaining;
+      memcpy(buffer.data() + pos, data + result, n);
+      pos += n;
+      result += n;
+      // the buffer is still full if the output did not accept anything
+      if (pos == chunk_size && !writeBuffer() && pos == chunk_size) break;
+    }
+    return result;
+  }
+
+  /// Writes out the buffered data: we retry up to the timeout if the output
+  /// does not accept all data
+  void flush() override {
+    if (p_out == nullptr) return;
+    uint32_t last_progress = millis();
+    int open = pos;
+    while (!writeBuffer()) {
+      if (pos < open) {
+        open = pos;
+        last_progress = millis();
+      } else if (millis() - last_progress > timeout) {
+        DLNA_LOG(DlnaError, "BufferedPrint: %d bytes not written", pos);
+        break;
+      }
+      delay(1);
+    }
+    p_out->flush();
+  }
+
+  /// Writes out the buffered data and releases the output
+  void end() {
+    flush();
+    discard();
+    p_out = nullptr;
+  }
+
+  /// Defines the max time in ms that flush() waits without progress
+  void setTimeout(uint32_t ms) { timeout = ms; }
+
+  /// Number of buffered bytes which have not been written yet
+  int buffered() { return pos; }
+
+  /// Number of writes to the final output
+  size_t writeCount() { return write_count; }
+
+  /// Number of writes to the final output which did not accept all data
+  size_t shortWrites() { return short_writes; }
+
+ protected:
+  Print* p_out = nullptr;
+  Vector<uint8_t> buffer;
+  int chunk_size = DLNA_PRINT_BUFFER_SIZE;
+  int pos = 0;
+  uint32_t timeout = DLNA_PRINT_FLUSH_TIMEOUT;
+  size_t write_count = 0;
+  size_t short_writes = 0;
+
+  /// writes the buffered data: the unwritten rest is moved to the start of
+  /// the buffer. Returns true if all data has been written.
+  bool writeBuffer() {
+    if (pos == 0) return true;
+    int written = writeOut(buffer.data(), pos);
+    if (written < pos) {
+      memmove(buffer.data(), buffer.data() + written, pos - written);
+    }
+    pos -= written;
+    return pos == 0;
+  }
+
+  size_t writeOut(const uint8_t* data, size_t len) {
+    write_count++;
+    int result = p_out->write(data, len);
+    if (result < 0) result = 0;
+    if ((size_t)result < len) short_writes++;
+    return result;
+  }
+
+  /// removes the data which could not be written
+  void discard() {
+    if (pos > 0) {
+      DLNA_LOG(DlnaWarning, "BufferedPrint: %d bytes discarded", pos);
+    }
+    pos = 0;
+  }
+};
+
+}  // namespace tiny_dlna
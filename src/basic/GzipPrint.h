@@ -0,0 +1,266 @@
+#pragma once
+#include "Print.h"
+#include "basic/Logger.h"
+#include "basic/Vector.h"
+
+// history window of the compression: power of 2 and >= 512
+#ifndef DLNA_DEFLATE_WINDOW_SIZE
+#define DLNA_DEFLATE_WINDOW_SIZE 1024
+#endif
+
+// number of hash bits used to find the matches
+#ifndef DLNA_DEFLATE_HASH_BITS
+#define DLNA_DEFLATE_HASH_BITS 9
+#endif
+
+// max number of candidates which are compared for a match
+#ifndef DLNA_DEFLATE_MAX_CHAIN
+#define DLNA_DEFLATE_MAX_CHAIN 8
+#endif
+
+namespace tiny_dlna {
+
+/***
+ * @brief Print which compresses the written data with deflate (RFC 1951) and
+ * writes it in the gzip format (RFC 1952) to the final output. We use a small
+ * LZ77 window and the fixed huffman codes, so that the memory is bounded to
+ * 4 * DLNA_DEFLATE_WINDOW_SIZE + 2 * 2^DLNA_DEFLATE_HASH_BITS bytes (5 KB with
+ * the default settings). The output is written byte by byte, so
+ * you should use a BufferedPrint as output.
+ * Call begin() before writing and end() to write the remaining data and the
+ * trailer.
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class GzipPrint : public Print {
+ public:
+  GzipPrint(int windowSize = DLNA_DEFLATE_WINDOW_SIZE) {
+    window_size = windowSize;
+  }
+
+  /// Starts a new gzip stream to the indicated output
+  void begin(Print& out) {
+    p_out = &out;
+    window.resize(window_size * 2);
+    hash_head.resize(1 << DLNA_DEFLATE_HASH_BITS);
+    hash_prev.resize(window_size);
+    for (int j = 0; j < hash_head.size(); j++) hash_head[j] = -1;
+    pos = 0;
+    fill = 0;
+    bit_buffer = 0;
+    bit_count = 0;
+    crc = 0xffffffff;
+    total_size = 0;
+    // header: ID1 ID2 CM FLG MTIME(4) XFL OS(unknown)
+    const uint8_t header[] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+    p_out->write(header, sizeof(header));
+    // final block with fixed huffman codes
+    putBits(1, 1);
+    putBits(1, 2);
+  }
+
+  size_t write(uint8_t ch) override { return write(&ch, 1); }
+
+  size_t write(const uint8_t* data, size_t len) override {
+    if (p_out == nullptr) return 0;
+    updateCRC(data, len);
+    total_size += len;
+    size_t result = 0;
+    while (result < len) {
+      int remaining = len - result;
+      int space = window.size() - fill;
+      int n = space < remaining ? space : remaining;
+      memcpy(window.data() + fill, data + result, n);
+      fill += n;
+      result += n;
+      if (fill == window.size()) {
+        compress(false);
+        slide();
+      }
+    }
+    return result;
+  }
+
+  /// Compresses the remaining data and writes the gzip trailer
+  void end() {
+    if (p_out == nullptr) return;
+    compress(true);
+    // end of block
+    putCode(256);
+    // flush the remaining bits
+    if (bit_count > 0) putBits(0, 8 - bit_count);
+    uint32_t crc_value = crc ^ 0xffffffff;
+    writeInt32(crc_value);
+    writeInt32(total_size);
+    p_out = nullptr;
+  }
+
+  /// Returns true if begin() was called and end() is still pending
+  bool isActive() { return p_out != nullptr; }
+
+  /// Releases the allocated memory
+  void release() {
+    window.reset();
+    hash_head.reset();
+    hash_prev.reset();
+  }
+
+ protected:
+  static const int MIN_MATCH = 3;
+  static const int MAX_MATCH = 258;
+  Print* p_out = nullptr;
+  Vector<uint8_t> window;
+  Vector<int16_t> hash_head;
+  Vector<int16_t> hash_prev;
+  int window_size;
+  int pos = 0;
+  int fill = 0;
+  uint32_t bit_buffer = 0;
+  int bit_count = 0;
+  uint32_t crc = 0xffffffff;
+  uint32_t total_size = 0;
+
+  void compress(bool isFinal) {
+    uint8_t* data = window.data();
+    while (pos < fill && (isFinal || fill - pos >= MAX_MATCH)) {
+      int available = fill - pos;
+      int best_len = 0;
+      int best_dist = 0;
+      if (available >= MIN_MATCH) {
+        int max_len = available < MAX_MATCH ? available : MAX_MATCH;
+        int candidate = insert(pos);
+        int chain = DLNA_DEFLATE_MAX_CHAIN;
+        while (candidate >= 0 && pos - candidate <= window_size &&
+               chain-- > 0) {
+          int len = 0;
+          while (len < max_len && data[candidate + len] == data[pos + len])
+            len++;
+          if (len > best_len) {
+            best_len = len;
+            best_dist = pos - candidate;
+            if (len == max_len) break;
+          }
+          int next = hash_prev[candidate & (window_size - 1)];
+          if (next >= candidate) break;
+          candidate = next;
+        }
+      }
+      if (best_len >= MIN_MATCH) {
+        putMatch(best_len, best_dist);
+        // hash the skipped positions
+        for (int j = 1; j < best_len; j++) {
+          if (fill - (pos + j) >= MIN_MATCH) insert(pos + j);
+        }
+        pos += best_len;
+      } else {
+        putCode(data[pos]);
+        pos++;
+      }
+    }
+  }
+
+  /// adds the position to the hash chain and returns the previous candidate
+  int insert(int position) {
+    uint8_t* data = window.data();
+    int hash = ((data[position] << 10) ^ (data[position + 1] << 5) ^
+                data[position + 2]) &
+               ((1 << DLNA_DEFLATE_HASH_BITS) - 1);
+    int result = hash_head[hash];
+    hash_prev[position & (window_size - 1)] = result;
+    hash_head[hash] = position;
+    return result;
+  }
+
+  /// moves the upper half of the window down
+  void slide() {
+    memmove(window.data(), window.data() + window_size, fill - window_size);
+    pos -= window_size;
+    fill -= window_size;
+    for (int j = 0; j < hash_head.size(); j++) {
+      hash_head[j] = hash_head[j] >= window_size ? hash_head[j] - window_size
+                                                 : -1;
+    }
+    for (int j = 0; j < hash_prev.size(); j++) {
+      hash_prev[j] = hash_prev[j] >= window_size ? hash_prev[j] - window_size
+                                                 : -1;
+    }
+  }
+
+  void putMatch(int len, int dist) {
+    static const uint16_t length_base[29] = {
+        3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+        31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const uint8_t length_extra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                             1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                             4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static const uint16_t dist_base[30] = {
+        1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+        33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+        1025, 1537, 2049, 3073, 4097, 6145,  8193,  12289, 16385, 24577};
+    static const uint8_t dist_extra[30] = {0, 0, 0, 0, 1, 1, 2,  2,  3,  3,
+                                           4, 4, 5, 5, 6, 6, 7,  7,  8,  8,
+                                           9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+    int code = 28;
+    while (length_base[code] > len) code--;
+    putCode(257 + code);
+    putBits(len - length_base[code], length_extra[code]);
+    code = 29;
+    while (dist_base[code] > dist) code--;
+    // fixed distance codes have 5 bits
+    putBits(reverse(code, 5), 5);
+    putBits(dist - dist_base[code], dist_extra[code]);
+  }
+
+  /// writes the fixed huffman code of a literal/length symbol
+  void putCode(int symbol) {
+    if (symbol < 144) {
+      putBits(reverse(0x30 + symbol, 8), 8);
+    } else if (symbol < 256) {
+      putBits(reverse(0x190 + symbol - 144, 9), 9);
+    } else if (symbol < 280) {
+      putBits(reverse(symbol - 256, 7), 7);
+    } else {
+      putBits(reverse(0xc0 + symbol - 280, 8), 8);
+    }
+  }
+
+  int reverse(int code, int len) {
+    int result = 0;
+    for (int j = 0; j < len; j++) {
+      result = (result << 1) | (code & 1);
+      code >>= 1;
+    }
+    return result;
+  }
+
+  void putBits(uint32_t value, int len) {
+    bit_buffer |= value << bit_count;
+    bit_count += len;
+    while (bit_count >= 8) {
+      p_out->write((uint8_t)bit_buffer);
+      bit_buffer >>= 8;
+      bit_count -= 8;
+    }
+  }
+
+  void writeInt32(uint32_t value) {
+    for (int j = 0; j < 4; j++) {
+      p_out->write((uint8_t)(value & 0xff));
+      value >>= 8;
+    }
+  }
+
+  void updateCRC(const uint8_t* data, size_t len) {
+    static const uint32_t table[16] = {
+        0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4,
+        0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+        0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
+    for (size_t j = 0; j < len; j++) {
+      crc ^= data[j];
+      crc = table[crc & 0x0f] ^ (crc >> 4);
+      crc = table[crc & 0x0f] ^ (crc >> 4);
+    }
+  }
+};
+
+}  // namespace tiny_dlna
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <string.h>
+
+#include "basic/Vector.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief Hash index from string keys to (up to two) int values, e.g. the
+ * index of an object in a Vector. We only store the hash of the key, so the
+ * key does not need to stay valid: the caller must verify the candidates that
+ * are provided by find() and next() because different keys can have the same
+ * hash.
+ * @author Phil Schatzmann
+ */
+class HashIndex {
+ public:
+  /// Removes all entries
+  void clear() {
+    entries.clear();
+    buckets.clear();
+  }
+
+  /// Adds an entry for the first len characters of the key (or the full key
+  /// if len is -1)
+  void add(const char* key, int value, int value2 = -1, int len = -1) {
+    if (key == nullptr) return;
+    Entry entry;
+    entry.hash = hash(key, len);
+    entry.value = value;
+    entry.value2 = value2;
+    entries.push_back(entry);
+    // keep the load factor <= 1
+    if (entries.size() > buckets.size()) {
+      rebuild(buckets.size() == 0 ? 16 : buckets.size() * 2);
+    } else {
+      link(entries.size() - 1);
+    }
+  }
+
+  /// Provides the position of the first candidate for the key or -1
+  int find(const char* key) {
+    if (key == nullptr || buckets.size() == 0) return -1;
+    uint32_t key_hash = hash(key);
+    return matching(buckets[key_hash & (buckets.size() - 1)], key_hash);
+  }
+
+  /// Provides the position of the next candidate or -1
+  int next(int pos) {
+    if (pos < 0) return -1;
+    return matching(entries[pos].next, entries[pos].hash);
+  }
+
+  /// Provides the value of the candidate
+  int value(int pos) { return entries[pos].value; }
+
+  /// Provides the 2nd value of the candidate
+  int value2(int pos) { return entries[pos].value2; }
+
+  /// Number of entries
+  int size() { return entries.size(); }
+
+ protected:
+  struct Entry {
+    uint32_t hash = 0;
+    int value = -1;
+    int value2 = -1;
+    // next entry in the same bucket
+    int next = -1;
+  };
+  Vector<Entry> entries;
+  Vector<int> buckets;
+
+  /// FNV-1a hash
+  uint32_t hash(const char* key, int len = -1) {
+    uint32_t result = 2166136261u;
+    for (int j = 0; key[j] != 0 && (len < 0 || j < len); j++) {
+      result = (result ^ (uint8_t)key[j]) * 16777619u;
+    }
+    return result;
+  }
+
+  /// first entry in the chain with the hash
+  int matching(int pos, uint32_t key_hash) {
+    while (pos >= 0 && entries[pos].hash != key_hash) pos = entries[pos].next;
+    return pos;
+  }
+
+  /// appends the entry to its bucket, so that the chains are sorted by the
+  /// position
+  void link(int pos) {
+    entries[pos].next = -1;
+    int* p_next = &buckets[entries[pos].hash & (buckets.size() - 1)];
+    while (*p_next >= 0) p_next = &entries[*p_next].next;
+    *p_next = pos;
+  }
+
+  /// rebuilds the buckets with the new size (a power of 2)
+  void rebuild(int size) {
+    buckets.resize(size);
+    for (int j = 0; j < size; j++) buckets[j] = -1;
+    for (int j = 0; j < entries.size(); j++) link(j);
+  }
+};
+
+}  // namespace tiny_dlna
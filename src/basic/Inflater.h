@@ -0,0 +1,307 @@
+#pragma once
+#include "Print.h"
+#include "basic/Logger.h"
+#include "basic/Vector.h"
+
+// size of the history window: must be >= the window used for the compression
+#ifndef DLNA_INFLATE_WINDOW_SIZE
+#define DLNA_INFLATE_WINDOW_SIZE 1024
+#endif
+
+namespace tiny_dlna {
+
+/***
+ * @brief Small streaming decoder for deflate (RFC 1951) and gzip (RFC 1952)
+ * data which is available in memory (e.g. in flash). The result is written to
+ * a Print. We only keep a small history window, so the data must have been
+ * compressed with a window size which is not bigger than the window size of
+ * the Inflater (e.g. with zlib wbits = 9 -> 512 bytes).
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class Inflater {
+ public:
+  Inflater(int windowSize = DLNA_INFLATE_WINDOW_SIZE,
+           Allocator& allocator = DefaultAllocator) {
+    window_size = windowSize;
+    window.setAllocator(allocator);
+  }
+
+  /// Decodes gzip data: returns false if the data is not valid
+  bool inflateGzip(const uint8_t* data, int len, Print& out) {
+    // header: ID1 ID2 CM FLG MTIME(4) XFL OS
+    if (len < 18 || data[0] != 0x1f || data[1] != 0x8b || data[2] != 8) {
+      DLNA_LOG(DlnaError, "Inflater: invalid gzip header");
+      return false;
+    }
+    uint8_t flags = data[3];
+    int pos = 10;
+    // FEXTRA
+    if (flags & 4) pos += 2 + (data[pos] | (data[pos + 1] << 8));
+    // FNAME, FCOMMENT
+    for (int flag = 8; flag <= 16; flag <<= 1) {
+      if (flags & flag) {
+        while (pos < len && data[pos] != 0) pos++;
+        pos++;
+      }
+    }
+    // FHCRC
+    if (flags & 2) pos += 2;
+    // trailer: CRC32 ISIZE
+    if (pos > len - 8) return false;
+    return inflate(data + pos, len - pos - 8, out);
+  }
+
+  /// Decodes raw deflate data: returns false if the data is not valid
+  bool inflate(const uint8_t* data, int len, Print& out) {
+    p_in = data;
+    p_in_end = data + len;
+    p_out = &out;
+    bit_buffer = 0;
+    bit_count = 0;
+    window.resize(window_size);
+    window_pos = 0;
+    window_len = 0;
+    is_error = false;
+
+    int last;
+    do {
+      last = bits(1);
+      int type = bits(2);
+      switch (type) {
+        case 0:
+          stored();
+          break;
+        case 1:
+          fixed();
+          break;
+        case 2:
+          dynamic();
+          break;
+        default:
+          is_error = true;
+      }
+    } while (!last && !is_error);
+
+    if (is_error) DLNA_LOG(DlnaError, "Inflater: invalid data");
+    return !is_error;
+  }
+
+ protected:
+  struct Huffman {
+    uint16_t count[16];
+    uint16_t symbol[288];
+  };
+  const uint8_t* p_in = nullptr;
+  const uint8_t* p_in_end = nullptr;
+  Print* p_out = nullptr;
+  uint32_t bit_buffer = 0;
+  int bit_count = 0;
+  Vector<uint8_t> window;
+  int window_size;
+  int window_pos = 0;
+  int window_len = 0;
+  bool is_error = false;
+  Huffman lencode;
+  Huffman distcode;
+
+  int bits(int need) {
+    uint32_t val = bit_buffer;
+    while (bit_count < need) {
+      if (p_in >= p_in_end) {
+        is_error = true;
+        return 0;
+      }
+      val |= (uint32_t)(*p_in++) << bit_count;
+      bit_count += 8;
+    }
+    bit_buffer = val >> need;
+    bit_count -= need;
+    return (int)(val & ((1L << need) - 1));
+  }
+
+  void output(uint8_t byte) {
+    window[window_pos] = byte;
+    window_pos = (window_pos + 1) % window_size;
+    if (window_len < window_size) window_len++;
+    p_out->write(byte);
+  }
+
+  void stored() {
+    // discard the remaining bits of the current byte
+    bit_buffer = 0;
+    bit_count = 0;
+    if (p_in_end - p_in < 4) {
+      is_error = true;
+      return;
+    }
+    int len = p_in[0] | (p_in[1] << 8);
+    int nlen = p_in[2] | (p_in[3] << 8);
+    p_in += 4;
+    if (len != (~nlen & 0xffff) || p_in_end - p_in < len) {
+      is_error = true;
+      return;
+    }
+    while (len--) output(*p_in++);
+  }
+
+  /// builds the canonical huffman table from the code lengths
+  bool build(Huffman& h, const uint8_t* length, int n) {
+    uint16_t offs[16];
+    for (int len = 0; len < 16; len++) h.count[len] = 0;
+    for (int sym = 0; sym < n; sym++) h.count[length[sym]]++;
+    if (h.count[0] == n) return true;
+    int left = 1;
+    for (int len = 1; len < 16; len++) {
+      left <<= 1;
+      left -= h.count[len];
+      // over subscribed
+      if (left < 0) return false;
+    }
+    offs[1] = 0;
+    for (int len = 1; len < 15; len++) offs[len + 1] = offs[len] + h.count[len];
+    for (int sym = 0; sym < n; sym++) {
+      if (length[sym] != 0) h.symbol[offs[length[sym]]++] = sym;
+    }
+    return true;
+  }
+
+  int decode(Huffman& h) {
+    int code = 0, first = 0, index = 0;
+    for (int len = 1; len < 16; len++) {
+      code |= bits(1);
+      if (is_error) return -1;
+      int count = h.count[len];
+      if (code - count < first) return h.symbol[index + (code - first)];
+      index += count;
+      first += count;
+      first <<= 1;
+      code <<= 1;
+    }
+    is_error = true;
+    return -1;
+  }
+
+  void codes() {
+    static const uint16_t length_base[29] = {
+        3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+        31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+    static const uint8_t length_extra[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+                                             1, 1, 2, 2, 2, 2, 3, 3, 3, 3,
+                                             4, 4, 4, 4, 5, 5, 5, 5, 0};
+    static const uint16_t dist_base[30] = {
+        1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+        33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+        1025, 1537, 2049, 3073, 4097, 6145,  8193,  12289, 16385, 24577};
+    static const uint8_t dist_extra[30] = {0, 0, 0, 0, 1, 1, 2,  2,  3,  3,
+                                           4, 4, 5, 5, 6, 6, 7,  7,  8,  8,
+                                           9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+    while (!is_error) {
+      int symbol = decode(lencode);
+      if (symbol < 0) return;
+      if (symbol < 256) {
+        output(symbol);
+      } else if (symbol == 256) {
+        // end of block
+        return;
+      } else {
+        symbol -= 257;
+        if (symbol >= 29) {
+          is_error = true;
+          return;
+        }
+        int len = length_base[symbol] + bits(length_extra[symbol]);
+        symbol = decode(distcode);
+        if (symbol < 0 || symbol >= 30) {
+          is_error = true;
+          return;
+        }
+        int dist = dist_base[symbol] + bits(dist_extra[symbol]);
+        if (dist > window_len) {
+          DLNA_LOG(DlnaError, "Inflater: distance %d > window", dist);
+          is_error = true;
+          return;
+        }
+        while (len--) {
+          int from = (window_pos - dist + window_size) % window_size;
+          output(window[from]);
+        }
+      }
+    }
+  }
+
+  void fixed() {
+    uint8_t lengths[288];
+    int symbol = 0;
+    for (; symbol < 144; symbol++) lengths[symbol] = 8;
+    for (; symbol < 256; symbol++) lengths[symbol] = 9;
+    for (; symbol < 280; symbol++) lengths[symbol] = 7;
+    for (; symbol < 288; symbol++) lengths[symbol] = 8;
+    build(lencode, lengths, 288);
+    for (symbol = 0; symbol < 30; symbol++) lengths[symbol] = 5;
+    build(distcode, lengths, 30);
+    codes();
+  }
+
+  void dynamic() {
+    static const uint8_t order[19] = {16, 17, 18, 0, 8,  7, 9,  6, 10, 5,
+                                      11, 4,  12, 3, 13, 2, 14, 1, 15};
+    uint8_t lengths[320];
+    int nlen = bits(5) + 257;
+    int ndist = bits(5) + 1;
+    int ncode = bits(4) + 4;
+    if (nlen > 286 || ndist > 30) {
+      is_error = true;
+      return;
+    }
+    int index = 0;
+    for (; index < ncode; index++) lengths[order[index]] = bits(3);
+    for (; index < 19; index++) lengths[order[index]] = 0;
+    if (!build(lencode, lengths, 19)) {
+      is_error = true;
+      return;
+    }
+
+    // read the literal/length and distance code lengths
+    index = 0;
+    while (index < nlen + ndist && !is_error) {
+      int symbol = decode(lencode);
+      if (symbol < 0) return;
+      if (symbol < 16) {
+        lengths[index++] = symbol;
+      } else {
+        int len = 0;
+        int repeat;
+        if (symbol == 16) {
+          if (index == 0) {
+            is_error = true;
+            return;
+          }
+          len = lengths[index - 1];
+          repeat = 3 + bits(2);
+        } else if (symbol == 17) {
+          repeat = 3 + bits(3);
+        } else {
+          repeat = 11 + bits(7);
+        }
+        if (index + repeat > nlen + ndist) {
+          is_error = true;
+          return;
+        }
+        while (repeat--) lengths[index++] = len;
+      }
+    }
+    if (is_error || lengths[256] == 0) {
+      is_error = true;
+      return;
+    }
+    if (!build(lencode, lengths, nlen) ||
+        !build(distcode, lengths + nlen, ndist)) {
+      is_error = true;
+      return;
+    }
+    codes();
+  }
+};
+
+}  // namespace tiny_dlna
@@ -0,0 +1,148 @@
+#pragma once
+#include <stddef.h>
+
+namespace tiny_dlna {
+
+/**
+ * @brief Base class for objects which can be stored in an IntrusiveList: the
+ * links are part of the object, so that adding and removing does not need
+ * any memory allocation. An object can be stored in only one list.
+ * @ingroup collections
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ * @tparam T the subclass
+ */
+template <class T>
+struct IntrusiveListItem {
+  T *list_next = nullptr;
+  T *list_prior = nullptr;
+};
+
+/**
+ * @brief Double linked list of objects which are derived from
+ * IntrusiveListItem. The list does not own the objects: it just links them,
+ * and the iteration provides the pointers to the objects.
+ * @ingroup collections
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ * @tparam T
+ */
+template <class T>
+class IntrusiveList {
+ public:
+  class Iterator {
+   public:
+    Iterator(T *obj) { this->obj = obj; }
+    inline Iterator operator++() {
+      obj = obj->list_next;
+      return *this;
+    }
+    inline Iterator operator++(int) { return ++*this; }
+    inline bool operator==(Iterator it) { return obj == it.obj; }
+    inline bool operator!=(Iterator it) { return obj != it.obj; }
+    inline T *operator*() { return obj; }
+
+   protected:
+    T *obj = nullptr;
+  };
+
+  IntrusiveList() = default;
+  IntrusiveList(const IntrusiveList &) = delete;
+  IntrusiveList &operator=(const IntrusiveList &) = delete;
+  ~IntrusiveList() { clear(); }
+
+  /// Adds the object at the end: returns false if it is already linked
+  bool push_back(T *obj) {
+    if (!isUnlinked(obj)) return false;
+    obj->list_prior = last;
+    if (last != nullptr) {
+      last->list_next = obj;
+    } else {
+      first = obj;
+    }
+    last = obj;
+    record_count++;
+    return true;
+  }
+
+  /// Adds the object at the beginning: returns false if it is already linked
+  bool push_front(T *obj) {
+    if (!isUnlinked(obj)) return false;
+    obj->list_next = first;
+    if (first != nullptr) {
+      first->list_prior = obj;
+    } else {
+      last = obj;
+    }
+    first = obj;
+    record_count++;
+    return true;
+  }
+
+  /// Removes the object from the list
+  bool erase(T *obj) {
+    if (!contains(obj)) return false;
+    T *prior = obj->list_prior;
+    T *next = obj->list_next;
+    if (prior != nullptr) {
+      prior->list_next = next;
+    } else {
+      first = next;
+    }
+    if (next != nullptr) {
+      next->list_prior = prior;
+    } else {
+      last = prior;
+    }
+    obj->list_next = nullptr;
+    obj->list_prior = nullptr;
+    record_count--;
+    return true;
+  }
+
+  /// Checks if the object is part of this list
+  bool contains(T *obj) {
+    if (obj == nullptr) return false;
+    for (T *p = first; p != nullptr; p = p->list_next) {
+      if (p == obj) return true;
+    }
+    return false;
+  }
+
+  /// Unlinks all objects
+  void clear() {
+    T *p = first;
+    while (p != nullptr) {
+      T *next = p->list_next;
+      p->list_next = nullptr;
+      p->list_prior = nullptr;
+      p = next;
+    }
+    first = last = nullptr;
+    record_count = 0;
+  }
+
+  Iterator begin() { return Iterator(first); }
+
+  Iterator end() { return Iterator(nullptr); }
+
+  T *front() { return first; }
+
+  T *back() { return last; }
+
+  size_t size() { return record_count; }
+
+  bool empty() { return record_count == 0; }
+
+ protected:
+  T *first = nullptr;
+  T *last = nullptr;
+  size_t record_count = 0;
+
+  bool isUnlinked(T *obj) {
+    return obj != nullptr && obj->list_next == nullptr &&
+           obj->list_prior == nullptr && obj != first;
+  }
+};
+
+}  // namespace tiny_dlna
@@ -9,7 +9,9 @@
 namespace tiny_dlna {
 
 /**
- * @brief Double linked list
+ * @brief Double linked list. Removed nodes can be kept in a pool (see
+ * setPoolSize()), so that adding and removing elements does not need any
+ * memory allocation.
  * @ingroup collections
  * @author Phil Schatzmann
  * @copyright GPLv3
@@ -100,7 +102,10 @@ class List {
     for (int i = 0; i < N; ++i) push_back(a[i]);
   }
 
-  ~List() { clear(); }
+  ~List() {
+    clear();
+    releasePool();
+  }
 
 #ifdef USE_INITIALIZER_LIST
 
@@ -292,6 +297,20 @@ class List {
 
   void setAllocator(Allocator &allocator) { p_allocator = &allocator; }
 
+  /// Keeps up to the indicated number of removed nodes for reuse: the nodes
+  /// for this number of elements are allocated upfront
+  void setPoolSize(size_t size) {
+    pool_max = size;
+    while (record_count + pool_count < pool_max) {
+      Node *node = newNode();
+      if (node == nullptr) break;
+      releaseNode(node);
+    }
+  }
+
+  /// Number of unused nodes in the pool
+  size_t poolCount() { return pool_count; }
+
   /// Provides the last element
   T &back() { return *rbegin(); }
 
@@ -302,22 +321,67 @@ class List {
               // node
   size_t record_count = 0;
   Allocator *p_allocator = &DefaultAllocator;
+  // unused nodes which are linked via next
+  Node *p_pool = nullptr;
+  size_t pool_count = 0;
+  size_t pool_max = 0;
+
+  /// true if we need to use the allocator instead of new and delete
+  bool isAllocator() {
+    return USE_ALLOCATOR || p_allocator != &DefaultAllocator;
+  }
 
   Node *createNode() {
-#if USE_ALLOCATOR
-    Node *node = (Node *)p_allocator->allocate(sizeof(Node));  // new Node();
-#else
-    Node *node = new Node();
-#endif
-    return node;
+    if (p_pool != nullptr) {
+      Node *node = p_pool;
+      p_pool = node->next;
+      pool_count--;
+      node->next = nullptr;
+      return node;
+    }
+    return newNode();
   }
 
   void deleteNode(Node *p_delete) {
-#if USE_ALLOCATOR
-    p_allocator->free(p_delete);  // delete p_delete;
-#else
-    delete p_delete;
-#endif
+    if (pool_count < pool_max) {
+      // release the data (e.g. a client) before we keep the node
+      p_delete->data = T();
+      releaseNode(p_delete);
+      return;
+    }
+    freeNode(p_delete);
+  }
+
+  Node *newNode() {
+    if (isAllocator()) {
+      return p_allocator->create<Node>();  // new Node();
+    }
+    return new Node();
+  }
+
+  void freeNode(Node *p_delete) {
+    if (isAllocator()) {
+      p_allocator->remove(p_delete);  // delete p_delete;
+    } else {
+      delete p_delete;
+    }
+  }
+
+  /// adds the node to the pool
+  void releaseNode(Node *node) {
+    node->prior = nullptr;
+    node->next = p_pool;
+    p_pool = node;
+    pool_count++;
+  }
+
+  void releasePool() {
+    while (p_pool != nullptr) {
+      Node *next = p_pool->next;
+      freeNode(p_pool);
+      p_pool = next;
+    }
+    pool_count = 0;
   }
 
   void link() {
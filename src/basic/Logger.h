@@ -7,6 +7,22 @@
 
 #define DLNA_MAX_LOG_SIZE 800
 
+// lowest log level which is compiled: 0 = Debug, 1 = Info, 2 = Warning,
+// 3 = Error
+#ifndef DLNA_LOG_MIN_LEVEL
+#define DLNA_LOG_MIN_LEVEL 0
+#endif
+
+/// Logs a message: levels below DLNA_LOG_MIN_LEVEL are removed by the
+/// compiler and the arguments are only evaluated if the level is active
+#define DLNA_LOG(level, ...)                                        \
+  do {                                                              \
+    if ((level) >= DLNA_LOG_MIN_LEVEL &&                            \
+        tiny_dlna::DlnaLogger.isLogging(level)) {                   \
+      tiny_dlna::DlnaLogger.log(level, __VA_ARGS__);                \
+    }                                                               \
+  } while (0)
+
 namespace tiny_dlna {
 
 /**
@@ -36,6 +52,11 @@ class LoggerClass {
   // checks if the logging is active
   virtual bool isLogging() { return log_stream_ptr != nullptr; }
 
+  /// checks if messages with the indicated level are written
+  bool isLogging(DlnaLogLevel level) {
+    return level >= log_level && log_stream_ptr != nullptr;
+  }
+
   /// Print log message
   void log(DlnaLogLevel current_level, const char* fmt...) {
     if (current_level >= log_level && log_stream_ptr != nullptr &&
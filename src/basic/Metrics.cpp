@@ -0,0 +1,7 @@
+#include "Metrics.h"
+
+namespace tiny_dlna {
+
+MetricsClass DlnaMetrics;
+
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "Print.h"
+
+namespace tiny_dlna {
+
+/// Counters which are collected by the DlnaMetrics
+enum DlnaCounter {
+  CNT_UDP_RECEIVED,
+  CNT_UDP_FILTERED,
+  CNT_UDP_DROPPED,
+  CNT_MSEARCH_REPLIES,
+  CNT_MSEARCH_DROPPED,
+  CNT_HTTP_REQUESTS,
+  CNT_HTTP_NOT_FOUND,
+  CNT_BYTES_STREAMED,
+  CNT_STREAM_DROPPED,
+  CNT_AUDIO_UNDERRUNS,
+  CNT_COUNT
+};
+
+static const char* dlna_counter_names[] = {
+    "udp_received",    "udp_filtered",  "udp_dropped",
+    "msearch_replies", "msearch_dropped", "http_requests",
+    "http_not_found",  "bytes_streamed",  "stream_clients_dropped",
+    "audio_underruns"};
+
+/// Latency histograms (in ms) which are collected by the DlnaMetrics
+enum DlnaHistogram { HIST_HTTP_REQUEST_MS, HIST_SCHEDULER_LAG_MS, HIST_COUNT };
+
+static const char* dlna_histogram_names[] = {"http_request_ms",
+                                             "scheduler_lag_ms"};
+
+/// Upper limits of the histogram buckets: the last bucket is unlimited
+static const uint32_t dlna_histogram_limits[] = {1,  2,   5,   10,  20,
+                                                 50, 100, 200, 500, 1000};
+static const int dlna_histogram_buckets =
+    sizeof(dlna_histogram_limits) / sizeof(dlna_histogram_limits[0]) + 1;
+
+/**
+ * @brief Counters and fixed bucket latency histograms which are updated by
+ * the UDP services, the Scheduler and the HttpServer. Recording is just an
+ * increment, so it can stay active in release builds. The values are
+ * updated w/o locking: a value that is recorded from another task might get
+ * lost.
+ * @author Phil Schatzmann
+ */
+class MetricsClass {
+ public:
+  /// Increments the counter
+  void add(DlnaCounter counter, uint32_t value = 1) {
+    counters[counter] += value;
+  }
+
+  /// Records a latency in the histogram
+  void record(DlnaHistogram histogram, uint32_t ms) {
+    Histogram& hist = histograms[histogram];
+    int bucket = 0;
+    while (bucket < dlna_histogram_buckets - 1 &&
+           ms > dlna_histogram_limits[bucket]) {
+      bucket++;
+    }
+    hist.buckets[bucket]++;
+    hist.count++;
+    hist.sum += ms;
+    if (ms > hist.max) hist.max = ms;
+  }
+
+  /// Provides the value of a counter
+  uint32_t value(DlnaCounter counter) { return counters[counter]; }
+
+  /// Provides the number of recorded values of a histogram
+  uint32_t count(DlnaHistogram histogram) {
+    return histograms[histogram].count;
+  }
+
+  /// Provides the max recorded value of a histogram
+  uint32_t max(DlnaHistogram histogram) { return histograms[histogram].max; }
+
+  /// Resets all values
+  void clear() {
+    MetricsClass empty;
+    *this = empty;
+  }
+
+  /// Prints the values in the Prometheus text format: each metric is
+  /// preceded by its # TYPE line
+  void printTo(Print& out) {
+    char line[80];
+    for (int j = 0; j < CNT_COUNT; j++) {
+      printType(out, dlna_counter_names[j], "", "counter");
+      snprintf(line, sizeof(line), "dlna_%s %lu", dlna_counter_names[j],
+               (unsigned long)counters[j]);
+      out.println(line);
+    }
+    for (int j = 0; j < HIST_COUNT; j++) {
+      Histogram& hist = histograms[j];
+      const char* name = dlna_histogram_names[j];
+      printType(out, name, "", "histogram");
+      uint32_t total = 0;
+      for (int b = 0; b < dlna_histogram_buckets; b++) {
+        total += hist.buckets[b];
+        if (b < dlna_histogram_buckets - 1) {
+          snprintf(line, sizeof(line), "dlna_%s_bucket{le=\"%lu\"} %lu", name,
+                   (unsigned long)dlna_histogram_limits[b],
+                   (unsigned long)total);
+        } else {
+          snprintf(line, sizeof(line), "dlna_%s_bucket{le=\"+Inf\"} %lu",
+                   name, (unsigned long)total);
+        }
+        out.println(line);
+      }
+      snprintf(line, sizeof(line), "dlna_%s_sum %lu", name,
+               (unsigned long)hist.sum);
+      out.println(line);
+      snprintf(line, sizeof(line), "dlna_%s_count %lu", name,
+               (unsigned long)hist.count);
+      out.println(line);
+      // the max is not part of a histogram: so we report it as gauge
+      printType(out, name, "_max", "gauge");
+      snprintf(line, sizeof(line), "dlna_%s_max %lu", name,
+               (unsigned long)hist.max);
+      out.println(line);
+    }
+  }
+
+  /// Prints the # TYPE line of the metric with the indicated name
+  static void printType(Print& out, const char* name, const char* suffix,
+                        const char* type) {
+    char line[80];
+    snprintf(line, sizeof(line), "# TYPE dlna_%s%s %s", name, suffix, type);
+    out.println(line);
+  }
+
+ protected:
+  struct Histogram {
+    uint32_t buckets[dlna_histogram_buckets] = {0};
+    uint32_t count = 0;
+    uint32_t sum = 0;
+    uint32_t max = 0;
+  };
+  uint32_t counters[CNT_COUNT] = {0};
+  Histogram histograms[HIST_COUNT];
+};
+
+extern MetricsClass DlnaMetrics;
+
+}  // namespace tiny_dlna
@@ -1,16 +1,30 @@
-
 #pragma once
 #include <stdint.h>
 
 #include <atomic>
 #include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "basic/Allocator.h"
+
+#ifndef DLNA_CACHE_LINE_SIZE
+#define DLNA_CACHE_LINE_SIZE 64
+#endif
 
 namespace tiny_dlna {
 
 /**
- * @brief A simple single producer, single consumer lock free queue
+ * @brief A bounded multi producer, multi consumer lock free queue (based on
+ * the algorithm of Dmitry Vyukov). The capacity is rounded up to a power of 2.
+ * Each entry has a sequence number which tells the producers and consumers if
+ * the entry is free or filled, so the only contention is the CAS on the head
+ * or tail counter. With PadCounters = true the head and tail counters are
+ * placed on separate cache lines.
+ * @author Phil Schatzmann
  */
-template <typename T>
+template <typename T, bool PadCounters = false>
 class QueueLockFree {
  public:
   QueueLockFree(size_t capacity, Allocator& allocator = DefaultAllocator) {
@@ -18,96 +32,146 @@ class QueueLockFree {
     resize(capacity);
   }
 
-  ~QueueLockFree() {
-    for (size_t i = head_pos; i != tail_pos; ++i)
-      (&p_node[i & capacity_mask].data)->~T();
+  QueueLockFree(const QueueLockFree&) = delete;
+  QueueLockFree& operator=(const QueueLockFree&) = delete;
 
-    delete[] (char*)p_node;
-  }
+  ~QueueLockFree() { release(); }
 
-  void setAllocator(Allocator& allocator) { vector.setAllocator(allocator); }
+  /// Defines the allocator: call before resize()
+  void setAllocator(Allocator& allocator) { p_allocator = &allocator; }
 
+  /// (Re)allocates the storage: this removes all entries and is not thread
+  /// safe
   void resize(size_t capacity) {
-    capacity_mask = capacity - 1;
-    for (size_t i = 1; i <= sizeof(void*) * 4; i <<= 1)
-      capacity_mask |= capacity_mask >> i;
-    capacity_value = capacity_mask + 1;
-
-    vector.resize(capacity);
-    p_node = vector.data();
-
-    for (size_t i = 0; i < capacity; ++i) {
-      p_node[i].tail.store(i, std::memory_order_relaxed);
-      p_node[i].head.store(-1, std::memory_order_relaxed);
+    release();
+    // we need at least 2 entries
+    size_t new_capacity = 2;
+    while (new_capacity < capacity) new_capacity <<= 1;
+    p_node = (Node*)p_allocator->allocate(sizeof(Node) * new_capacity);
+    if (p_node == nullptr) return;
+    capacity_value = new_capacity;
+    capacity_mask = new_capacity - 1;
+    for (size_t i = 0; i < capacity_value; ++i) {
+      new (&p_node[i].sequence) std::atomic<size_t>(i);
     }
-
-    tail_pos.store(0, std::memory_order_relaxed);
-    head_pos.store(0, std::memory_order_relaxed);
+    tail_pos.value.store(0, std::memory_order_relaxed);
+    head_pos.value.store(0, std::memory_order_relaxed);
   }
 
   size_t capacity() const { return capacity_value; }
 
+  /// Number of entries: this is only a snapshot if the queue is in use
   size_t size() const {
-    size_t head = head_pos.load(std::memory_order_acquire);
-    return tail_pos.load(std::memory_order_relaxed) - head;
+    size_t head = head_pos.value.load(std::memory_order_acquire);
+    return tail_pos.value.load(std::memory_order_relaxed) - head;
   }
 
-  bool enqueue( T&& data) {
-    return enqueue(data);
-  }
+  bool empty() const { return size() == 0; }
+
+  bool enqueue(T& data) { return try_emplace(data); }
+
+  bool enqueue(T&& data) { return try_emplace(std::move(data)); }
 
-  bool enqueue( T& data) {
+  /// Constructs the entry in place: returns false if the queue is full
+  template <class... Args>
+  bool try_emplace(Args&&... args) {
+    if (p_node == nullptr) return false;
     Node* node;
-    size_t tail = tail_pos.load(std::memory_order_relaxed);
+    size_t tail = tail_pos.value.load(std::memory_order_relaxed);
     for (;;) {
       node = &p_node[tail & capacity_mask];
-      if (node->tail.load(std::memory_order_relaxed) != tail) return false;
-      if ((tail_pos.compare_exchange_weak(tail, tail + 1,
-                                          std::memory_order_relaxed)))
-        break;
+      size_t seq = node->sequence.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)tail;
+      if (diff == 0) {
+        if (tail_pos.value.compare_exchange_weak(tail, tail + 1,
+                                                 std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        // full
+        return false;
+      } else {
+        tail = tail_pos.value.load(std::memory_order_relaxed);
+      }
     }
-    new (&node->data) T(data);
-    node->head.store(tail, std::memory_order_release);
+    new (node->data()) T(std::forward<Args>(args)...);
+    node->sequence.store(tail + 1, std::memory_order_release);
     return true;
   }
 
-  bool dequeue(const T&& data) {
-    return dequeue(data);
-  }
-
+  /// Moves the first entry to the result: returns false if the queue is empty
   bool dequeue(T& result) {
+    if (p_node == nullptr) return false;
     Node* node;
-    size_t head = head_pos.load(std::memory_order_relaxed);
+    size_t head = head_pos.value.load(std::memory_order_relaxed);
     for (;;) {
       node = &p_node[head & capacity_mask];
-      if (node->head.load(std::memory_order_relaxed) != head) return false;
-      if (head_pos.compare_exchange_weak(head, head + 1,
-                                         std::memory_order_relaxed))
-        break;
+      size_t seq = node->sequence.load(std::memory_order_acquire);
+      intptr_t diff = (intptr_t)seq - (intptr_t)(head + 1);
+      if (diff == 0) {
+        if (head_pos.value.compare_exchange_weak(head, head + 1,
+                                                 std::memory_order_relaxed))
+          break;
+      } else if (diff < 0) {
+        // empty
+        return false;
+      } else {
+        head = head_pos.value.load(std::memory_order_relaxed);
+      }
     }
-    result = node->data;
-    (&node->data)->~T();
-    node->tail.store(head + capacity_value, std::memory_order_release);
+    T* data = node->data();
+    result = std::move(*data);
+    data->~T();
+    node->sequence.store(head + capacity_value, std::memory_order_release);
     return true;
   }
 
+  /// Moves up to maxCount entries to the result: returns the number of entries
+  size_t dequeue(T* result, size_t maxCount) {
+    size_t count = 0;
+    while (count < maxCount && dequeue(result[count])) count++;
+    return count;
+  }
+
+  /// Removes all entries
   void clear() {
+    if (p_node == nullptr) return;
     T tmp;
     while (dequeue(tmp));
   }
 
  protected:
   struct Node {
-    T data;
-    std::atomic<size_t> tail;
-    std::atomic<size_t> head;
+    std::atomic<size_t> sequence;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+    T* data() { return reinterpret_cast<T*>(&storage); }
   };
 
-  Node* p_node;
-  size_t capacity_mask;
-  size_t capacity_value;
-  std::atomic<size_t> tail_pos;
-  std::atomic<size_t> head_pos;
-  Vector<Node> vector;
+  /// atomic counter which can be placed on its own cache line
+  template <bool Pad, int Dummy = 0>
+  struct Counter {
+    std::atomic<size_t> value{0};
+  };
+  template <int Dummy>
+  struct Counter<true, Dummy> {
+    std::atomic<size_t> value{0};
+    char padding[DLNA_CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+  };
+
+  Allocator* p_allocator = &DefaultAllocator;
+  Node* p_node = nullptr;
+  size_t capacity_mask = 0;
+  size_t capacity_value = 0;
+  Counter<PadCounters> tail_pos;
+  Counter<PadCounters> head_pos;
+
+  void release() {
+    if (p_node == nullptr) return;
+    clear();
+    p_allocator->free(p_node);
+    p_node = nullptr;
+    capacity_value = 0;
+    capacity_mask = 0;
+  }
 };
-}  // namespace audio_tools
\ No newline at end of file
+
+}  // namespace tiny_dlna
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string.h>
+
 #include "Vector.h"
 #include "stddef.h"
 #include "stdint.h"
@@ -40,14 +42,16 @@ class RingBuffer {
   }
 
   int read(uint8_t *str, int len) {
-    for (int j = 0; j < len; j++) {
-      int current = read();
-      if (current == 0) {
-        return j - 1;
-      }
-      str[j] = current;
+    int result = 0;
+    while (result < len && actual_len > 0) {
+      int n = 0;
+      char *data = readPtr(n);
+      if (n > len - result) n = len - result;
+      memcpy(str + result, data, n);
+      advanceRead(n);
+      result += n;
     }
-    return len;
+    return result;
   }
 
   // peeks the actual character
@@ -68,21 +72,116 @@ class RingBuffer {
       if (actual_write_pos >= max_len) {
         actual_write_pos = 0;
       }
+      result = 1;
     }
     return result;
   }
 
   size_t write(uint8_t *str, int len) {
-    for (int j = 0; j < len; j++) {
-      int result = write(str[j]);
-      if (result == 0) {
-        return j;
-      }
+    int result = 0;
+    while (result < len) {
+      int n = 0;
+      char *data = writePtr(n);
+      if (n == 0) break;
+      if (n > len - result) n = len - result;
+      memcpy(data, str + result, n);
+      advanceWrite(n);
+      result += n;
+    }
+    return result;
+  }
+
+  /// Writes the data and removes the oldest data if there is not enough
+  /// space: so we keep the last size() bytes
+  size_t writeOverwrite(uint8_t *str, int len) {
+    if (max_len <= 0) return 0;
+    if (len > max_len) {
+      str += len - max_len;
+      len = max_len;
+    }
+    int free = availableToWrite();
+    if (len > free) advanceRead(len - free);
+    return write(str, len);
+  }
+
+  /// Provides the position of the character relative to the read position
+  /// (starting the search at the indicated offset) or -1 if it is not found
+  int indexOf(char ch, int from = 0) {
+    if (from < 0) from = 0;
+    // positions without wrapping: [start, end)
+    int start = actual_read_pos + from;
+    int end = actual_read_pos + actual_len;
+    while (start < end) {
+      int seg_end = start < max_len ? (end < max_len ? end : max_len) : end;
+      int offset = start < max_len ? 0 : max_len;
+      char *data = buffer.data() + start - offset;
+      char *pos = (char *)memchr(data, ch, seg_end - start);
+      if (pos != nullptr) return start + (pos - data) - actual_read_pos;
+      start = seg_end;
     }
-    return len;
+    return -1;
   }
 
-  void resize(int size) { buffer.resize(size); }
+  /// Provides the start of the data which can be read without wrapping and
+  /// its length: call advanceRead() after processing it
+  char *readPtr(int &len) { return peekPtr(0, len); }
+
+  /// Provides the data at the offset (relative to the read position) which
+  /// can be read without wrapping and its length: the data is not removed
+  char *peekPtr(int offset, int &len) {
+    if (offset >= actual_len) {
+      len = 0;
+      return buffer.data();
+    }
+    int pos = (actual_read_pos + offset) % max_len;
+    int linear = max_len - pos;
+    int remaining = actual_len - offset;
+    len = remaining < linear ? remaining : linear;
+    return buffer.data() + pos;
+  }
+
+  /// Removes the indicated number of characters
+  void advanceRead(int len) {
+    if (len > actual_len) len = actual_len;
+    actual_read_pos = (actual_read_pos + len) % max_len;
+    actual_len -= len;
+    // restart at the beginning to provide big linear areas
+    if (actual_len == 0) {
+      actual_read_pos = 0;
+      actual_write_pos = 0;
+    }
+  }
+
+  /// Provides the free space which can be written without wrapping and its
+  /// length: call advanceWrite() after filling it
+  char *writePtr(int &len) {
+    int linear = max_len - actual_write_pos;
+    int free = max_len - actual_len;
+    len = free < linear ? free : linear;
+    return buffer.data() + actual_write_pos;
+  }
+
+  /// Marks the indicated number of characters as written
+  void advanceWrite(int len) {
+    actual_write_pos = (actual_write_pos + len) % max_len;
+    actual_len += len;
+  }
+
+  /// Removes all data
+  void clear() {
+    actual_len = 0;
+    actual_read_pos = 0;
+    actual_write_pos = 0;
+  }
+
+  /// Provides the capacity
+  int size() { return max_len; }
+
+  void resize(int size) {
+    max_len = size;
+    buffer.resize(size);
+    clear();
+  }
 
  protected:
   Vector<char> buffer{0};
@@ -1,8 +1,19 @@
 #pragma once
 
+#include "Logger.h"
 #include "StrView.h"
 #include "Vector.h"
 
+// size of the inline buffer which is used for short strings
+#ifndef DLNA_STR_INLINE_SIZE
+#define DLNA_STR_INLINE_SIZE 48
+#endif
+
+// max supported string length (e.g. for a device xml in a StrPrint)
+#ifndef DLNA_STR_MAX_LEN
+#define DLNA_STR_MAX_LEN (1024 * 64)
+#endif
+
 namespace tiny_dlna {
 
 /**
@@ -15,6 +26,8 @@ namespace tiny_dlna {
  * if we need to process an unexpected size.
  *
  * We also need to use this if we want to manage a vecor of strings.
+ * Short strings (< DLNA_STR_INLINE_SIZE) are kept in an inline buffer, so
+ * they do not need any heap allocation.
  * @author Phil Schatzmann
  * @copyright GPLv3
  */
@@ -27,6 +40,8 @@ class Str : public StrView {
     maxlen = initialAllocatedLength;
     is_const = false;
     grow(maxlen);
+    // the string is empty
+    if (chars != nullptr) chars[0] = 0;
   }
 
   Str(const char *str) : Str() {
@@ -44,7 +59,7 @@ class Str : public StrView {
   Str(StrView &source) : Str() { set(source); }
 
   /// Copy constructor
-  Str(Str &source) : Str() { set(source); }
+  Str(Str &source) : Str() { copy(source); }
 
   /// Move constructor
   Str(Str &&obj) { move(obj); }
@@ -62,8 +77,7 @@ class Str : public StrView {
 
   /// Copy assingment
   Str &operator=(Str &obj) {
-    //assert(&obj!=nullptr);
-    set(obj.c_str());
+    copy(obj);
     return *this;
   };
 
@@ -81,6 +95,9 @@ class Str : public StrView {
 
   size_t capacity() { return maxlen; }
 
+  /// Defines the allocator: call this before any memory has been allocated
+  void setAllocator(Allocator &allocator) { vector.setAllocator(allocator); }
+
   void setCapacity(size_t newLen) { grow(newLen); }
 
   // make sure that the max size is allocated
@@ -92,8 +109,8 @@ class Str : public StrView {
 
   /// assigns a memory buffer
   void copyFrom(const char *source, int len, int maxlen = 0) {
-    this->maxlen = maxlen == 0 ? len : maxlen;
-    resize(this->maxlen);
+    grow(maxlen == 0 ? len : maxlen);
+    if (len > this->maxlen) len = this->maxlen;
     if (this->chars != nullptr) {
       this->len = len;
       this->is_const = false;
@@ -102,6 +119,18 @@ class Str : public StrView {
     }
   }
 
+  /// appends len bytes of the data
+  void append(const char *data, int len) {
+    if (data == nullptr || len <= 0) return;
+    grow(this->len + len);
+    if (this->len + len > this->maxlen) len = this->maxlen - this->len;
+    if (this->chars != nullptr && len > 0) {
+      memcpy(this->chars + this->len, data, len);
+      this->len += len;
+      this->chars[this->len] = 0;
+    }
+  }
+
   /// Fills the string with len chars
   void setChars(char c, int len) {
     grow(this->maxlen);
@@ -169,32 +198,57 @@ class Str : public StrView {
   }
 
   void resize(int size) {
-    vector.resize(size+1);
-    maxlen = size;
+    grow(size);
     len = size;
-    chars = vector.data();
   }
 
   void swap(Str &other){
+    bool is_inline = isInline();
+    bool other_inline = other.isInline();
+    bool is_null = chars == nullptr;
+    bool other_null = other.chars == nullptr;
+    char tmp[DLNA_STR_INLINE_SIZE];
+    memcpy(tmp, buffer, DLNA_STR_INLINE_SIZE);
+    memcpy(buffer, other.buffer, DLNA_STR_INLINE_SIZE);
+    memcpy(other.buffer, tmp, DLNA_STR_INLINE_SIZE);
     int tmp_len = len;
     int tmp_maxlen = maxlen;
     len = other.len;
     maxlen = other.maxlen;
+    other.len = tmp_len;
+    other.maxlen = tmp_maxlen;
     vector.swap(other.vector);
-    chars = vector.data();
-    other.chars = other.vector.data();
+    chars = other_null ? nullptr : other_inline ? buffer : vector.data();
+    other.chars =
+        is_null ? nullptr : is_inline ? other.buffer : other.vector.data();
   }
 
-  const char* c_str() { return vector.data(); }
+  const char* c_str() { return chars; }
 
   // just sets the len to 0
   void reset() {
-    memset(vector.data(),0, len);
+    if (chars != nullptr) memset(chars, 0, len);
     len = 0;
   }
 
+  /// true if the string is stored in the inline buffer
+  bool isInline() { return chars == buffer; }
+
  protected:
   Vector<char> vector;
+  char buffer[DLNA_STR_INLINE_SIZE];
+
+  /// copies the content with the known length: no strlen() is needed and
+  /// short strings end up in the inline buffer
+  void copy(Str &source) {
+    if (&source == this) return;
+    grow(source.len);
+    if (chars == nullptr) return;
+    if (source.len > 0) memcpy(chars, source.chars, source.len);
+    len = source.len;
+    chars[len] = 0;
+    is_const = false;
+  }
 
   Str& move(Str &other) {
     swap(other);
@@ -204,16 +258,31 @@ class Str : public StrView {
 
   bool grow(int newMaxLen) override {
     bool grown = false;
-    assert(newMaxLen < 1024 * 10);
     if (newMaxLen < 0) return false;
+    // the size might come from a remote system: so we do not assert
+    if (newMaxLen >= DLNA_STR_MAX_LEN) {
+      DLNA_LOG(DlnaError, "Str: %d exceeds DLNA_STR_MAX_LEN", newMaxLen);
+      newMaxLen = DLNA_STR_MAX_LEN - 1;
+    }
 
     if (chars == nullptr || newMaxLen > maxlen) {
       grown = true;
       // we use at minimum the defined maxlen
       int newSize = newMaxLen > maxlen ? newMaxLen : maxlen;
-      vector.resize(newSize + 1);
-      chars = &vector[0];
-      maxlen = newSize;
+      bool is_new = chars == nullptr;
+      if (newSize < DLNA_STR_INLINE_SIZE && vector.size() == 0) {
+        // short strings are kept in the inline buffer
+        chars = buffer;
+        maxlen = DLNA_STR_INLINE_SIZE - 1;
+      } else {
+        vector.resize(newSize + 1);
+        // the inline content moves to the heap
+        if (isInline()) memcpy(vector.data(), buffer, len + 1);
+        chars = vector.data();
+        maxlen = newSize;
+      }
+      // new T[] does not initialize the memory
+      if (is_new) chars[len] = 0;
     }
     return grown;
   }
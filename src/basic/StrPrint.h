@@ -1,41 +1,68 @@
+#pragma once
 #include "Print.h"
 #include "Str.h"
 
 namespace tiny_dlna {
 
 /***
- * @brief Print to a dynamic string
+ * @brief Print to a dynamic string. The capacity grows geometrically (but at
+ * least by incSize), so that big documents only need a few reallocations.
+ * If the size is known in advance (e.g. from the Content-Length) call
+ * reserve(). The length is limited to DLNA_STR_MAX_LEN: the data which is
+ * not fitting is not written.
  * @author Phil Schatzmann
  * @copyright GPLv3
  */
 class StrPrint : public Print {
  public:
   StrPrint(int incSize = 200) { inc_size = incSize; }
-  size_t write(uint8_t ch) override {
-    if (str.length() >= str.capacity() - 1) {
-      str.setCapacity(str.length() + inc_size);
-    }
-    str.add((const char)ch);
-    return 1;
-  }
+
+  size_t write(uint8_t ch) override { return write(&ch, 1); }
 
   size_t write(const uint8_t* buffer, size_t size) override {
-    size_t result = 0;
-    for (int j = 0; j < size; j++) {
-      result += write(buffer[j]);
+    size_t available = maxLength() - str.length();
+    if (size > available) {
+      DLNA_LOG(DlnaError, "StrPrint: DLNA_STR_MAX_LEN exceeded");
+      size = available;
     }
-    return result;
+    grow(str.length() + size);
+    str.append((const char*)buffer, size);
+    return size;
+  }
+
+  /// Makes sure that we can store the indicated number of chars w/o any
+  /// reallocation: returns false if this exceeds the max length
+  bool reserve(size_t size) {
+    if (size > maxLength()) return false;
+    if (size > str.capacity()) str.setCapacity(size);
+    return true;
   }
 
+  /// Max number of chars which can be stored
+  static size_t maxLength() { return DLNA_STR_MAX_LEN - 1; }
+
   const char* c_str() { return str.c_str(); }
 
   size_t length() { return str.length(); }
 
+  size_t capacity() { return str.capacity(); }
+
   void reset() { str.reset(); }
 
  protected:
   Str str{200};
   int inc_size;
+
+  /// doubles the capacity if the size is not fitting
+  void grow(size_t size) {
+    size_t capacity = str.capacity();
+    if (size <= capacity) return;
+    size_t new_capacity = capacity * 2;
+    if (new_capacity < capacity + inc_size) new_capacity = capacity + inc_size;
+    if (new_capacity < size) new_capacity = size;
+    if (new_capacity > maxLength()) new_capacity = maxLength();
+    str.setCapacity(new_capacity);
+  }
 };
 
-}  // namespace tiny_dlna
\ No newline at end of file
+}  // namespace tiny_dlna
@@ -69,9 +69,10 @@ class StrView {
     if (this->isConst()) {
       /// if the StrView is a const we replace the pointer
       this->chars = alt.chars;
-    } else {
-      /// if the StrView is an external buffer we need to copy
-      strncpy(this->chars, alt.chars, this->maxlen);
+    } else if (this->chars != nullptr) {
+      /// if the StrView is an external buffer we need to copy: an empty Str
+      /// might not have any buffer yet
+      if (alt.chars != nullptr) strncpy(this->chars, alt.chars, this->maxlen);
       this->chars[len] = 0;
     }
   }
@@ -192,68 +193,26 @@ class StrView {
   /// file matching supporting * and ? - replacing regex which is not supported
   /// in all environments
   virtual bool matches(const char* pattern) {
-    /// returns 1 (true) if there is a match
-    /// returns 0 if the pattern is not whitin the line
-    int wildcard = 0;
-    const char* line = this->chars;
-
-    const char* last_pattern_start = 0;
-    const char* last_line_start = 0;
-    do {
-      if (*pattern == *line) {
-        if (wildcard == 1) last_line_start = line + 1;
-
-        line++;
+    const char* line = this->chars == nullptr ? "" : this->chars;
+    const char* last_star = nullptr;
+    const char* last_line_start = nullptr;
+    while (*line) {
+      if (*pattern == '*') {
+        // remember the position to retry with a longer match of *
+        last_star = pattern++;
+        last_line_start = line;
+      } else if (*pattern == '?' || *pattern == *line) {
         pattern++;
-        wildcard = 0;
-      } else if (*pattern == '?') {
-        if (*(line) == '\0')  /// the line is ended but char was expected
-          return 0;
-        if (wildcard == 1) last_line_start = line + 1;
         line++;
-        pattern++;
-        wildcard = 0;
-      } else if (*pattern == '*') {
-        if (*(pattern + 1) == '\0') {
-          return 1;
-        }
-
-        last_pattern_start = pattern;
-        // last_line_start = line + 1;
-        wildcard = 1;
-
-        pattern++;
-      } else if (wildcard) {
-        if (*line == *pattern) {
-          wildcard = 0;
-          line++;
-          pattern++;
-          last_line_start = line + 1;
-        } else {
-          line++;
-        }
+      } else if (last_star != nullptr) {
+        pattern = last_star + 1;
+        line = ++last_line_start;
       } else {
-        if ((*pattern) == '\0' && (*line) == '\0')  /// end of mask
-          return 1;  /// if the line also ends here then the pattern match
-        else {
-          if (last_pattern_start != 0)  /// try to restart the mask on the rest
-          {
-            pattern = last_pattern_start;
-            line = last_line_start;
-            last_line_start = 0;
-          } else {
-            return false;
-          }
-        }
+        return false;
       }
-
-    } while (*line);
-
-    if (*pattern == '\0') {
-      return true;
-    } else {
-      return false;
     }
+    while (*pattern == '*') pattern++;
+    return *pattern == '\0';
   }
 
   /// provides the position of the the indicated character after the indicated
@@ -0,0 +1,218 @@
+#pragma once
+#include "Client.h"
+#include "Print.h"
+#include "Stream.h"
+#include "basic/Logger.h"
+#include "basic/Vector.h"
+
+// size of the copied blocks: bigger than the TCP MSS, so that a BufferedPrint
+// passes them on directly
+#ifndef DLNA_STREAM_BLOCK_SIZE
+#define DLNA_STREAM_BLOCK_SIZE 2048
+#endif
+
+// max time in ms without any progress in reading or writing
+#ifndef DLNA_STREAM_TIMEOUT
+#define DLNA_STREAM_TIMEOUT 2000
+#endif
+
+namespace tiny_dlna {
+
+/***
+ * @brief Copies the data from a Stream to a Print in blocks: short writes are
+ * retried and we only write as much as the output reports as
+ * availableForWrite() (if supported). With double buffering the next block is
+ * read from the source while the output is not able to accept the pending
+ * data, so that reading and writing overlap.
+ * If the size is not known, a source w/o available data is retried: the copy
+ * ends when a Client source has been closed or when no data has arrived
+ * within the timeout. So provide the size if it is known.
+ * @author Phil Schatzmann
+ * @copyright GPLv3
+ */
+class StreamCopy {
+ public:
+  StreamCopy(int blockSize = DLNA_STREAM_BLOCK_SIZE) {
+    setBlockSize(blockSize);
+  }
+
+  /// Defines the size of the copied blocks
+  void setBlockSize(int size) {
+    block_size = size;
+    release();
+  }
+
+  /// Activates the double buffering (which needs 2 blocks)
+  void setDoubleBuffer(bool active) {
+    is_double_buffer = active;
+    release();
+  }
+
+  /// Defines the max time in ms without progress
+  void setTimeout(uint32_t ms) { timeout = ms; }
+
+  /// Copies size bytes from the client (or all data until it is closed if
+  /// size is 0): returns the number of copied bytes
+  size_t copy(Client& in, Print& out, size_t size = 0) {
+    p_client = &in;
+    size_t result = copy((Stream&)in, out, size);
+    p_client = nullptr;
+    return result;
+  }
+
+  /// Copies size bytes (or all data up to the timeout if size is 0): returns
+  /// the number of copied bytes
+  size_t copy(Stream& in, Print& out, size_t size = 0) {
+    int block_count = is_double_buffer ? 2 : 1;
+    buffer.resize(block_size * block_count);
+    for (int j = 0; j < 2; j++) {
+      blocks[j].len = 0;
+      blocks[j].pos = 0;
+    }
+    uint32_t start = millis();
+    uint32_t last_progress = start;
+    size_t read_total = 0;
+    size_t written = 0;
+    int write_idx = 0;
+    int read_idx = 0;
+
+    while (true) {
+      bool progress = false;
+      bool is_source_open = size == 0 || read_total < size;
+
+      // fill the free blocks
+      Block& rb = blocks[read_idx];
+      if (rb.len == 0 && is_source_open) {
+        int n = readBlock(in, rb, read_idx, size == 0 ? 0 : size - read_total);
+        if (n > 0) {
+          read_total += n;
+          read_idx = (read_idx + 1) % block_count;
+          progress = true;
+        } else if (size == 0 && p_client != nullptr && !p_client->connected()) {
+          // no more data will arrive
+          is_source_open = false;
+        }
+      }
+
+      // write the pending block
+      Block& wb = blocks[write_idx];
+      if (wb.len > 0) {
+        int n = writeBlock(out, wb, write_idx);
+        if (n > 0) {
+          written += n;
+          progress = true;
+          if (wb.pos == wb.len) {
+            wb.len = 0;
+            wb.pos = 0;
+            write_idx = (write_idx + 1) % block_count;
+          }
+        }
+      }
+
+      bool is_pending = blocks[0].len > 0 || blocks[1].len > 0;
+      if (!is_pending && !is_source_open) break;
+      if (progress) {
+        last_progress = millis();
+      } else if (millis() - last_progress > timeout) {
+        // w/o size the end of the data is only known by the timeout
+        if (size == 0 && !is_pending) {
+          DLNA_LOG(DlnaInfo, "StreamCopy: end of data after %d bytes",
+                   (int)written);
+        } else {
+          DLNA_LOG(DlnaError, "StreamCopy: timeout after %d bytes",
+                   (int)written);
+        }
+        break;
+      } else {
+        delay(1);
+      }
+    }
+
+    // update the statistics
+    last_bytes = written;
+    last_duration = millis() - start;
+    total_bytes += written;
+    total_duration += last_duration;
+    return written;
+  }
+
+  /// Number of bytes of the last copy
+  size_t bytesCopied() { return last_bytes; }
+
+  /// Duration in ms of the last copy
+  uint32_t durationMs() { return last_duration; }
+
+  /// Throughput of the last copy in bytes per second
+  uint32_t bytesPerSecond() { return throughput(last_bytes, last_duration); }
+
+  /// Number of bytes of all copies
+  uint64_t totalBytes() { return total_bytes; }
+
+  /// Throughput of all copies in bytes per second
+  uint32_t totalBytesPerSecond() {
+    return throughput(total_bytes, total_duration);
+  }
+
+  /// Number of writes which did not accept all data
+  uint32_t shortWrites() { return short_writes; }
+
+  /// Resets the statistics
+  void resetStatistics() {
+    last_bytes = 0;
+    last_duration = 0;
+    total_bytes = 0;
+    total_duration = 0;
+    short_writes = 0;
+  }
+
+  /// Releases the allocated memory
+  void release() { buffer.reset(); }
+
+ protected:
+  struct Block {
+    int len = 0;
+    int pos = 0;
+  };
+  Vector<uint8_t> buffer;
+  Block blocks[2];
+  // source of copy(Client&...): to detect the end of the data
+  Client* p_client = nullptr;
+  int block_size = DLNA_STREAM_BLOCK_SIZE;
+  bool is_double_buffer = false;
+  uint32_t timeout = DLNA_STREAM_TIMEOUT;
+  size_t last_bytes = 0;
+  uint32_t last_duration = 0;
+  uint64_t total_bytes = 0;
+  uint64_t total_duration = 0;
+  uint32_t short_writes = 0;
+
+  /// reads the available data (up to max bytes if max is not 0)
+  int readBlock(Stream& in, Block& block, int idx, size_t max) {
+    int n = in.available();
+    if (n <= 0) return 0;
+    if (n > block_size) n = block_size;
+    if (max > 0 && (size_t)n > max) n = max;
+    block.len = in.readBytes(buffer.data() + idx * block_size, n);
+    block.pos = 0;
+    return block.len;
+  }
+
+  /// writes the pending data of the block as far as the output accepts it
+  int writeBlock(Print& out, Block& block, int idx) {
+    int n = block.len - block.pos;
+    // a value of 0 means that it is not supported
+    int space = out.availableForWrite();
+    if (space > 0 && space < n) n = space;
+    int result = out.write(buffer.data() + idx * block_size + block.pos, n);
+    if (result < 0) result = 0;
+    if (result < block.len - block.pos) short_writes++;
+    block.pos += result;
+    return result;
+  }
+
+  uint32_t throughput(uint64_t bytes, uint64_t ms) {
+    return ms == 0 ? 0 : bytes * 1000 / ms;
+  }
+};
+
+}  // namespace tiny_dlna
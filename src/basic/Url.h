@@ -1,111 +1,152 @@
 #pragma once
 
-#include "basic/Str.h"
+#include <IPAddress.h>
+#include <ctype.h>
+
 #include "basic/Logger.h"
+#include "basic/Str.h"
+#include "basic/Vector.h"
 
 namespace tiny_dlna {
 
 /**
  * @brief URL parser which breaks a full url string up into its individual parts
- * 
+ *
  * http://pschatzmann.ch:80/path1/path2
  * -> protocol: http
  * -> host: pschatzmann.ch
  * -> port: 80
  * -> url: http://pschatzmann.ch:80/path1/path2
  * -> root: http://pschatzmann.ch:80
+ *
+ * The url is parsed in one pass and the parts are stored as null terminated
+ * strings in one buffer, so the accessors only need to return a pointer. If
+ * the host is an IP address it is provided as IPAddress, so that we do not
+ * need a DNS lookup.
  */
 class Url {
     public:
         // empty url
         Url() {
-            DlnaLogger.log(DlnaDebug,"Url");
+            DLNA_LOG(DlnaDebug,"Url");
         }
-        
+
         ~Url() {
-            DlnaLogger.log(DlnaDebug,"~Url");
-            pathStr.clear();
-            hostStr.clear();
-            protocolStr.clear();
-            urlRootStr.clear();
-            urlStr.clear();
+            DLNA_LOG(DlnaDebug,"~Url");
         }
 
         // setup url with string
         Url(const char *url){
-            DlnaLogger.log(DlnaDebug,"Url %s",url);
+            DLNA_LOG(DlnaDebug,"Url %s",url);
             setUrl(url);
         }
 
         // copy constructor
         Url(Url &url){
-            DlnaLogger.log(DlnaDebug,"Url %s",url.url());
+            DLNA_LOG(DlnaDebug,"Url %s",url.url());
             setUrl(url.url());
         }
 
-        const char* url() {return urlStr.c_str();}
-        const char* path() { return pathStr.c_str(); }
-        const char* host() { return hostStr.c_str();}
-        const char* protocol() {return protocolStr.c_str();}
-        const char* urlRoot() {return urlRootStr.c_str();} // prefix w/o path -> https://host:port
+        Url(Url &&url) = default;
+        Url &operator=(Url &url) = default;
+        Url &operator=(Url &&url) = default;
+
+        const char* url() {return part(0);}
+        const char* path() {
+            if (path_pos >= 0) return part(path_pos);
+            // an url w/o path refers to the root
+            return host_pos < 0 ? "" : "/";
+        }
+        const char* host() { return part(host_pos);}
+        const char* protocol() {return part(protocol_pos);}
+        const char* urlRoot() {return part(root_pos);} // prefix w/o path -> https://host:port
         int port() {return portInt;}
+        /// address of the host if it is an IP address (otherwise 0.0.0.0)
+        IPAddress& address() { return addressIP; }
+        /// true if the host is an IP address, so we can connect w/o DNS lookup
+        bool hasAddress() { return has_address; }
 
         void setUrl(const char* url){
-            DlnaLogger.log(DlnaDebug,"setUrl %s",url);
-            this->urlStr = url;
-            parse();
+            DLNA_LOG(DlnaDebug,"setUrl %s",url);
+            parse(url == nullptr ? "" : url);
         }
 
-        operator bool() { return !urlStr.isEmpty();}
- 
+        operator bool() { return *url() != 0;}
+
     protected:
-        Str pathStr = Str(40);
-        Str hostStr = Str(20);
-        Str protocolStr = Str(6);
-        Str urlRootStr = Str(40);
-        Str urlStr = Str(40);
-        int portInt;
-
-        void parse() {
-            DlnaLogger.log(DlnaDebug,"Url::parse");
-            
-            int protocolEnd = urlStr.indexOf("://");
-            if (protocolEnd==-1){
+        // url\0protocol\0host\0root\0
+        Vector<char> parts;
+        int protocol_pos = -1;
+        int host_pos = -1;
+        int root_pos = -1;
+        // position of the path in the url or -1 if the url has no path
+        int path_pos = -1;
+        int portInt = -1;
+        IPAddress addressIP;
+        bool has_address = false;
+
+        const char* part(int pos) {
+            return pos < 0 || parts.size() == 0 ? "" : parts.data() + pos;
+        }
+
+        void parse(const char* url) {
+            DLNA_LOG(DlnaDebug,"Url::parse");
+            protocol_pos = host_pos = root_pos = path_pos = -1;
+            portInt = -1;
+            addressIP = IPAddress();
+            has_address = false;
+
+            // the path is trimmed
+            int len = strlen(url);
+            while (len > 0 && isspace(url[len - 1])) len--;
+            const char* protocol_end = strstr(url, "://");
+            if (protocol_end == nullptr || protocol_end - url >= len) {
+                copyPart(url, len, 0);
                 return;
             }
-            protocolStr.substring(urlStr, 0,protocolEnd);
-            int portStart = urlStr.indexOf(":",protocolEnd+3);            
-            int hostEnd = portStart!=-1 ? portStart : urlStr.indexOf("/",protocolEnd+4);
-            // we have not path -> so then host end is the end of string
-            if (hostEnd==-1){
-                hostEnd = urlStr.length();                
-            }
-            hostStr.substring(urlStr, protocolEnd+3,hostEnd);
-            if (portStart>0){
-                portInt = atoi(urlStr.c_str()+portStart+1);
-            } else {
-                if (protocolStr.startsWith("https"))
-                    portInt = 443;
-                else if (protocolStr.startsWith("http"))
-                    portInt = 80;
-                else if (protocolStr.startsWith("ftp"))
-                    portInt = 21;
-                else 
-                    portInt = -1; // undefined
+
+            int protocol_len = protocol_end - url;
+            int host_start = protocol_len + 3;
+            int host_end = host_start;
+            while (host_end < len && url[host_end] != ':' && url[host_end] != '/') {
+                host_end++;
             }
-            int pathStart = urlStr.indexOf("/",protocolEnd+4);
-            if (pathStart==0){
-                // we have no path
-                pathStr = "/";
-                urlRootStr = urlStr;
-            } else {
-                pathStr.substring(urlStr, pathStart, urlStr.length());
-                pathStr.trim();
-                urlRootStr.substring(urlStr, 0, pathStart);
+            int path_start = host_end;
+            if (host_end < len && url[host_end] == ':') {
+                portInt = atoi(url + host_end + 1);
+                while (path_start < len && url[path_start] != '/') path_start++;
+            } else if (strncmp(url, "https", 5) == 0) {
+                portInt = 443;
+            } else if (strncmp(url, "http", 4) == 0) {
+                portInt = 80;
+            } else if (strncmp(url, "ftp", 3) == 0) {
+                portInt = 21;
             }
-            DlnaLogger.log(DlnaDebug,"url-> %s",url());
-            DlnaLogger.log(DlnaDebug,"path-> %s",path());
-           
+
+            // copy the parts
+            int host_len = host_end - host_start;
+            parts.resize(len + 1 + protocol_len + 1 + host_len + 1 + path_start + 1);
+            int pos = copyPart(url, len, 0);
+            protocol_pos = pos;
+            pos = copyPart(url, protocol_len, pos);
+            host_pos = pos;
+            pos = copyPart(url + host_start, host_len, pos);
+            root_pos = pos;
+            copyPart(url, path_start, pos);
+            // otherwise we have no path
+            if (path_start < len) path_pos = path_start;
+
+            has_address = addressIP.fromString(host());
+            DLNA_LOG(DlnaDebug,"url-> %s",this->url());
+            DLNA_LOG(DlnaDebug,"path-> %s",path());
+        }
+
+        /// copies the string with a terminating 0: returns the next position
+        int copyPart(const char* str, int len, int pos) {
+            if (parts.size() < pos + len + 1) parts.resize(pos + len + 1);
+            memcpy(parts.data() + pos, str, len);
+            parts[pos + len] = 0;
+            return pos + len + 1;
         }
 
 };
@@ -4,6 +4,9 @@
 #endif
 #include <assert.h>
 
+#include <type_traits>
+#include <utility>
+
 #include "Allocator.h"
 
 namespace tiny_dlna {
@@ -11,7 +14,9 @@ namespace tiny_dlna {
 /**
  * @brief Vector implementation which provides the most important methods as
  *defined by std::vector. This class it is quite handy to have and most of the
- *times quite better then dealing with raw c arrays.
+ *times quite better then dealing with raw c arrays. Only the elements up to
+ *size() are constructed: they are moved when the memory is reallocated and
+ *they are destroyed by erase(), pop_back(), resize() and clear().
  * @ingroup collections
  * @author Phil Schatzmann
  * @copyright GPLv3
@@ -83,19 +88,19 @@ class Vector {
 
   /// support for initializer_list
   Vector(std::initializer_list<T> iniList) {
-    resize(iniList.size());
-    int pos = 0;
+    reserve(iniList.size());
     for (auto &obj : iniList) {
-      p_data[pos++] = obj;
+      new (p_data + len++) T(obj);
     }
   }
 
 #endif
 
-  /// Default constructor: size 0 with DefaultAllocator
+  /// Default constructor: size 0 (with the indicated capacity) with
+  /// DefaultAllocator
   Vector(size_t len = 0, Allocator &allocator = DefaultAllocator) {
     setAllocator(allocator);
-    resize_internal(len, false);
+    reserve(len);
   }
 
   /// Constructor with only allocator
@@ -104,10 +109,7 @@ class Vector {
   /// Allocate size and initialize array
   Vector(int size, T value, Allocator &allocator = DefaultAllocator) {
     setAllocator(allocator);
-    resize(size);
-    for (int j = 0; j < size; j++) {
-      p_data[j] = value;
-    }
+    assign(size, value);
   }
 
   /// Move constructor
@@ -126,99 +128,97 @@ class Vector {
   /// copy constructor
   Vector(Vector<T> &copyFrom) {
     this->p_allocator = copyFrom.p_allocator;
-    resize_internal(copyFrom.size(), false);
-    for (int j = 0; j < copyFrom.size(); j++) {
-      p_data[j] = copyFrom[j];
-    }
-    this->len = copyFrom.size();
+    copy(copyFrom);
   }
 
   /// copy operator
   Vector<T> &operator=(Vector<T> &copyFrom) {
-    resize_internal(copyFrom.size(), false);
-    for (int j = 0; j < copyFrom.size(); j++) {
-      p_data[j] = copyFrom[j];
-    }
-    this->len = copyFrom.size();
+    if (&copyFrom != this) copy(copyFrom);
     return *this;
   }
 
   /// legacy constructor with pointer range
   Vector(T *from, T *to, Allocator &allocator = DefaultAllocator) {
     this->p_allocator = &allocator;
-    this->len = to - from;
-    resize_internal(this->len, false);
-    for (size_t j = 0; j < this->len; j++) {
-      p_data[j] = from[j];
+    reserve(to - from);
+    for (T *ptr = from; ptr != to; ptr++) {
+      new (p_data + len++) T(*ptr);
     }
   }
 
   /// Destructor
   virtual ~Vector() { reset(); }
 
+  /// Defines the allocator: call this before any memory has been allocated
   void setAllocator(Allocator &allocator) { p_allocator = &allocator; }
 
-  void clear() { len = 0; }
+  /// Destroys all elements: the memory is kept for reuse
+  void clear() {
+    destroy(0, len);
+    len = 0;
+  }
 
   int size() { return len; }
 
   bool empty() { return size() == 0; }
 
+  /// Makes sure that we can store the indicated number of elements w/o
+  /// reallocation
+  bool reserve(int newCapacity) {
+    if (newCapacity <= max_capacity) return true;
+    return reallocate(newCapacity);
+  }
+
+  /// Constructs the new element at the end from the arguments (which must
+  /// not refer to an element of this vector)
+  template <class... Args>
+  T &emplace_back(Args &&...args) {
+    grow(len + 1);
+    new (p_data + len) T(std::forward<Args>(args)...);
+    return p_data[len++];
+  }
+
   void push_back(T &&value) {
-    resize_internal(len + 1, true);
-    p_data[len] = value;
+    T *p_value = keep(&value);
+    moveConstruct(p_data + len, *p_value);
     len++;
   }
 
   void push_back(T &value) {
-    resize_internal(len + 1, true);
-    p_data[len] = value;
+    T *p_value = keep(&value);
+    new (p_data + len) T(*p_value);
     len++;
   }
 
   void push_front(T &value) {
-    resize_internal(len + 1, true);
-    // memmove(p_data,p_data+1,len*sizeof(T));
-    for (int j = len; j >= 0; j--) {
-      p_data[j + 1] = p_data[j];
-    }
-    p_data[0] = value;
-    len++;
+    T tmp(value);
+    insertFront(tmp);
   }
 
-  void push_front(T &&value) {
-    resize_internal(len + 1, true);
-    // memmove(p_data,p_data+1,len*sizeof(T));
-    for (int j = len; j >= 0; j--) {
-      p_data[j + 1] = p_data[j];
-    }
-    p_data[0] = value;
-    len++;
-  }
+  void push_front(T &&value) { insertFront(value); }
 
   void pop_back() {
     if (len > 0) {
       len--;
+      p_data[len].~T();
     }
   }
 
   void pop_front() { erase(0); }
 
   void assign(iterator v1, iterator v2) {
-    size_t newLen = v2 - v1;
-    resize_internal(newLen, false);
-    this->len = newLen;
-    int pos = 0;
+    clear();
+    reserve(v2 - v1);
     for (auto ptr = v1; ptr != v2; ptr++) {
-      p_data[pos++] = *ptr;
+      new (p_data + len++) T(*ptr);
     }
   }
 
   void assign(size_t number, T value) {
-    resize_internal(number, false);
-    this->len = number;
+    clear();
+    reserve(number);
     for (int j = 0; j < number; j++) {
-      p_data[j] = value;
+      new (p_data + len++) T(value);
     }
   }
 
@@ -227,14 +227,17 @@ class Vector {
     T *dataCpy = p_data;
     int bufferLenCpy = max_capacity;
     int lenCpy = len;
+    Allocator *allocatorCpy = p_allocator;
     // swap this
     p_data = in.p_data;
     len = in.len;
     max_capacity = in.max_capacity;
+    p_allocator = in.p_allocator;
     // swp in
     in.p_data = dataCpy;
     in.len = lenCpy;
     in.max_capacity = bufferLenCpy;
+    in.p_allocator = allocatorCpy;
   }
 
   T &operator[](int index) {
@@ -254,13 +257,30 @@ class Vector {
     return false;
   }
 
-  void shrink_to_fit() { resize_internal(this->len, true, true); }
+  /// Releases the unused memory
+  void shrink_to_fit() {
+    if (len == 0) {
+      release();
+    } else if (len < max_capacity) {
+      reallocate(len);
+    }
+  }
 
   int capacity() { return this->max_capacity; }
 
+  /// Changes the size: new elements are default constructed and removed
+  /// elements are destroyed
   bool resize(int newSize) {
     int oldSize = this->len;
-    resize_internal(newSize, true);
+    if (newSize < 0) newSize = 0;
+    if (newSize < len) {
+      destroy(newSize, len);
+    } else if (newSize > len) {
+      if (!reserve(newSize)) return false;
+      for (int j = len; j < newSize; j++) {
+        new (p_data + j) T;
+      }
+    }
     this->len = newSize;
     return this->len != oldSize;
   }
@@ -276,19 +296,19 @@ class Vector {
 
   // removes a single element
   void erase(int pos) {
-    if (pos < len) {
-      int lenToEnd = len - pos - 1;
-      // call destructor on data to be erased
-      p_data[pos].~T();
+    if (pos < 0 || pos >= len) return;
+    if (std::is_trivially_copyable<T>::value) {
       // shift values by 1 position
       memmove((void *)&p_data[pos], (void *)(&p_data[pos + 1]),
-              lenToEnd * sizeof(T));
-
-      // make sure that we have a valid object at the end
-      // p_data[len - 1] = T();
-      new (&(p_data[len - 1])) T();
-      len--;
+              (len - pos - 1) * sizeof(T));
+    } else {
+      // objects might point into themselves (e.g. Str): so we move them
+      for (int j = pos; j < len - 1; j++) {
+        moveAssign(p_data[j], p_data[j + 1]);
+      }
     }
+    len--;
+    p_data[len].~T();
   }
 
   T *data() { return p_data; }
@@ -304,26 +324,10 @@ class Vector {
 
   bool contains(T obj) { return indexOf(obj) >= 0; }
 
-  void swap(T &other) {
-    // save values
-    int temp_blen = max_capacity;
-    int temp_len = len;
-    T *temp_data = p_data;
-    // swap from other
-    max_capacity = other.bufferLen;
-    len = other.len;
-    p_data = other.p_data;
-    // set other
-    other.bufferLen = temp_blen;
-    other.len = temp_len;
-    other.p_data = temp_data;
-  }
-
+  /// Destroys all elements and releases the memory
   void reset() {
     clear();
-    shrink_to_fit();
-    deleteArray(p_data, size());  // delete [] this->p_data;
-    p_data = nullptr;
+    release();
   }
 
  protected:
@@ -332,52 +336,136 @@ class Vector {
   T *p_data = nullptr;
   Allocator *p_allocator = &DefaultAllocator;
 
-  void resize_internal(int newSize, bool copy, bool shrink = false) {
-    if (newSize <= 0) return;
-    if (newSize > max_capacity || this->p_data == nullptr || shrink) {
-      T *oldData = p_data;
-      int oldBufferLen = this->max_capacity;
-      p_data = newArray(newSize);  // new T[newSize+1];
-      assert(p_data != nullptr);
-      this->max_capacity = newSize;
-      if (oldData != nullptr) {
-        if (copy && this->len > 0) {
-          // save existing data
-          memmove((void *)p_data, (void *)oldData, len * sizeof(T));
-          // clear to prevent double release
-          memset((void *)oldData, 0, len * sizeof(T));
-        }
-        if (shrink) {
-          cleanup(oldData, newSize, oldBufferLen);
-        }
-        deleteArray(oldData, oldBufferLen);  // delete [] oldData;
-      }
-    }
+  /// true if we need to use the allocator instead of new and delete
+  bool isAllocator() {
+    return USE_ALLOCATOR || p_allocator != &DefaultAllocator;
   }
 
+  /// Provides uninitialized memory for the indicated number of elements
   T *newArray(int newSize) {
-    T *data;
-#if USE_ALLOCATOR
-    data = p_allocator->createArray<T>(newSize);  // new T[newSize+1];
-#else
-    data = new T[newSize];
-#endif
-    return data;
+    if (isAllocator()) {
+      return (T *)p_allocator->allocate(sizeof(T) * newSize);
+    }
+    return (T *)new uint8_t[sizeof(T) * newSize];
   }
 
-  void deleteArray(T *oldData, int oldBufferLen) {
-#if USE_ALLOCATOR
-    p_allocator->removeArray(oldData, oldBufferLen);  // delete [] oldData;
-#else
-    delete[] oldData;
-#endif
+  void deleteArray(T *oldData) {
+    if (oldData == nullptr) return;
+    if (isAllocator()) {
+      p_allocator->free(oldData);
+    } else {
+      delete[] (uint8_t *)oldData;
+    }
   }
 
-  void cleanup(T *data, int from, int to) {
+  /// Moves the elements into a new memory area with the indicated capacity
+  bool reallocate(int newCapacity) {
+    T *oldData = p_data;
+    T *newData = newArray(newCapacity);
+    assert(newData != nullptr);
+    if (newData == nullptr) return false;
+    relocate(newData, oldData, len);
+    p_data = newData;
+    max_capacity = newCapacity;
+    deleteArray(oldData);
+    return true;
+  }
+
+  /// Releases the memory: all elements must have been destroyed
+  void release() {
+    deleteArray(p_data);
+    p_data = nullptr;
+    max_capacity = 0;
+  }
+
+  /// Increases the capacity by 50% if newSize is not fitting
+  void grow(int newSize) {
+    if (newSize <= max_capacity) return;
+    int newCapacity = max_capacity + max_capacity / 2 + 1;
+    reserve(newCapacity < newSize ? newSize : newCapacity);
+  }
+
+  /// Makes room for one more element: if the value is an element of this
+  /// vector we provide its new address
+  T *keep(T *p_value) {
+    if (len < max_capacity) return p_value;
+    bool is_element = p_value >= p_data && p_value < p_data + len;
+    int idx = p_value - p_data;
+    grow(len + 1);
+    return is_element ? p_data + idx : p_value;
+  }
+
+  /// Inserts the value at the first position
+  void insertFront(T &value) {
+    grow(len + 1);
+    if (len > 0) {
+      moveConstruct(p_data + len, p_data[len - 1]);
+      for (int j = len - 1; j > 0; j--) {
+        moveAssign(p_data[j], p_data[j - 1]);
+      }
+      moveAssign(p_data[0], value);
+    } else {
+      moveConstruct(p_data, value);
+    }
+    len++;
+  }
+
+  /// Copies all elements of the source
+  void copy(Vector<T> &source) {
+    clear();
+    reserve(source.size());
+    for (int j = 0; j < source.size(); j++) {
+      new (p_data + len++) T(source[j]);
+    }
+  }
+
+  /// Calls the destructor of the elements in the range
+  void destroy(int from, int to) {
+    if (std::is_trivially_destructible<T>::value) return;
     for (int j = from; j < to; j++) {
-      data[j].~T();
+      p_data[j].~T();
+    }
+  }
+
+  /// Moves the objects to the new (uninitialized) memory: objects which are
+  /// not trivially copyable (e.g. a Str with its inline buffer) are moved one
+  /// by one
+  void relocate(T *to, T *from, int n) {
+    if (std::is_trivially_copyable<T>::value) {
+      if (n > 0) memcpy((void *)to, (void *)from, n * sizeof(T));
+    } else {
+      for (int j = 0; j < n; j++) {
+        moveConstruct(to + j, from[j]);
+        from[j].~T();
+      }
     }
   }
+
+  /// moves the value if the type supports it, otherwise we copy it
+  template <typename U>
+  static typename std::enable_if<std::is_move_assignable<U>::value>::type
+  moveAssign(U &to, U &from) {
+    to = std::move(from);
+  }
+
+  template <typename U>
+  static typename std::enable_if<!std::is_move_assignable<U>::value>::type
+  moveAssign(U &to, U &from) {
+    to = from;
+  }
+
+  /// move constructs the value if the type supports it, otherwise we copy it
+  template <typename U>
+  static typename std::enable_if<std::is_move_constructible<U>::value>::type
+  moveConstruct(U *to, U &from) {
+    new (to) U(std::move(from));
+  }
+
+  template <typename U>
+  static typename std::enable_if<!std::is_move_constructible<U>::value>::type
+  moveConstruct(U *to, U &from) {
+    new (to) U(from);
+  }
 };
 
 }  // namespace tiny_dlna
\ No newline at end of file
@@ -0,0 +1,270 @@
+#pragma once
+
+#include "DLNADevice.h"
+#include "DLNAServiceInfo.h"
+#include "basic/HashIndex.h"
+#include "basic/StrPrint.h"
+#include "basic/Vector.h"
+#include "http/HttpServer.h"
+#include "service/State.h"
+#include "xml/XMLActionRequestParser.h"
+#include "xml/XMLPrinter.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief A received SOAP action which is provided to the DLNAActionHandler:
+ * gives access to the in-arguments and collects the out-arguments of the
+ * reply.
+ * @author Phil Schatzmann
+ */
+class DLNAAction {
+ public:
+  /// Name of the action: e.g. Play
+  const char* name() { return p_name; }
+
+  /// Service type of the action
+  const char* serviceType() { return p_service_type; }
+
+  /// Provides the value of an in-argument (or nullptr)
+  const char* getArgument(const char* name) {
+    for (auto& arg : *p_arguments) {
+      if (arg.name.equals(name)) return arg.value.c_str();
+    }
+    return nullptr;
+  }
+
+  /// Provides the value of an in-argument as number
+  long getArgumentInt(const char* name, long defaultValue = 0) {
+    const char* value = getArgument(name);
+    if (value == nullptr || *value == 0) return defaultValue;
+    return atol(value);
+  }
+
+  /// Provides the value of a boolean in-argument ("1", "true" or "yes")
+  bool getArgumentBool(const char* name) {
+    const char* str = getArgument(name);
+    if (str == nullptr) return false;
+    StrView value(str);
+    return value.equals("1") || value.equalsIgnoreCase("true") ||
+           value.equalsIgnoreCase("yes");
+  }
+
+  /// Adds an out-argument to the reply: call in the order of the SCPD
+  void addResult(const char* name, const char* value) {
+    xml.print("<");
+    xml.print(name);
+    xml.print(">");
+    xml.printEscaped(value);
+    xml.print("</");
+    xml.print(name);
+    xml.print(">");
+  }
+
+  /// Adds a numeric out-argument to the reply
+  void addResult(const char* name, long value) {
+    char tmp[20];
+    snprintf(tmp, sizeof(tmp), "%ld", value);
+    addResult(name, tmp);
+  }
+
+  /// Replies with an UPnP error instead (e.g. 402 Invalid Args)
+  void setError(int code, const char* description) {
+    error_code = code;
+    error_description = description;
+  }
+
+  /// Checks if the action has failed
+  bool isError() { return error_code != 0; }
+
+  int errorCode() { return error_code; }
+
+  const char* errorDescription() { return error_description; }
+
+ protected:
+  friend class DLNAActionDispatcher;
+  const char* p_name = nullptr;
+  const char* p_service_type = nullptr;
+  Vector<StateValue>* p_arguments = nullptr;
+  XMLPrinter xml;
+  int error_code = 0;
+  const char* error_description = nullptr;
+};
+
+/**
+ * @brief Dispatches the SOAP requests on the control url of the services to
+ * the DLNAActionHandler of the DLNAServiceInfo::actions table. The action
+ * is looked up via a hash index of the action names, the body is parsed
+ * while it is received and the reply is rendered into a reused buffer, so
+ * that it can be sent with a Content-Length.
+ * @author Phil Schatzmann
+ */
+class DLNAActionDispatcher {
+ public:
+  /// Registers the control url of all services which have an action table
+  /// but no control_cb
+  void setupServer(HttpServer& server, DLNADevice& device, const char* prefix) {
+    clear();
+    char buffer[DLNA_MAX_URL_LEN] = {0};
+    StrView url(buffer, DLNA_MAX_URL_LEN);
+    for (DLNAServiceInfo& info : device.getServices()) {
+      if (info.actions == nullptr || info.control_cb != nullptr) continue;
+      int idx = services.size();
+      services.push_back(&info);
+      for (int j = 0; j < info.action_count; j++) {
+        action_index.add(info.actions[j].name, idx, j);
+      }
+      void* ref[] = {this, (void*)(intptr_t)idx};
+      server.on(url.buildPath(prefix, info.control_url), T_POST, controlCB,
+                ref, 2);
+    }
+  }
+
+  /// Removes all registered services
+  void clear() {
+    services.clear();
+    action_index.clear();
+  }
+
+  /// Provides the table entry of the action of the service (or nullptr)
+  const DLNAActionEntry* find(int serviceIdx, const char* name) {
+    if (name == nullptr) return nullptr;
+    for (int pos = action_index.find(name); pos >= 0;
+         pos = action_index.next(pos)) {
+      if (action_index.value(pos) != serviceIdx) continue;
+      const DLNAActionEntry* entry =
+          &services[serviceIdx]->actions[action_index.value2(pos)];
+      if (strcmp(entry->name, name) == 0) return entry;
+    }
+    return nullptr;
+  }
+
+ protected:
+  Vector<DLNAServiceInfo*> services;
+  HashIndex action_index;
+  XMLActionRequestParser parser;
+  Vector<StateValue> arguments;
+  // out-arguments and the complete reply
+  StrPrint result{256};
+  StrPrint reply{512};
+
+  static void controlCB(HttpServer* server, const char* requestPath,
+                        HttpRequestHandlerLine* hl) {
+    DLNAActionDispatcher* self = (DLNAActionDispatcher*)hl->context[0];
+    int idx = (int)(intptr_t)hl->context[1];
+    self->process(*server, idx);
+  }
+
+  void process(HttpServer& server, int serviceIdx) {
+    DLNAServiceInfo& info = *services[serviceIdx];
+    // parse the body while we receive it
+    arguments.clear();
+    parser.begin(arguments);
+    server.readRequestData(parser);
+
+    // the action is defined by the SOAPACTION header: e.g.
+    // "urn:schemas-upnp-org:service:AVTransport:1#Play"
+    char name[DLNA_XML_TAG_SIZE];
+    if (!actionName(server.requestHeader().get("SOAPACTION"), name,
+                    sizeof(name))) {
+      strncpy(name, parser.getAction(), sizeof(name) - 1);
+      name[sizeof(name) - 1] = 0;
+    }
+
+    DLNAAction action;
+    action.p_name = name;
+    action.p_service_type = info.service_type;
+    action.p_arguments = &arguments;
+    result.reset();
+    action.xml.setOutput(result);
+
+    const DLNAActionEntry* entry = find(serviceIdx, name);
+    if (entry == nullptr) {
+      DLNA_LOG(DlnaWarning, "Invalid action: %s", name);
+      action.setError(401, "Invalid Action");
+    } else if (parser.isArgumentCut()) {
+      // e.g. a cut off CurrentURI must not be used
+      DLNA_LOG(DlnaWarning, "Argument too long: %s", name);
+      action.setError(402, "Invalid Args");
+    } else {
+      DLNA_LOG(DlnaInfo, "Action: %s", name);
+      entry->handler(action, info.action_ref);
+    }
+
+    if (action.isError()) {
+      printFault(action);
+      server.reply("text/xml; charset=\"utf-8\"", (const uint8_t*)reply.c_str(),
+                   reply.length(), 500, "Internal Server Error");
+    } else {
+      printResponse(action);
+      server.reply("text/xml; charset=\"utf-8\"", (const uint8_t*)reply.c_str(),
+                   reply.length());
+    }
+  }
+
+  /// Determines the action name after the # of the SOAPACTION header
+  bool actionName(const char* soapAction, char* name, int len) {
+    if (soapAction == nullptr) return false;
+    const char* start = strchr(soapAction, '#');
+    if (start == nullptr) return false;
+    start++;
+    int n = 0;
+    while (start[n] != 0 && start[n] != '"' && n < len - 1) {
+      name[n] = start[n];
+      n++;
+    }
+    name[n] = 0;
+    return n > 0;
+  }
+
+  void printEnvelopeBegin(XMLPrinter& xml) {
+    xml.printXMLHeader();
+    xml.printNodeBegin(
+        "Envelope",
+        "xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\" "
+        "s:encodingStyle=\"http://schemas.xmlsoap.org/soap/encoding/\"",
+        "s");
+    xml.printNodeBegin("Body", nullptr, "s");
+  }
+
+  void printEnvelopeEnd(XMLPrinter& xml) {
+    xml.printNodeEnd("Body", "s");
+    xml.printNodeEnd("Envelope", "s");
+  }
+
+  void printResponse(DLNAAction& action) {
+    reply.reset();
+    XMLPrinter xml(reply);
+    printEnvelopeBegin(xml);
+    xml.print("<u:");
+    xml.print(action.name());
+    xml.print("Response xmlns:u=\"");
+    xml.print(action.serviceType());
+    xml.print("\">");
+    xml.print(result.c_str());
+    xml.print("</u:");
+    xml.print(action.name());
+    xml.print("Response>");
+    printEnvelopeEnd(xml);
+  }
+
+  void printFault(DLNAAction& action) {
+    reply.reset();
+    XMLPrinter xml(reply);
+    printEnvelopeBegin(xml);
+    xml.printNodeBegin("Fault", nullptr, "s");
+    xml.printNode("faultcode", "s:Client");
+    xml.printNode("faultstring", "UPnPError");
+    xml.printNodeBegin("detail");
+    xml.printNodeBegin("UPnPError",
+                       "xmlns=\"urn:schemas-upnp-org:control-1-0\"");
+    xml.printNode("errorCode", action.errorCode());
+    xml.printNode("errorDescription", action.errorDescription());
+    xml.printNodeEnd("UPnPError");
+    xml.printNodeEnd("detail");
+    xml.printNodeEnd("Fault", "s");
+    printEnvelopeEnd(xml);
+  }
+};
+
+}  // namespace tiny_dlna
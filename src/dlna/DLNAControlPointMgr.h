@@ -5,13 +5,80 @@
 #include "DLNADeviceMgr.h"
 #include "Schedule.h"
 #include "Scheduler.h"
+#include "basic/HashIndex.h"
 #include "basic/StrPrint.h"
 #include "basic/Url.h"
 #include "http/HttpServer.h"
+#include "xml/XMLActionReplyParser.h"
+#include "service/State.h"
 #include "xml/XMLDeviceParser.h"
+#include "xml/XMLEventParser.h"
+
+// interval in ms in which we check for expired devices
+#ifndef DLNA_DEVICE_EXPIRY_CHECK_MS
+#define DLNA_DEVICE_EXPIRY_CHECK_MS 10000
+#endif
+
+// max-age in seconds if a device does not announce any
+#ifndef DLNA_DEVICE_DEFAULT_MAX_AGE
+#define DLNA_DEVICE_DEFAULT_MAX_AGE 1800
+#endif
+
+// time in ms after which we retry to get the device xml of a failed location
+#ifndef DLNA_DEVICE_RETRY_MS
+#define DLNA_DEVICE_RETRY_MS (5 * 60 * 1000)
+#endif
+
+// max number of failed locations which we remember
+#ifndef DLNA_DEVICE_FAILED_SIZE
+#define DLNA_DEVICE_FAILED_SIZE 20
+#endif
+
+// max time in ms for the processing of an action of executeActionsAsync()
+#ifndef DLNA_ASYNC_ACTION_TIMEOUT
+#define DLNA_ASYNC_ACTION_TIMEOUT 10000
+#endif
+
+// time in ms after which we retry a failed subscription
+#ifndef DLNA_SUBSCRIPTION_RETRY_MS
+#define DLNA_SUBSCRIPTION_RETRY_MS 5000
+#endif
+
+// subscriptions are renewed after n percent of the timeout
+#ifndef DLNA_SUBSCRIPTION_RENEW_PERCENT
+#define DLNA_SUBSCRIPTION_RENEW_PERCENT 80
+#endif
+
+// max number of (service type, action) for which we keep the pre-rendered
+// SOAP envelope
+#ifndef DLNA_SOAP_TEMPLATE_COUNT
+#define DLNA_SOAP_TEMPLATE_COUNT 10
+#endif
 
 namespace tiny_dlna {
 
+/**
+ * @brief Event subscription of the control point to a service: the values of
+ * the received state variables are cached.
+ * @author Phil Schatzmann
+ */
+struct DLNAEventSubscription {
+  Str sid;
+  Str service_id;
+  /// url of the SUBSCRIBE and UNSUBSCRIBE requests
+  Str event_url;
+  /// requested timeout in seconds
+  int timeout_sec = 0;
+  /// millis() when we need to renew the subscription
+  uint64_t renew_time = 0;
+  /// millis() when the subscription ends
+  uint64_t expires = 0;
+  /// expected SEQ of the next NOTIFY
+  uint32_t next_seq = 0;
+  /// actual values of the state variables
+  Vector<StateValue> values;
+};
+
 class DLNAControlPointMgr;
 DLNAControlPointMgr* selfDLNAControlPoint = nullptr;
 
@@ -36,6 +103,9 @@ class DLNAControlPointMgr {
   void setParseDevice(bool flag) { is_parse_device = flag; }
   /// Defines the lacal url (needed for subscriptions)
   void setLocalURL(Url url) { local_url = url; }
+  /// Defines the server which receives the event NOTIFY messages on the path
+  /// of the local url: call before begin()
+  void setHttpServer(HttpServer& server) { p_server = &server; }
 
   /**
    * @brief start the processing by sending out a MSearch. For the search target
@@ -52,15 +122,25 @@ version: locate service of a given type
   bool begin(HttpRequest& http, IUDPService &udp,
              const char* searchTarget = "ssdp:all", uint32_t processingTime = 0,
              bool stopWhenFound = true) {
-    DlnaLogger.log(DlnaInfo, "DLNADevice::begin");
+    DLNA_LOG(DlnaInfo, "DLNADevice::begin");
     search_target = searchTarget;
     is_active = true;
     p_udp = &udp;
     p_http = &http;
 
+    // discard irrelevant UDP traffic before it is parsed
+    parser.setSearchTarget(searchTarget);
+    p_udp->setReceiveFilter(DLNAControlPointRequestParser::filter, &parser);
+
     // setup multicast UDP
     if (!(p_udp->begin(DLNABroadcastAddress))) {
-      DlnaLogger.log(DlnaError, "UDP begin failed");
+      DLNA_LOG(DlnaError, "UDP begin failed");
+      return false;
+    }
+
+    // receive the event notifications
+    if (p_server != nullptr && !setupEventServer()) {
+      DLNA_LOG(DlnaError, "Event server failed");
       return false;
     }
 
@@ -71,6 +151,13 @@ version: locate service of a given type
     search->repeat_ms = 1000;
     scheduler.add(search);
 
+    // mark the devices which are not announced any more
+    if (is_device_expiry && p_expire == nullptr) {
+      p_expire = new ExpireDevicesCP(DLNA_DEVICE_EXPIRY_CHECK_MS);
+      p_expire->callback = processExpiry;
+      scheduler.add(p_expire);
+    }
+
     // if processingTime > 0 we do some loop processing already here
     uint64_t end = millis() + processingTime;
     while (millis() < end) {
@@ -78,15 +165,17 @@ version: locate service of a given type
       loop();
     }
 
-    DlnaLogger.log(DlnaInfo, "Control Point started with %d devices found",
-                   devices.size());
+    DLNA_LOG(DlnaInfo, "Control Point started with %d devices found",
+             devices.size());
     return devices.size() > 0;
   }
 
   /// Stops the processing and releases the resources
   void end() {
-    // p_server->end();
+    unsubscribeAll();
+    if (p_server != nullptr) p_server->end();
     for (auto& device : devices) device.clear();
+    rebuildIndex();
     is_active = false;
   }
 
@@ -103,66 +192,152 @@ version: locate service of a given type
     return result;
   }
 
-  /// Subscribe to changes
+  /// Callback which provides the reply of an asynchronous action
+  typedef void (*ActionCallback)(ActionRequest& action, ActionReply& reply,
+                                 void* ref);
+
+  /// Executes all registered methods w/o blocking: the requests are processed
+  /// step by step in loop() (connect, send, read the header and the body)
+  /// with the HttpRequest of begin() and the callback is called with the
+  /// reply of each action. The actions are executed one after the other.
+  /// Returns the number of queued actions.
+  int executeActionsAsync(ActionCallback callback, void* ref = nullptr) {
+    int result = 0;
+    for (auto& action : actions) {
+      if (action.getServiceType() == nullptr) continue;
+      AsyncAction* p_job = new AsyncAction();
+      p_job->action = action;
+      p_job->callback = callback;
+      p_job->ref = ref;
+      async_actions.push_back(p_job);
+      result++;
+    }
+    actions.clear();
+    return result;
+  }
+
+  /// Number of asynchronous actions which have not been completed yet
+  int pendingActions() { return async_actions.size(); }
+
+  /// Callback which is called when the value of an evented state variable
+  /// has changed
+  typedef void (*EventCallback)(const char* serviceId, const char* name,
+                                const char* value, void* ref);
+
+  /// Defines the callback which is called for the changed state variables
+  void setEventCallback(EventCallback callback, void* ref = nullptr) {
+    event_callback = callback;
+    event_ref = ref;
+  }
+
+  /// Subscribe to changes: the subscription is renewed automatically until
+  /// unsubscribe() is called. The events are received by the server which was
+  /// defined with setHttpServer().
   bool subscribe(const char* serviceName, int seconds) {
-    auto service = getService(serviceName);
+    auto& service = getService(serviceName);
     if (!service) {
-      DlnaLogger.log(DlnaError, "No service found for %s", serviceName);
+      DLNA_LOG(DlnaError, "No service found for %s", serviceName);
       return false;
     }
 
     auto& device = getDevice(service);
     if (!device) {
-      DlnaLogger.log(DlnaError, "Device not found");
+      DLNA_LOG(DlnaError, "Device not found");
       return false;
     }
 
     if (StrView(local_url.url()).isEmpty()) {
-      DlnaLogger.log(DlnaError, "Local URL not defined");
+      DLNA_LOG(DlnaError, "Local URL not defined");
       return false;
     }
-    char url_buffer[200] = {0};
-    char seconds_txt[80] = {0};
-    Url url{getUrl(device, service.event_sub_url, url_buffer, 200)};
-    snprintf(seconds_txt, 80, "Second-%d", seconds);
-    p_http->request().put("NT", "upnp:event");
-    p_http->request().put("TIMEOUT", seconds_txt);
-    p_http->request().put("CALLBACK", local_url.url());
-    int rc = p_http->subscribe(url);
-    DlnaLogger.log(DlnaInfo, "Http rc: %s", rc);
-    return rc == 200;
+    const char* event_url = eventSubUrl(service).url();
+    DLNAEventSubscription* p_sub = getSubscription(service.service_id);
+    if (p_sub == nullptr) {
+      DLNAEventSubscription sub;
+      sub.service_id = service.service_id;
+      subscriptions.push_back(sub);
+      p_sub = &subscriptions[subscriptions.size() - 1];
+    } else if (!p_sub->event_url.equals(event_url)) {
+      // the device has moved: we need a new subscription
+      p_sub->sid.reset();
+    }
+    p_sub->event_url = event_url;
+    p_sub->timeout_sec = seconds;
+    return sendSubscribe(*p_sub);
+  }
+
+  /// Cancels the subscription of the service
+  bool unsubscribe(const char* serviceName) {
+    for (int j = 0; j < subscriptions.size(); j++) {
+      if (StrView(subscriptions[j].service_id.c_str()).contains(serviceName)) {
+        bool result = sendUnsubscribe(subscriptions[j]);
+        subscriptions.erase(j);
+        return result;
+      }
+    }
+    return false;
   }
 
-  // /// Provides the actual state value
-  // const char* getStateValue(const char* name) {
-  //   for (auto& st : state) {
-  //     if (st.name == name) {
-  //       return st.value.c_str();
-  //     }
-  //   }
-  //   return nullptr;
-  // }
+  /// Provides the subscription for the service (or nullptr)
+  DLNAEventSubscription* getSubscription(const char* serviceName) {
+    if (serviceName == nullptr) return nullptr;
+    for (auto& sub : subscriptions) {
+      if (StrView(sub.service_id.c_str()).contains(serviceName)) return &sub;
+    }
+    return nullptr;
+  }
+
+  /// Number of subscriptions
+  int subscriptionCount() { return subscriptions.size(); }
+
+  /// Provides the last received value of an evented state variable
+  const char* getStateValue(const char* serviceName, const char* name) {
+    DLNAEventSubscription* p_sub = getSubscription(serviceName);
+    if (p_sub == nullptr) return nullptr;
+    for (auto& st : p_sub->values) {
+      if (st.name.equals(name)) return st.value.c_str();
+    }
+    return nullptr;
+  }
 
   /// call this method in the Arduino loop as often as possible: the processes
   /// all replys
   bool loop() {
     if (!is_active) return false;
-    DLNAControlPointRequestParser parser;
 
-    // process UDP requests
-    RequestData req = p_udp->receive();
-    if (req) {
-      Schedule* schedule = parser.parse(req);
-      if (schedule != nullptr) {
-        // handle NotifyReplyCP
-        if (StrView(schedule->name()).equals("NotifyReplyCP")) {
-          NotifyReplyCP& notify_schedule = *(NotifyReplyCP*)schedule;
-          notify_schedule.callback = processDevice;
-        }
-        scheduler.add(schedule);
+    if (is_event_driven) {
+      // wait for the next udp reply or the next due schedule: but we must not
+      // wait if there are pending asynchronous actions or device requests
+      bool is_pending =
+          async_actions.size() > 0 || pending_locations.size() > 0;
+      uint32_t wait = is_pending ? 0 : scheduler.timeToNext(max_wait_ms);
+      uint64_t end = millis() + wait;
+      while (true) {
+        bool is_busy = processUDP();
+        if (p_server != nullptr && p_server->copy()) is_busy = true;
+        if (is_busy || millis() >= end) break;
+        delay(1);
       }
+      scheduler.execute(*p_udp);
+      if (!isAsyncActionActive()) processPendingLocation();
+      processAsyncActions();
+      if (!isAsyncActionActive()) processSubscriptions();
+      return true;
     }
 
+    // process UDP requests
+    processUDP();
+
+    // get the device xml of a newly announced device
+    if (!isAsyncActionActive()) processPendingLocation();
+
+    // advance the asynchronous actions
+    processAsyncActions();
+
+    // receive the events and renew the subscriptions
+    if (p_server != nullptr) p_server->copy();
+    if (!isAsyncActionActive()) processSubscriptions();
+
     // execute scheduled udp replys
     scheduler.execute(*p_udp);
 
@@ -171,9 +346,24 @@ version: locate service of a given type
     return true;
   }
 
-  /// Provide addess to the service information
+  /// Activates the event driven loop: instead of a fixed delay we wait until
+  /// we receive a udp reply or until the next schedule is due. The waiting
+  /// time is limited by maxWaitMs.
+  void setEventDrivenLoop(bool active, uint32_t maxWaitMs = 1000) {
+    is_event_driven = active;
+    max_wait_ms = maxWaitMs;
+  }
+
+  /// Provide addess to the service information: the id can be the full
+  /// service id or a part of it (e.g. SwitchPower)
   DLNAServiceInfo& getService(const char* id) {
     static DLNAServiceInfo no_service(false);
+    // exact match of the id or its last part
+    for (int pos = service_index.find(id); pos >= 0;
+         pos = service_index.next(pos)) {
+      DLNAServiceInfo& result = serviceAt(service_index, pos);
+      if (result && StrView(result.service_id).contains(id)) return result;
+    }
     for (auto& dev : devices) {
       DLNAServiceInfo& result = dev.getService(id);
       if (result) return result;
@@ -181,14 +371,36 @@ version: locate service of a given type
     return no_service;
   }
 
+  /// Provides all services of the indicated service type (e.g.
+  /// urn:schemas-upnp-org:service:AVTransport:1) of all devices: returns the
+  /// number of services. The pointers are valid until the devices change.
+  int getServices(const char* serviceType, Vector<DLNAServiceInfo*>& result) {
+    result.clear();
+    for (int pos = service_type_index.find(serviceType); pos >= 0;
+         pos = service_type_index.next(pos)) {
+      DLNAServiceInfo& service = serviceAt(service_type_index, pos);
+      if (StrView(service.service_type).equals(serviceType)) {
+        result.push_back(&service);
+      }
+    }
+    return result.size();
+  }
+
   /// Provides the device information by index
   DLNADevice& getDevice(int deviceIdx = 0) { return devices[deviceIdx]; }
 
   /// Provides the device for a service
   DLNADevice& getDevice(DLNAServiceInfo& service) {
+    for (int pos = service_index.find(service.service_id); pos >= 0;
+         pos = service_index.next(pos)) {
+      if (&serviceAt(service_index, pos) == &service) {
+        return devices[service_index.value(pos)];
+      }
+    }
+    // services w/o id are not indexed
     for (auto& dev : devices) {
       for (auto& srv : dev.getServices()) {
-        if (srv == srv) return dev;
+        if (&srv == &service) return dev;
       }
     }
     return NO_DEVICE;
@@ -196,65 +408,96 @@ version: locate service of a given type
 
   /// Get a device for a Url
   DLNADevice& getDevice(Url location) {
-    for (auto& dev : devices) {
-      if (dev.getDeviceURL() == location) {
-        return dev;
-      }
+    for (int pos = location_index.find(location.url()); pos >= 0;
+         pos = location_index.next(pos)) {
+      DLNADevice& dev = devices[location_index.value(pos)];
+      if (dev.getDeviceURL() == location) return dev;
     }
     return NO_DEVICE;
   }
 
+  /// Get a device for a UDN
+  DLNADevice& getDeviceByUDN(const char* udn) {
+    for (int pos = udn_index.find(udn); pos >= 0; pos = udn_index.next(pos)) {
+      DLNADevice& dev = devices[udn_index.value(pos)];
+      if (StrView(dev.getUDN()).equals(udn)) return dev;
+    }
+    return NO_DEVICE;
+  }
+
+  /// Provides all devices: call rebuildIndex() if you change them
   Vector<DLNADevice>& getDevices() { return devices; }
 
   /// Adds a new device
   bool addDevice(DLNADevice dev) {
     dev.updateTimestamp();
-    for (auto& existing_device : devices) {
-      if (dev.getUDN() == existing_device.getUDN()) {
-        DlnaLogger.log(DlnaInfo, "Device '%s' already exists", dev.getUDN());
-        return false;
-      }
+    if (dev.getUDN() != nullptr &&
+        &getDeviceByUDN(dev.getUDN()) != &NO_DEVICE) {
+      DLNA_LOG(DlnaInfo, "Device '%s' already exists", dev.getUDN());
+      return false;
     }
-    DlnaLogger.log(DlnaInfo, "Device '%s' has been added", dev.getUDN());
+    DLNA_LOG(DlnaInfo, "Device '%s' has been added", dev.getUDN());
     devices.push_back(dev);
+    addIndex(devices.size() - 1);
     return true;
   }
 
   /// Adds the device from the device xml url if it does not already exist
-  bool addDevice(Url url) {
-    DLNADevice& device = getDevice(url);
-    if (device != NO_DEVICE) {
-      // device already exists
-      device.setActive(true);
-      return true;
-    }
-    // http get
-    StrPrint xml;
-    HttpRequest req;
-    int rc = req.get(url, "text/xml");
+  bool addDevice(Url url) { return fetchDevice(url) != nullptr; }
 
-    if (rc != 200) {
-      DlnaLogger.log(DlnaError, "Http get to '%s' failed with %d", url.url(),
-                     rc);
-      req.stop();
-      return false;
+  /// Activates the max-age expiry of the devices (default: false): devices
+  /// which have not been announced within their max-age are marked as
+  /// expired and inactive, but they are not removed.
+  void setDeviceExpiry(bool active) { is_device_expiry = active; }
+
+  /// Marks the devices whose max-age has been exceeded as expired: returns
+  /// the number of newly expired devices
+  int expireDevices() {
+    int result = 0;
+    for (auto& dev : devices) {
+      if (dev.isActive() && dev.isExpired()) {
+        DLNA_LOG(DlnaInfo, "Device '%s' has expired", dev.getUDN());
+        dev.setExpired();
+        result++;
+      }
     }
-    // get xml
-    uint8_t buffer[512];
-    while (true) {
-      int len = req.read(buffer, 512);
-      if (len == 0) break;
-      xml.write(buffer, len);
+    return result;
+  }
+
+  /// Removes the expired devices (e.g. after a ssdp:byebye) to release their
+  /// memory: returns the number of removed devices. This moves the remaining
+  /// devices, so call it only if you do not keep any references to devices
+  /// or services. The strings are released when no device is left.
+  int removeExpiredDevices() {
+    if (actions.size() > 0 || async_actions.size() > 0) return 0;
+    int result = 0;
+    for (int j = devices.size() - 1; j >= 0; j--) {
+      if (devices[j].isExpired()) {
+        DLNA_LOG(DlnaInfo, "Device '%s' has been removed",
+                 devices[j].getUDN());
+        devices.erase(j);
+        result++;
+      }
     }
-    req.stop();
+    if (result > 0) rebuildIndex();
+    if (devices.size() == 0) strings.clear();
+    return result;
+  }
 
-    // parse xml
-    DLNADevice new_device;
-    XMLDeviceParser parser;
-    parser.parse(new_device, strings, xml.c_str());
-    new_device.device_url = url;
-    devices.push_back(new_device);
-    return true;
+  /// Activates the pipelining in executeActions() (default: false): the
+  /// actions for the same host are sent on one kept alive connection and the
+  /// different hosts are processed concurrently. Each host uses its own
+  /// WiFiClient connection with the settings (agent, timeout) of the
+  /// HttpRequest of begin().
+  void setPipelining(bool active) { is_pipelining = active; }
+
+  /// Recreates the indexes of the devices by UDN, location and service
+  void rebuildIndex() {
+    udn_index.clear();
+    location_index.clear();
+    service_index.clear();
+    service_type_index.clear();
+    for (int j = 0; j < devices.size(); j++) addIndex(j);
   }
 
   /// We can activate/deactivate the scheduler
@@ -265,60 +508,464 @@ version: locate service of a given type
 
  protected:
   Scheduler scheduler;
+  DLNAControlPointRequestParser parser;
   HttpRequest* p_http = nullptr;
+  HttpServer* p_server = nullptr;
   IUDPService* p_udp = nullptr;
   Vector<DLNADevice> devices;
   Vector<ActionRequest> actions;
   XMLPrinter xml;
+  /// Pre-rendered SOAP envelope of an action: only the arguments are printed
+  /// for each request
+  struct SOAPTemplate {
+    Str service_type;
+    Str action;
+    // xml header up to the <u:action xmlns:u="..."> node
+    Str prefix;
+    // closing nodes of the action, body and envelope
+    Str suffix;
+    // value of the SOAPACTION header
+    Str soap_action;
+  };
+  Vector<SOAPTemplate> soap_templates;
+  int soap_template_next = 0;
+  // body of the SOAP request: the memory is reused for all actions
+  StrPrint soap_body{512};
   bool is_active = false;
+  bool is_pipelining = false;
+  bool is_device_expiry = false;
   bool is_parse_device = false;
+  bool is_event_driven = false;
+  uint32_t max_wait_ms = 1000;
+  // received UDP packets: the buffers are reused
+  RequestData udp_batch[DLNA_UDP_BATCH_SIZE];
   DLNADevice NO_DEVICE{false};
+  // device indexes: the values are the positions in devices and in the
+  // services of the device. The services are indexed by id and by type.
+  HashIndex udn_index;
+  HashIndex location_index;
+  HashIndex service_index;
+  HashIndex service_type_index;
   const char* search_target;
+  // strings of the devices
   StringRegistry strings;
+  // names of the reply arguments: they are never released
+  StringRegistry reply_strings;
+  ExpireDevicesCP* p_expire = nullptr;
+  /// Announced location for which we need to get the device xml
+  struct PendingLocation {
+    Str location;
+    int max_age = 0;
+  };
+  Vector<PendingLocation> pending_locations;
+  /// Location for which the device xml request has failed
+  struct FailedLocation {
+    Str location;
+    uint64_t time = 0;
+  };
+  Vector<FailedLocation> failed_locations;
   Url local_url;
+  Vector<DLNAEventSubscription> subscriptions;
+  XMLEventParser event_parser;
+  // subscription of the NOTIFY which is parsed
+  int event_sub_idx = -1;
+  EventCallback event_callback = nullptr;
+  void* event_ref = nullptr;
+
+  /// Registers the NOTIFY handler and starts the server
+  bool setupEventServer() {
+    const char* path = local_url.path();
+    if (StrView(path).isEmpty()) path = "/";
+    void* ref[] = {this};
+    p_server->on(path, T_NOTIFY, eventCallback, ref, 1);
+    p_server->setNoConnectDelay(0);
+    if (*p_server) return true;
+    return p_server->begin(local_url.port());
+  }
+
+  /// Sends the SUBSCRIBE: a renewal if we already have a SID
+  bool sendSubscribe(DLNAEventSubscription& sub) {
+    if (p_http == nullptr) return false;
+    bool is_renewal = !sub.sid.isEmpty();
+    Url url{sub.event_url.c_str()};
+    char tmp[DLNA_MAX_URL_LEN + 2];
+    snprintf(tmp, sizeof(tmp), "Second-%d", sub.timeout_sec);
+    // only the headers which are valid for this GENA message
+    p_http->request().clear();
+    p_http->request().put("TIMEOUT", tmp);
+    if (is_renewal) {
+      p_http->request().put("SID", sub.sid.c_str());
+    } else {
+      snprintf(tmp, sizeof(tmp), "<%s>", local_url.url());
+      p_http->request().put("NT", "upnp:event");
+      p_http->request().put("CALLBACK", tmp);
+    }
+    int rc = p_http->subscribe(url);
+    DLNA_LOG(DlnaInfo, "Http rc: %d", rc);
+    const char* sid = p_http->reply().get("SID");
+    uint64_t now = millis();
+    if (rc == 200 && sid != nullptr) {
+      if (!is_renewal) {
+        sub.sid = sid;
+        sub.next_seq = 0;
+      }
+      int timeout = parseTimeout(p_http->reply().get("TIMEOUT"),
+                                 sub.timeout_sec);
+      p_http->stop();
+      sub.expires = now + 1000ul * timeout;
+      sub.renew_time = now + 10ul * DLNA_SUBSCRIPTION_RENEW_PERCENT * timeout;
+      return true;
+    }
+    p_http->stop();
+    DLNA_LOG(DlnaWarning, "SUBSCRIBE %s failed: %d", sub.event_url.c_str(), rc);
+    if (is_renewal && rc == 412) {
+      // the device does not know the SID any more
+      sub.sid.reset();
+      return sendSubscribe(sub);
+    }
+    sub.renew_time = now + DLNA_SUBSCRIPTION_RETRY_MS;
+    return false;
+  }
+
+  bool sendUnsubscribe(DLNAEventSubscription& sub) {
+    if (p_http == nullptr || sub.sid.isEmpty()) return false;
+    Url url{sub.event_url.c_str()};
+    // an UNSUBSCRIBE has no NT, CALLBACK or TIMEOUT
+    p_http->request().clear();
+    p_http->request().put("SID", sub.sid.c_str());
+    int rc = p_http->unsubscribe(url);
+    p_http->stop();
+    return rc == 200;
+  }
+
+  void unsubscribeAll() {
+    for (auto& sub : subscriptions) sendUnsubscribe(sub);
+    subscriptions.clear();
+  }
+
+  /// Renews the due subscriptions: subscriptions which could not be renewed
+  /// before they expired are removed
+  void processSubscriptions() {
+    for (int j = subscriptions.size() - 1; j >= 0; j--) {
+      DLNAEventSubscription& sub = subscriptions[j];
+      if (millis() < sub.renew_time) continue;
+      if (!sendSubscribe(sub) && millis() > sub.expires) {
+        DLNA_LOG(DlnaWarning, "Subscription expired: %s",
+                 sub.service_id.c_str());
+        subscriptions.erase(j);
+      }
+    }
+  }
+
+  /// Determines the timeout from e.g. "Second-1800"
+  int parseTimeout(const char* timeout, int defaultSec) {
+    int result = 0;
+    if (timeout != nullptr && strncasecmp(timeout, "Second-", 7) == 0) {
+      result = atoi(timeout + 7);
+    }
+    return result > 0 ? result : defaultSec;
+  }
+
+  /// handles the NOTIFY requests
+  static void eventCallback(HttpServer* server, const char* requestPath,
+                            HttpRequestHandlerLine* hl) {
+    DLNAControlPointMgr* mgr = (DLNAControlPointMgr*)hl->context[0];
+    mgr->processNotify(*server);
+  }
+
+  void processNotify(HttpServer& server) {
+    HttpRequestHeader& req = server.requestHeader();
+    const char* nt = req.get("NT");
+    const char* nts = req.get("NTS");
+    const char* sid = req.get("SID");
+    if (nt == nullptr || nts == nullptr) {
+      server.reply(400, "Bad Request");
+      return;
+    }
+    int idx = -1;
+    for (int j = 0; j < subscriptions.size(); j++) {
+      if (sid != nullptr && subscriptions[j].sid.equals(sid)) idx = j;
+    }
+    if (idx < 0 || !StrView(nt).equals("upnp:event") ||
+        !StrView(nts).equals("upnp:propchange")) {
+      server.reply(412, "Precondition Failed");
+      return;
+    }
+    // check the event key
+    DLNAEventSubscription& sub = subscriptions[idx];
+    const char* seq_str = req.get("SEQ");
+    uint32_t seq = seq_str != nullptr ? strtoul(seq_str, nullptr, 10) : 0;
+    if (seq != sub.next_seq) {
+      DLNA_LOG(DlnaWarning, "Events lost: SEQ %lu instead of %lu",
+               (unsigned long)seq, (unsigned long)sub.next_seq);
+    }
+    sub.next_seq = seq == 0xFFFFFFFF ? 1 : seq + 1;
+
+    // parse the xml while we receive it
+    event_sub_idx = idx;
+    event_parser.begin(eventValueCallback, this);
+    server.readRequestData(event_parser);
+    event_sub_idx = -1;
+    server.replyOK();
+  }
+
+  /// updates the cached value of a received state variable
+  static void eventValueCallback(const char* name, const char* value,
+                                 void* ref) {
+    DLNAControlPointMgr* mgr = (DLNAControlPointMgr*)ref;
+    if (mgr->event_sub_idx < 0) return;
+    DLNAEventSubscription& sub = mgr->subscriptions[mgr->event_sub_idx];
+    StateValue* p_state = nullptr;
+    for (auto& st : sub.values) {
+      if (st.name.equals(name)) p_state = &st;
+    }
+    if (p_state == nullptr) {
+      StateValue st;
+      st.name = name;
+      sub.values.push_back(st);
+      p_state = &sub.values[sub.values.size() - 1];
+    } else if (p_state->value.equals(value)) {
+      return;
+    }
+    p_state->value = value;
+    if (mgr->event_callback != nullptr) {
+      mgr->event_callback(sub.service_id.c_str(), name, value,
+                          mgr->event_ref);
+    }
+  }
+
+  /// Adds the device at the indicated position to the indexes
+  void addIndex(int idx) {
+    DLNADevice& dev = devices[idx];
+    udn_index.add(dev.getUDN(), idx);
+    location_index.add(dev.getDeviceURL().url(), idx);
+    Vector<DLNAServiceInfo>& services = dev.getServices();
+    for (int j = 0; j < services.size(); j++) {
+      // a service type can be provided by multiple devices
+      service_type_index.add(services[j].service_type, idx, j);
+      const char* id = services[j].service_id;
+      if (id == nullptr) continue;
+      service_index.add(id, idx, j);
+      // e.g. SwitchPower for urn:upnp-org:serviceId:SwitchPower
+      const char* name = strrchr(id, ':');
+      if (name != nullptr && name[1] != 0) service_index.add(name + 1, idx, j);
+    }
+    resolveUrls(dev);
+  }
+
+  /// Resolves the absolute control and event urls of the services, so that
+  /// the actions do not need to build and parse them
+  void resolveUrls(DLNADevice& device) {
+    char url_buffer[200] = {0};
+    for (auto& service : device.getServices()) {
+      service.resolved_control_url.setUrl(
+          getUrl(device, service.control_url, url_buffer, 200));
+      service.resolved_event_sub_url.setUrl(
+          getUrl(device, service.event_sub_url, url_buffer, 200));
+    }
+  }
+
+  /// Provides the resolved control url of the service
+  Url& controlUrl(DLNAServiceInfo& service) {
+    if (!service.resolved_control_url) resolveUrls(getDevice(service));
+    return service.resolved_control_url;
+  }
+
+  /// Provides the resolved event subscription url of the service
+  Url& eventSubUrl(DLNAServiceInfo& service) {
+    if (!service.resolved_event_sub_url) resolveUrls(getDevice(service));
+    return service.resolved_event_sub_url;
+  }
+
+  /// Provides the service for a position in a service index
+  DLNAServiceInfo& serviceAt(HashIndex& index, int pos) {
+    DLNADevice& dev = devices[index.value(pos)];
+    return dev.getServices()[index.value2(pos)];
+  }
+
+  /// Provides the device for the device xml url: if it is not known yet,
+  /// the xml is requested and parsed. Returns nullptr if this failed.
+  DLNADevice* fetchDevice(Url& url) {
+    DLNADevice& device = getDevice(url);
+    if (&device != &NO_DEVICE) {
+      // device already exists
+      device.setActive(true);
+      device.setExpired(false);
+      device.updateTimestamp();
+      return &device;
+    }
+    // http get: we use the (potentially kept alive) connections of begin()
+    // and a local request if addDevice() is called before begin()
+    HttpRequest local_http;
+    HttpRequest& req = p_http != nullptr ? *p_http : local_http;
+    int rc = req.get(url, "text/xml");
+
+    if (rc != 200) {
+      DLNA_LOG(DlnaError, "Http get to '%s' failed with %d", url.url(),
+               rc);
+      req.stop();
+      return nullptr;
+    }
+    // parse the xml while we receive it
+    DLNADevice new_device;
+    XMLDeviceParser parser;
+    parser.begin(new_device, strings);
+    req.readReply(parser);
+    req.stop();
+
+    new_device.device_url = url;
+    DLNADevice& existing = getDeviceByUDN(new_device.getUDN());
+    if (&existing != &NO_DEVICE) {
+      // same device with a different location: the device has moved, so
+      // the new location is used for the lookup and the relative urls
+      existing.setBaseURL(new_device.getBaseURL());
+      existing.device_url = url;
+      rebuildIndex();
+      existing.setActive(true);
+      existing.setExpired(false);
+      existing.updateTimestamp();
+      return &existing;
+    }
+    new_device.updateTimestamp();
+    devices.push_back(new_device);
+    addIndex(devices.size() - 1);
+    return &devices[devices.size() - 1];
+  }
+
+  /// Processes all available UDP replies (up to DLNA_UDP_BATCH_SIZE): returns
+  /// true if we received some data
+  bool processUDP() {
+    int count = p_udp->receive(udp_batch, DLNA_UDP_BATCH_SIZE);
+    for (int j = 0; j < count; j++) {
+      Schedule* schedule = parser.parse(udp_batch[j]);
+      if (schedule != nullptr) {
+        // handle NotifyReplyCP
+        if (StrView(schedule->name()).equals("NotifyReplyCP")) {
+          NotifyReplyCP& notify_schedule = *(NotifyReplyCP*)schedule;
+          notify_schedule.callback = processDevice;
+        }
+        scheduler.add(schedule);
+      }
+    }
+    return count > 0;
+  }
 
   /// Processes a NotifyReplyCP message
   static bool processDevice(NotifyReplyCP& data) {
-    Str& nts = data.nts;
+    StrView& nts = data.nts;
     if (nts.equals("ssdp:byebye")) {
-      selfDLNAControlPoint->processBye(nts);
+      selfDLNAControlPoint->processBye(data.usn);
       return true;
     }
     if (nts.equals("ssdp:alive")) {
       bool select = selfDLNAControlPoint->matches(data.usn.c_str());
-      DlnaLogger.log(DlnaInfo, "addDevice: %s -> %s", data.usn.c_str(),
-                     select ? "added" : "filtered");
-      Url url{data.location.c_str()};
-      selfDLNAControlPoint->addDevice(url);
+      DLNA_LOG(DlnaInfo, "addDevice: %s -> %s", data.usn.c_str(),
+               select ? "added" : "filtered");
+      int max_age =
+          data.max_age > 0 ? data.max_age : DLNA_DEVICE_DEFAULT_MAX_AGE;
+      selfDLNAControlPoint->processAlive(data.location.c_str(), max_age);
       return true;
     }
     return false;
   }
 
+  /// A known device is updated, otherwise we request its device xml in the
+  /// next loop: so the multiple alive messages for the same location which
+  /// arrive before we have the device result in one request only
+  void processAlive(const char* location, int maxAge) {
+    Url url{location};
+    if (&getDevice(url) != &NO_DEVICE) {
+      // no http request needed: we just update the device
+      fetchDevice(url)->setMaxAge(maxAge);
+      return;
+    }
+    for (auto& pending : pending_locations) {
+      if (pending.location.equals(location)) {
+        pending.max_age = maxAge;
+        return;
+      }
+    }
+    if (isFailedLocation(location)) {
+      DLNA_LOG(DlnaDebug, "Ignoring failed location %s", location);
+      return;
+    }
+    PendingLocation pending;
+    pending.location = location;
+    pending.max_age = maxAge;
+    pending_locations.push_back(pending);
+  }
+
+  /// Requests the device xml for the first pending location
+  void processPendingLocation() {
+    if (pending_locations.size() == 0) return;
+    PendingLocation& pending = pending_locations[0];
+    Url url{pending.location.c_str()};
+    DLNADevice* p_device = fetchDevice(url);
+    if (p_device != nullptr) {
+      p_device->setMaxAge(pending.max_age);
+    } else {
+      addFailedLocation(pending.location.c_str());
+    }
+    pending_locations.erase(0);
+  }
+
+  /// Checks if the request for the location has failed recently
+  bool isFailedLocation(const char* location) {
+    for (int j = 0; j < failed_locations.size(); j++) {
+      FailedLocation& failed = failed_locations[j];
+      if (failed.location.equals(location)) {
+        if (millis() - failed.time < DLNA_DEVICE_RETRY_MS) return true;
+        // we try again
+        failed_locations.erase(j);
+        return false;
+      }
+    }
+    return false;
+  }
+
+  /// Remembers a location for which the request failed
+  void addFailedLocation(const char* location) {
+    if (failed_locations.size() >= DLNA_DEVICE_FAILED_SIZE) {
+      failed_locations.erase(0);
+    }
+    FailedLocation failed;
+    failed.location = location;
+    failed.time = millis();
+    failed_locations.push_back(failed);
+  }
+
   /// checks if the usn contains the search target
   bool matches(const char* usn) {
     if (StrView(search_target).equals("ssdp:all")) return true;
     return StrView(usn).contains(search_target);
   }
 
-  /// processes a bye-bye message
-  bool processBye(Str& usn) {
+  /// processes a bye-bye message: the device is marked as expired if it is
+  /// for the root device, otherwise we deactivate the service
+  bool processBye(StrView& usn) {
     for (auto& dev : devices) {
-      if (usn.startsWith(dev.getUDN())) {
-        for (auto& srv : dev.getServices()) {
+      if (dev.getUDN() == nullptr || !usn.startsWith(dev.getUDN())) continue;
+      if (usn.equals(dev.getUDN()) || usn.endsWith("upnp:rootdevice")) {
+        DLNA_LOG(DlnaInfo, "removeDevice: %s", usn.c_str());
+        dev.setExpired();
+        return true;
+      }
+      for (auto& srv : dev.getServices()) {
+        if (srv.service_type != nullptr && usn.endsWith(srv.service_type)) {
+          DLNA_LOG(DlnaInfo, "removeService: %s", usn.c_str());
           srv.is_active = false;
-          if (usn.endsWith(srv.service_type)) {
-            if (srv.is_active) {
-              DlnaLogger.log(DlnaInfo, "removeDevice: %s", usn);
-              srv.is_active = false;
-            }
-          }
         }
       }
     }
     return false;
   }
 
+  /// Processes the ExpireDevicesCP schedule
+  static bool processExpiry(ExpireDevicesCP& schedule) {
+    selfDLNAControlPoint->expireDevices();
+    return true;
+  }
+
   /**
    * Creates the Action Soap XML request. E.g
           "<?xml version=\"1.0\"?>\r\n"
@@ -335,34 +982,204 @@ version: locate service of a given type
 
   */
   size_t createXML(ActionRequest& action) {
-    size_t result = xml.printXMLHeader();
+    return createXML(action, soapTemplate(action));
+  }
+
+  size_t createXML(ActionRequest& action, SOAPTemplate& tmpl) {
+    size_t result = xml.print(tmpl.prefix.c_str());
+    for (auto& arg : action.arguments) {
+      result += xml.printNode(arg.name, arg.value.c_str());
+    }
+    result += xml.print(tmpl.suffix.c_str());
+    return result;
+  }
 
-    result += xml.printNodeBegin(
+  /// Provides the pre-rendered envelope for the service type and action: if
+  /// we have none yet, the oldest entry is replaced
+  SOAPTemplate& soapTemplate(ActionRequest& action) {
+    const char* service_type = action.getServiceType();
+    for (auto& tmpl : soap_templates) {
+      if (tmpl.action.equals(action.action) &&
+          tmpl.service_type.equals(service_type)) {
+        return tmpl;
+      }
+    }
+    if (soap_templates.size() < DLNA_SOAP_TEMPLATE_COUNT) {
+      soap_templates.push_back(SOAPTemplate());
+      soap_template_next = soap_templates.size() - 1;
+    }
+    SOAPTemplate& tmpl = soap_templates[soap_template_next];
+    soap_template_next = (soap_template_next + 1) % DLNA_SOAP_TEMPLATE_COUNT;
+    renderTemplate(tmpl, service_type, action.action);
+    return tmpl;
+  }
+
+  /// Renders the envelope w/o the arguments
+  void renderTemplate(SOAPTemplate& tmpl, const char* serviceType,
+                      const char* action) {
+    DLNA_LOG(DlnaDebug, "SOAP template %s#%s", serviceType, action);
+    tmpl.service_type = serviceType;
+    tmpl.action = action;
+
+    StrPrint out;
+    XMLPrinter printer(out);
+    printer.printXMLHeader();
+    printer.printNodeBegin(
         "Envelope",
         "xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\" "
         "s:encodingStyle=\"http://schemas.xmlsoap.org/soap/encoding/\"",
         "s");
-    result += xml.printNodeBegin("Body", nullptr, "s");
-
+    printer.printNodeBegin("Body", nullptr, "s");
     char ns[200];
-    StrView namespace_str(ns, 200);
-    namespace_str = "xmlns:u=\"%1\"";
-    bool ok = namespace_str.replace("%1", action.getServiceType());
-    DlnaLogger.log(DlnaDebug, "ns = '%s'", namespace_str.c_str());
-
-    // assert(ok);
-    result += xml.printNodeBegin(action.action, namespace_str.c_str(), "u");
-    for (auto arg : action.arguments) {
-      result += xml.printNode(arg.name, arg.value.c_str());
+    snprintf(ns, sizeof(ns), "xmlns:u=\"%s\"", serviceType);
+    printer.printNodeBegin(action, ns, "u");
+    tmpl.prefix = out.c_str();
+
+    out.reset();
+    printer.printNodeEnd(action, "u");
+    printer.printNodeEnd("Body", "s");
+    printer.printNodeEnd("Envelope", "s");
+    tmpl.suffix = out.c_str();
+
+    out.reset();
+    out.print("\"");
+    out.print(serviceType);
+    out.print("#");
+    out.print(action);
+    out.print("\"");
+    tmpl.soap_action = out.c_str();
+  }
+
+  /// Processing steps of an asynchronous action
+  enum AsyncActionState {
+    ACTION_CONNECT,
+    ACTION_SEND,
+    ACTION_HEADER,
+    ACTION_BODY
+  };
+
+  /// An action of executeActionsAsync()
+  struct AsyncAction {
+    ActionRequest action;
+    ActionCallback callback = nullptr;
+    void* ref = nullptr;
+    AsyncActionState state = ACTION_CONNECT;
+    // the reply is parsed while it is received
+    ActionReply reply;
+    XMLActionReplyParser reply_parser;
+    int rc = 0;
+    uint32_t start = 0;
+  };
+  Vector<AsyncAction*> async_actions;
+
+  /// Checks if the HttpRequest of begin() is used by an asynchronous action
+  bool isAsyncActionActive() {
+    return async_actions.size() > 0 &&
+           async_actions[0]->state != ACTION_CONNECT;
+  }
+
+  /// Advances the actual asynchronous action and reports it when it has
+  /// been completed
+  void processAsyncActions() {
+    if (async_actions.size() == 0) return;
+    AsyncAction* p_job = async_actions[0];
+    if (processAsyncAction(*p_job)) return;
+    // the action has been completed
+    if (p_http != nullptr) p_http->stop();
+    p_job->reply.setValid(p_job->rc == 200);
+    async_actions.erase(0);
+    if (p_job->callback != nullptr) {
+      p_job->callback(p_job->action, p_job->reply, p_job->ref);
     }
-    result += xml.printNodeEnd(action.action, "u");
+    delete p_job;
+  }
 
-    result += xml.printNodeEnd("Body", "s");
-    result += xml.printNodeEnd("Envelope", "s");
-    return result;
+  /// Executes the next step if the data is available: returns false when the
+  /// action has been completed
+  bool processAsyncAction(AsyncAction& job) {
+    if (p_http == nullptr) {
+      job.rc = -1;
+      return false;
+    }
+    if (job.state != ACTION_CONNECT &&
+        millis() - job.start > DLNA_ASYNC_ACTION_TIMEOUT) {
+      DLNA_LOG(DlnaError, "Action %s: timeout", job.action.action);
+      job.rc = -1;
+      return false;
+    }
+    HttpRequest& http = *p_http;
+    switch (job.state) {
+      case ACTION_CONNECT: {
+        // the connect of the Arduino Client API is blocking: so we do it in
+        // its own step
+        job.start = millis();
+        if (!http.open(controlUrl(*job.action.p_service))) {
+          DLNA_LOG(DlnaError, "Action %s: connect failed", job.action.action);
+          job.rc = -1;
+          return false;
+        }
+        job.state = ACTION_SEND;
+        return true;
+      }
+
+      case ACTION_SEND: {
+        Url& post_url = controlUrl(*job.action.p_service);
+        if (!sendAction(http, job.action, post_url, soap_body)) {
+          job.rc = -1;
+          return false;
+        }
+        job.reply_parser.begin(job.reply, reply_strings);
+        job.state = ACTION_HEADER;
+        return true;
+      }
+
+      case ACTION_HEADER:
+        // wait until we can read the reply header w/o blocking
+        if (!http.isReplyHeaderAvailable()) {
+          if (http.connected()) return true;
+          job.rc = -1;
+          return false;
+        }
+        job.rc = http.receive(T_POST);
+        DLNA_LOG(DlnaInfo, "==> http rc %d", job.rc);
+        // we do not need the data of a failed request
+        if (job.rc != 200) return false;
+        job.state = ACTION_BODY;
+        return true;
+
+      case ACTION_BODY: {
+        // read the available data
+        uint8_t buffer[256];
+        while (!http.isReplyComplete()) {
+          int len = 0;
+          if (http.available() > 0) len = http.read(buffer, sizeof(buffer));
+          if (len <= 0) {
+            if (http.connected()) return true;
+            break;
+          }
+          job.reply_parser.write(buffer, len);
+        }
+        return false;
+      }
+    }
+    return false;
   }
 
+  /// Actions for the same host which are pipelined on one connection
+  struct ActionPipeline {
+    HttpRequest http;
+    Str host;
+    int port = 0;
+    // indexes of the actions
+    Vector<int> indexes;
+    // number of actions which have been sent pipelined
+    int sent = 0;
+    // number of sent actions up to which we did not get any reply
+    int unanswered = 0;
+  };
+
   ActionReply postAllActions() {
+    if (is_pipelining && actions.size() > 1) return postAllActionsPipelined();
     ActionReply result;
     for (auto& action : actions) {
       if (action.getServiceType() != nullptr) result.add(postAction(action));
@@ -370,57 +1187,145 @@ version: locate service of a given type
     return result;
   }
 
+  /// Sends all requests before reading the replies: the actions for the same
+  /// host are pipelined on one connection, so the different hosts process
+  /// them concurrently. The replies are collected in the request sequence.
+  ActionReply postAllActionsPipelined() {
+    Vector<ActionPipeline*> pipelines;
+    Vector<ActionReply> replies;
+    replies.resize(actions.size());
+
+    // send the requests
+    for (int j = 0; j < actions.size(); j++) {
+      ActionRequest& action = actions[j];
+      if (action.getServiceType() == nullptr) continue;
+      Url& post_url = controlUrl(*action.p_service);
+      ActionPipeline& pipeline = getPipeline(pipelines, post_url);
+      pipeline.indexes.push_back(j);
+      // after a failure the remaining actions are posted one by one
+      if (pipeline.sent == pipeline.indexes.size() - 1 &&
+          sendAction(pipeline.http, action, post_url, soap_body)) {
+        pipeline.sent++;
+      }
+    }
+
+    // receive the replies
+    for (auto p_pipeline : pipelines) {
+      ActionPipeline& pipeline = *p_pipeline;
+      for (int k = 0; k < pipeline.indexes.size(); k++) {
+        int idx = pipeline.indexes[k];
+        if (k < pipeline.sent) {
+          replies[idx] = receiveAction(pipeline.http);
+          // the server did not accept the further requests
+          if (k + 1 < pipeline.sent &&
+              !pipeline.http.isConnectionReusable()) {
+            DLNA_LOG(DlnaWarning, "Pipelining not supported by %s",
+                     pipeline.host.c_str());
+            // with Connection: close the server does not process the further
+            // requests (RFC 9112 9.6): otherwise we can not know this
+            StrView con(pipeline.http.reply().get(CONNECTION));
+            if (!con.equalsIgnoreCase(CON_CLOSE)) {
+              pipeline.unanswered = pipeline.sent;
+            }
+            pipeline.http.stop();
+            pipeline.sent = k + 1;
+          }
+        } else if (k < pipeline.unanswered) {
+          // the action might have been executed: a POST is not idempotent,
+          // so we must not send it again
+          DLNA_LOG(DlnaError, "No reply for action %d", idx);
+          replies[idx] = ActionReply(false);
+        } else {
+          replies[idx] = postAction(actions[idx], pipeline.http);
+        }
+      }
+      pipeline.http.stop();
+      delete p_pipeline;
+    }
+
+    ActionReply result;
+    for (int j = 0; j < actions.size(); j++) {
+      if (actions[j].getServiceType() != nullptr) result.add(replies[j]);
+    }
+    return result;
+  }
+
+  /// Provides the pipeline for the host of the url
+  ActionPipeline& getPipeline(Vector<ActionPipeline*>& pipelines, Url& url) {
+    for (auto p_pipeline : pipelines) {
+      if (p_pipeline->port == url.port() && p_pipeline->host.equals(url.host()))
+        return *p_pipeline;
+    }
+    ActionPipeline* p_pipeline = new ActionPipeline();
+    p_pipeline->host = url.host();
+    p_pipeline->port = url.port();
+    if (p_http != nullptr) p_pipeline->http.copySettings(*p_http);
+    p_pipeline->http.setKeepAlive(true);
+    pipelines.push_back(p_pipeline);
+    return *p_pipeline;
+  }
+
   ActionReply postAction(ActionRequest& action) {
-    DLNAServiceInfo& service = *action.p_service;
-    DLNADevice& device = getDevice(service);
-
-    // create XML
-    StrPrint str_print;
-    xml.setOutput(str_print);
-    createXML(action);
-
-    // create SOAPACTION header
-    char act[200];
-    StrView action_str{act, 200};
-    action_str = "\"";
-    action_str.add(action.getServiceType());
-    action_str.add("#");
-    action_str.add(action.action);
-    action_str.add("\"");
-
-    p_http->request().put("SOAPACTION", action_str.c_str());
-
-    // crate control url
-    char url_buffer[200] = {0};
-    Url post_url{getUrl(device, service.control_url, url_buffer, 200)};
+    return postAction(action, *p_http);
+  }
+
+  ActionReply postAction(ActionRequest& action, HttpRequest& http) {
+    // create XML and SOAPACTION header
+    soap_body.reset();
+    prepareAction(http, action, soap_body);
+
+    // resolved control url
+    Url& post_url = controlUrl(*action.p_service);
 
     // post the request
-    int rc = p_http->post(post_url, "text/xml", str_print.c_str(),
-                          str_print.length());
+    int rc = http.post(post_url, "text/xml", soap_body.c_str(),
+                       soap_body.length());
 
     // check result
-    DlnaLogger.log(DlnaInfo, "==> http rc %d", rc);
+    DLNA_LOG(DlnaInfo, "==> http rc %d", rc);
     ActionReply result(rc == 200);
     if (rc != 200) {
-      p_http->stop();
+      http.stop();
       return result;
     }
 
     // log xml request
-    DlnaLogger.log(DlnaDebug, str_print.c_str());
+    DLNA_LOG(DlnaDebug, soap_body.c_str());
 
-    // receive result
-    str_print.reset();
-    uint8_t buffer[200];
-    while (p_http->client()->available()) {
-      int len = p_http->client()->read(buffer, 200);
-      str_print.write(buffer, len);
-    }
+    // receive and parse the result
+    XMLActionReplyParser reply_parser(result, reply_strings);
+    http.readReply(reply_parser);
+    http.stop();
 
-    // log result
-    DlnaLogger.log(DlnaDebug, str_print.c_str());
-    p_http->stop();
+    return result;
+  }
+
+  /// Creates the XML in the output and defines the SOAPACTION header
+  void prepareAction(HttpRequest& http, ActionRequest& action, Print& out) {
+    SOAPTemplate& tmpl = soapTemplate(action);
+    xml.setOutput(out);
+    createXML(action, tmpl);
+    http.request().put("SOAPACTION", tmpl.soap_action.c_str());
+  }
 
+  /// Sends the action request w/o waiting for the reply
+  bool sendAction(HttpRequest& http, ActionRequest& action, Url& url,
+                  StrPrint& str_print) {
+    str_print.reset();
+    prepareAction(http, action, str_print);
+    return http.send(T_POST, url, "text/xml", str_print.c_str(),
+                     str_print.length());
+  }
+
+  /// Reads the reply of a sent action
+  ActionReply receiveAction(HttpRequest& http) {
+    int rc = http.receive(T_POST);
+    DLNA_LOG(DlnaInfo, "==> http rc %d", rc);
+    ActionReply result(rc == 200);
+    // we need to consume the data also for errors to get to the next reply
+    XMLActionReplyParser reply_parser(result, reply_strings);
+    if (rc > 0) http.readReply(reply_parser);
+    if (rc != 200) result.arguments.clear();
     return result;
   }
 
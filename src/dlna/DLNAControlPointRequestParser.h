@@ -1,9 +1,20 @@
 #pragma once
 
 #include "IUDPService.h"
+#include "SSDPHeaderTokenizer.h"
 #include "Schedule.h"
 #include "Scheduler.h"
 
+// max number of NOTIFY messages which are waiting to be processed
+#ifndef DLNA_NOTIFY_REPLY_POOL_SIZE
+#define DLNA_NOTIFY_REPLY_POOL_SIZE 20
+#endif
+
+// max number of M-SEARCH replies which are waiting to be processed
+#ifndef DLNA_MSEARCH_REPLY_POOL_SIZE
+#define DLNA_MSEARCH_REPLY_POOL_SIZE 20
+#endif
+
 namespace tiny_dlna {
 
 /**
@@ -20,60 +31,133 @@ class DLNAControlPointRequestParser {
     } else if (req.data.startsWith("HTTP/1.1 200 OK")) {
       return parseMSearchReply(req);
     } else if (req.data.startsWith("M-SEARCH")) {
-      DlnaLogger.log(DlnaDebug, "M-SEARCH request ignored");
+      DLNA_LOG(DlnaDebug, "M-SEARCH request ignored");
     } else {
-      DlnaLogger.log(DlnaInfo, "Not handled: %s", req.data);
+      DLNA_LOG(DlnaInfo, "Not handled: %s", req.data);
     }
     return nullptr;
   }
 
+  /// Defines the search target which is used by the receive filter
+  void setSearchTarget(const char* target) { search_target = target; }
+
+  /// Receive filter for IUDPService: we ignore M-SEARCH requests and
+  /// notifications which do not match the search target
+  static bool filter(void* ref, const char* data, int len) {
+    return ((DLNAControlPointRequestParser*)ref)->isRelevant(data, len);
+  }
+
+  /// Quick check on the raw data w/o parsing
+  bool isRelevant(const char* data, int len) {
+    if (SSDPHeaderTokenizer::startsWith(data, len, "HTTP/1.1 200 OK")) {
+      return true;
+    }
+    if (!SSDPHeaderTokenizer::startsWith(data, len, "NOTIFY")) return false;
+    if (search_target == nullptr || StrView(search_target).equals("ssdp:all")) {
+      return true;
+    }
+    // the usn must contain the search target
+    const char* usn;
+    int usn_len;
+    if (!SSDPHeaderTokenizer::findValue(data, len, "USN", usn, usn_len)) {
+      return false;
+    }
+    int target_len = strlen(search_target);
+    for (int j = 0; j <= usn_len - target_len; j++) {
+      if (strncmp(usn + j, search_target, target_len) == 0) return true;
+    }
+    return false;
+  }
+
+  /// Number of requests that were dropped because the pool was full
+  uint32_t droppedCount() { return dropped_count; }
+
  protected:
-  MSearchReplyCP* parseMSearchReply(RequestData& req) {
-    MSearchReplyCP* result = new MSearchReplyCP();
-    parse(req.data, "LOCATION:", result->location);
-    parse(req.data, "USN:", result->usn);
-    parse(req.data, "ST:", result->search_target);
+  AllocatorPool msearch_pool{sizeof(MSearchReplyCP),
+                             DLNA_MSEARCH_REPLY_POOL_SIZE};
+  AllocatorPool notify_pool{sizeof(NotifyReplyCP), DLNA_NOTIFY_REPLY_POOL_SIZE};
+  uint32_t dropped_count = 0;
+  const char* search_target = nullptr;
+
+  /// Creates a new schedule from the pool: returns nullptr if the pool is
+  /// exhausted
+  template <class T>
+  T* create(AllocatorPool& pool) {
+    T* result = pool.create<T>();
+    if (result == nullptr) {
+      dropped_count++;
+      DLNA_LOG(DlnaWarning, "Pool exhausted: request dropped");
+      return nullptr;
+    }
+    result->p_allocator = &pool;
     return result;
   }
 
-  NotifyReplyCP* parseNotifyReply(RequestData& req) {
-    NotifyReplyCP* result = new NotifyReplyCP();
-    parse(req.data, "NOTIFY:", result->delivery_path);
-    parse(req.data, "NTS:", result->nts);
-    parse(req.data, "NT:", result->search_target);
-    parse(req.data, "Location:", result->location);
-    if (result->location.isEmpty()){
-      parse(req.data, "LOCATION:", result->location);
-    }
-    parse(req.data, "USN:", result->usn);
-    parse(req.data, "Host:", result->delivery_host_and_port);
-    if (result->delivery_host_and_port.isEmpty()){
-      parse(req.data, "HOST:", result->delivery_host_and_port);
+  /// determines the seconds from e.g. max-age=1800: returns 0 if not found
+  static int parseMaxAge(const char* value) {
+    if (value == nullptr) return 0;
+    for (const char* p = value; *p != 0; p++) {
+      if (strncasecmp(p, "max-age", 7) == 0) {
+        const char* eq = strchr(p + 7, '=');
+        return eq == nullptr ? 0 : atoi(eq + 1);
+      }
     }
+    return 0;
+  }
 
-    parse(req.data, "SID:", result->subscription_id);
-    parse(req.data, "SEQ:", result->event_key);
-    parse(req.data, "<e:propertyset", result->xml, "</e:propertyset>");
+  MSearchReplyCP* parseMSearchReply(RequestData& req) {
+    MSearchReplyCP* result = create<MSearchReplyCP>(msearch_pool);
+    if (result == nullptr) return nullptr;
+    // the schedule takes ownership of the datagram
+    result->data = std::move(req.data);
+    SSDPHeaderTokenizer tokenizer;
+    tokenizer.begin((char*)result->data.c_str(), result->data.length());
+    StrView key, value;
+    while (tokenizer.next(key, value)) {
+      if (key.equalsIgnoreCase("LOCATION")) {
+        result->location = value;
+      } else if (key.equalsIgnoreCase("USN")) {
+        result->usn = value;
+      } else if (key.equalsIgnoreCase("ST")) {
+        result->search_target = value;
+      } else if (key.equalsIgnoreCase("CACHE-CONTROL")) {
+        result->max_age = parseMaxAge(value.c_str());
+      }
+    }
     return result;
   }
 
-  bool parse(Str& in, const char* tag, Str& result, const char* end = "\r\n") {
-    result.clearAll();
-    int start_pos = in.indexOf(tag);
-    if (start_pos >= 0) {
-      int end_pos = in.indexOf(end, start_pos);
-      start_pos += strlen(tag);
-      if (end_pos < 0) end_pos = in.indexOf("\n", start_pos);
-      if (end_pos >= 0) {
-        result.substring(in.c_str(), start_pos, end_pos);
-        DlnaLogger.log(DlnaDebug, "%s substring (%d,%d)->%s", tag, start_pos, end_pos,
-                       result.c_str());
-
-        result.trim();
-        return true;
+  NotifyReplyCP* parseNotifyReply(RequestData& req) {
+    NotifyReplyCP* result = create<NotifyReplyCP>(notify_pool);
+    if (result == nullptr) return nullptr;
+    // the schedule takes ownership of the datagram
+    result->data = std::move(req.data);
+    SSDPHeaderTokenizer tokenizer;
+    tokenizer.begin((char*)result->data.c_str(), result->data.length());
+    result->delivery_path = tokenizer.path();
+    StrView key, value;
+    while (tokenizer.next(key, value)) {
+      if (key.equalsIgnoreCase("NTS")) {
+        result->nts = value;
+      } else if (key.equalsIgnoreCase("NT")) {
+        result->search_target = value;
+      } else if (key.equalsIgnoreCase("LOCATION")) {
+        result->location = value;
+      } else if (key.equalsIgnoreCase("USN")) {
+        result->usn = value;
+      } else if (key.equalsIgnoreCase("HOST")) {
+        result->delivery_host_and_port = value;
+      } else if (key.equalsIgnoreCase("SID")) {
+        result->subscription_id = value;
+      } else if (key.equalsIgnoreCase("SEQ")) {
+        result->event_key = value;
+      } else if (key.equalsIgnoreCase("CACHE-CONTROL")) {
+        result->max_age = parseMaxAge(value.c_str());
       }
     }
-    return false;
+    // e.g. <e:propertyset> of an event
+    result->xml = tokenizer.body();
+    return result;
   }
 };
 
@@ -1,8 +1,6 @@
 
 #pragma once
 
-#include <functional>  // std::bind
-
 #include "DLNAServiceInfo.h"
 #include "StringRegistry.h"
 #include "basic/Icon.h"
@@ -29,30 +27,77 @@ class DLNADevice {
   friend class DLNAControlPointMgr;
 
  public:
-  DLNADevice(bool ok = true) { is_active = true; }
-  ~DLNADevice() { DlnaLogger.log(DlnaDebug, "~DLNADevice()"); }
+  DLNADevice(bool ok = true) { is_active = ok; }
+  ~DLNADevice() { DLNA_LOG(DlnaDebug, "~DLNADevice()"); }
+  DLNADevice(DLNADevice&) = default;
+  DLNADevice(DLNADevice&&) = default;
+  DLNADevice& operator=(DLNADevice&) = default;
+  DLNADevice& operator=(DLNADevice&&) = default;
+
+  /// renders the device xml with the urls of another network interface
+  void print(Print& out, const char* baseURL) {
+    print_base_url = baseURL;
+    print(out);
+    print_base_url = nullptr;
+  }
 
   /// renderes the device xml
   void print(Print& out) {
     xml.setOutput(out);
-    xml.printXMLHeader();
-    auto printRootCb = std::bind(&DLNADevice::printRoot, this);
-    xml.printNode("root", printRootCb, ns);
+    static const XMLSkeleton device_skeleton[] = {
+        {"<?xml version=\"1.0\"?>\r\n<root", FIELD_NONE},
+        {nullptr, FIELD_NS},
+        {">\r\n<specVersion>\r\n", FIELD_NONE},
+        {"major", FIELD_VERSION_MAJOR},
+        {"minor", FIELD_VERSION_MINOR},
+        {"</specVersion>\r\n", FIELD_NONE},
+        {"URLBase", FIELD_BASE_URL},
+        {"<device>\r\n", FIELD_NONE},
+        {"deviceType", FIELD_DEVICE_TYPE},
+        {"friendlyName", FIELD_FRIENDLY_NAME},
+        {"manufacturer", FIELD_MANUFACTURER},
+        {"manufacturerURL", FIELD_MANUFACTURER_URL},
+        {"modelDescription", FIELD_MODEL_DESCRIPTION},
+        {"modelName", FIELD_MODEL_NAME},
+        {"modelNumber", FIELD_MODEL_NUMBER},
+        {"modelURL", FIELD_MODEL_URL},
+        {"serialNumber", FIELD_SERIAL_NUMBER},
+        {"UDN", FIELD_UDN},
+        {"UPC", FIELD_UPC},
+        {"<iconList>\r\n", FIELD_NONE},
+        {nullptr, FIELD_ICON_LIST},
+        {"</iconList>\r\n<serviceList>\r\n", FIELD_NONE},
+        {nullptr, FIELD_SERVICE_LIST},
+        {"</serviceList>\r\n</device>\r\n</root>\r\n", FIELD_NONE},
+    };
+    printSkeleton(device_skeleton,
+                  sizeof(device_skeleton) / sizeof(XMLSkeleton));
   }
 
   // sets the device type (ST or NT)
-  void setDeviceType(const char* st) { device_type = st; }
+  void setDeviceType(const char* st) {
+    device_type = st;
+    version++;
+  }
 
   const char* getDeviceType() { return device_type; }
 
   /// Define the udn uuid
-  void setUDN(const char* id) { udn = id; }
+  void setUDN(const char* id) {
+    udn = id;
+    version++;
+  }
 
   /// Provide the udn uuid
   const char* getUDN() { return udn; }
 
   /// Defines the base url
-  void setBaseURL(const char* url) { base_url = url; }
+  void setBaseURL(const char* url) {
+    base_url = url;
+    // the device url is derived from the base url
+    device_url.setUrl("");
+    version++;
+  }
 
   /// Provides the base url
   const char* getBaseURL() {
@@ -75,7 +120,10 @@ class DLNADevice {
     return device_url;
   }
 
-  void setIPAddress(IPAddress address) { localhost = address; }
+  void setIPAddress(IPAddress address) {
+    localhost = address;
+    version++;
+  }
 
   IPAddress getIPAddress() { return localhost; }
 
@@ -87,27 +135,57 @@ class DLNADevice {
     return result;
   }
 
-  void setNS(const char* ns) { this->ns = ns; }
+  void setNS(const char* ns) {
+    this->ns = ns;
+    version++;
+  }
   const char* getNS() { return ns; }
-  void setFriendlyName(const char* name) { friendly_name = name; }
+  void setFriendlyName(const char* name) {
+    friendly_name = name;
+    version++;
+  }
   const char* getFriendlyName() { return friendly_name; }
-  void setManufacturer(const char* man) { manufacturer = man; }
+  void setManufacturer(const char* man) {
+    manufacturer = man;
+    version++;
+  }
   const char* getManufacturer() { return manufacturer; }
-  void setManufacturerURL(const char* url) { manufacturer_url = url; }
+  void setManufacturerURL(const char* url) {
+    manufacturer_url = url;
+    version++;
+  }
   const char* getManufacturerURL() { return manufacturer_url; }
-  void setModelDescription(const char* descr) { model_description = descr; }
+  void setModelDescription(const char* descr) {
+    model_description = descr;
+    version++;
+  }
   const char* getModelDescription() { return model_description; }
-  void setModelName(const char* name) { model_name = name; }
+  void setModelName(const char* name) {
+    model_name = name;
+    version++;
+  }
   const char* getModelName() { return model_name; }
-  void setModelNumber(const char* number) { model_number = number; }
+  void setModelNumber(const char* number) {
+    model_number = number;
+    version++;
+  }
   const char* getModelNumber() { return model_number; }
-  void setSerialNumber(const char* sn) { serial_number = sn; }
+  void setSerialNumber(const char* sn) {
+    serial_number = sn;
+    version++;
+  }
   const char* getSerialNumber() { return serial_number; }
-  void setUniveralProductCode(const char* upc) { universal_product_code = upc; }
+  void setUniveralProductCode(const char* upc) {
+    universal_product_code = upc;
+    version++;
+  }
   const char* getUniveralProductCode() { return universal_product_code; }
 
   /// Adds a service defintion
-  void addService(DLNAServiceInfo s) { services.push_back(s); }
+  void addService(DLNAServiceInfo s) {
+    services.push_back(s);
+    version++;
+  }
 
   /// Finds a service definition by name
   DLNAServiceInfo& getService(const char* id) {
@@ -135,11 +213,18 @@ class DLNADevice {
     model_number = nullptr;
     serial_number = nullptr;
     universal_product_code = nullptr;
+    version++;
   }
 
   /// Overwrite the default icon
-  void clearIcons() { icons.clear(); }
-  void addIcon(Icon icon) { icons.push_back(icon); }
+  void clearIcons() {
+    icons.clear();
+    version++;
+  }
+  void addIcon(Icon icon) {
+    icons.push_back(icon);
+    version++;
+  }
   Icon getIcon(int idx = 0) { return icons[idx]; }
 
   operator bool() { return is_active; }
@@ -150,10 +235,36 @@ class DLNADevice {
   /// Returns the time when this object has been updated
   uint32_t getTimestamp() { return timestamp; }
 
+  /// Defines the seconds after the last update (e.g. from the CACHE-CONTROL
+  /// max-age) when the device expires: 0 means never
+  void setMaxAge(uint32_t sec) { max_age = sec; }
+
+  /// Marks the device as expired: e.g. after a ssdp:byebye
+  void setExpired(bool flag = true) {
+    is_expired = flag;
+    if (flag) is_active = false;
+  }
+
+  /// Checks if the max age has been exceeded
+  bool isExpired() {
+    if (is_expired) return true;
+    return max_age > 0 && millis() - timestamp > (uint64_t)max_age * 1000;
+  }
+
   void setActive(bool flag) { is_active = flag; }
 
+  /// Checks if the device is active: e.g. false after it has expired
+  bool isActive() { return is_active; }
+
+  /// Provides a counter which is incremented whenever the device definition
+  /// is changed: this can be used to invalidate cached data
+  uint32_t getVersion() { return version; }
+
  protected:
   uint64_t timestamp = 0;
+  uint32_t max_age = 0;
+  bool is_expired = false;
+  uint32_t version = 0;
   bool is_active = true;
   XMLPrinter xml;
   Url device_url;
@@ -161,6 +272,8 @@ class DLNADevice {
   int version_major = 1;
   int version_minor = 0;
   const char* base_url = "http://localhost:9876/dlna";
+  // base url which is used by print() instead of the base_url
+  const char* print_base_url = nullptr;
   const char* udn = "uuid:09349455-2941-4cf7-9847-0dd5ab210e97";
   const char* ns = "xmlns=\"urn:schemas-upnp-org:device-1-0\"";
   const char* device_type = nullptr;
@@ -177,97 +290,188 @@ class DLNADevice {
   Vector<DLNAServiceInfo> services;
   Vector<Icon> icons;
 
-  size_t printRoot() {
+  /// Variable parts of the device xml
+  enum XMLField : uint8_t {
+    FIELD_NONE,
+    FIELD_NS,
+    FIELD_VERSION_MAJOR,
+    FIELD_VERSION_MINOR,
+    FIELD_BASE_URL,
+    FIELD_DEVICE_TYPE,
+    FIELD_FRIENDLY_NAME,
+    FIELD_MANUFACTURER,
+    FIELD_MANUFACTURER_URL,
+    FIELD_MODEL_DESCRIPTION,
+    FIELD_MODEL_NAME,
+    FIELD_MODEL_NUMBER,
+    FIELD_MODEL_URL,
+    FIELD_SERIAL_NUMBER,
+    FIELD_UDN,
+    FIELD_UPC,
+    FIELD_ICON_LIST,
+    FIELD_SERVICE_LIST,
+    FIELD_SERVICE_TYPE,
+    FIELD_SERVICE_ID,
+    FIELD_SCPD_URL,
+    FIELD_CONTROL_URL,
+    FIELD_EVENT_SUB_URL,
+    FIELD_ICON_WIDTH,
+    FIELD_ICON_HEIGHT,
+    FIELD_ICON_DEPTH,
+    FIELD_ICON_URL,
+  };
+
+  /// Static xml fragment (FIELD_NONE) or node name with variable content.
+  /// The library is built with C++17 (CMAKE_CXX_STANDARD), but most of the
+  /// content (UDN, urls, names) is only known at runtime: so we use const
+  /// tables of literals (which stay in flash) instead of concatenating the
+  /// fragments with constexpr templates.
+  struct XMLSkeleton {
+    const char* text;
+    XMLField field;
+  };
+
+  /// Prints the static fragments and fills in the variable fields
+  size_t printSkeleton(const XMLSkeleton* skeleton, int len,
+                       DLNAServiceInfo* service = nullptr,
+                       Icon* icon = nullptr) {
     size_t result = 0;
-    auto printSpecVersionB = std::bind(&DLNADevice::printSpecVersion, this);
-    result += xml.printNode("specVersion", printSpecVersionB);
-    result += xml.printNode("URLBase", base_url);
-    auto printDeviceB = std::bind(&DLNADevice::printDevice, this);
-    result += xml.printNode("device", printDeviceB);
+    char buffer[DLNA_MAX_URL_LEN] = {0};
+    StrView tmp(buffer, DLNA_MAX_URL_LEN);
+    for (int j = 0; j < len; j++) {
+      const XMLSkeleton& entry = skeleton[j];
+      switch (entry.field) {
+        case FIELD_NONE:
+          result += xml.print(entry.text);
+          break;
+        case FIELD_NS:
+          if (ns != nullptr) {
+            result += xml.print(" ");
+            result += xml.print(ns);
+          }
+          break;
+        case FIELD_ICON_LIST:
+          result += printIconList();
+          break;
+        case FIELD_SERVICE_LIST:
+          result += printServiceList();
+          break;
+        default:
+          result += xml.printNode(entry.text,
+                                  fieldValue(entry.field, service, icon, tmp));
+          break;
+      }
+    }
     return result;
   }
 
-  size_t printDevice() {
-    size_t result = 0;
-    result += xml.printNode("deviceType", getDeviceType());
-    result += xml.printNode("friendlyName", friendly_name);
-    result += xml.printNode("manufacturer", manufacturer);
-    result += xml.printNode("manufacturerURL", manufacturer_url);
-    result += xml.printNode("modelDescription", model_description);
-    result += xml.printNode("modelName", model_name);
-    result += xml.printNode("modelNumber", model_number);
-    result += xml.printNode("modelURL", model_url);
-    result += xml.printNode("serialNumber", serial_number);
-    result += xml.printNode("UDN", getUDN());
-    result += xml.printNode("UPC", universal_product_code);
-    auto printIconListCb = std::bind(&DLNADevice::printIconList, this);
-    result += xml.printNode("iconList", printIconListCb);
-    auto printServiceListCb = std::bind(&DLNADevice::printServiceList, this);
-    result += xml.printNode("serviceList", printServiceListCb);
-    return result;
+  const char* printBaseURL() {
+    return print_base_url != nullptr ? print_base_url : base_url;
   }
 
-  size_t printSpecVersion() {
-    char major[5], minor[5];
-    sprintf(major, "%d", this->version_major);
-    sprintf(minor, "%d", this->version_minor);
-    return xml.printNode("major", major) + xml.printNode("minor", minor);
+  /// Provides the value of the indicated field
+  const char* fieldValue(XMLField field, DLNAServiceInfo* service, Icon* icon,
+                         StrView& tmp) {
+    switch (field) {
+      case FIELD_VERSION_MAJOR:
+        tmp = version_major;
+        return tmp.c_str();
+      case FIELD_VERSION_MINOR:
+        tmp = version_minor;
+        return tmp.c_str();
+      case FIELD_BASE_URL:
+        return printBaseURL();
+      case FIELD_DEVICE_TYPE:
+        return getDeviceType();
+      case FIELD_FRIENDLY_NAME:
+        return friendly_name;
+      case FIELD_MANUFACTURER:
+        return manufacturer;
+      case FIELD_MANUFACTURER_URL:
+        return manufacturer_url;
+      case FIELD_MODEL_DESCRIPTION:
+        return model_description;
+      case FIELD_MODEL_NAME:
+        return model_name;
+      case FIELD_MODEL_NUMBER:
+        return model_number;
+      case FIELD_MODEL_URL:
+        return model_url;
+      case FIELD_SERIAL_NUMBER:
+        return serial_number;
+      case FIELD_UDN:
+        return getUDN();
+      case FIELD_UPC:
+        return universal_product_code;
+      case FIELD_SERVICE_TYPE:
+        return service->service_type;
+      case FIELD_SERVICE_ID:
+        return service->service_id;
+      case FIELD_SCPD_URL:
+        return tmp.buildPath(printBaseURL(), service->scpd_url);
+      case FIELD_CONTROL_URL:
+        return tmp.buildPath(printBaseURL(), service->control_url);
+      case FIELD_EVENT_SUB_URL:
+        return tmp.buildPath(printBaseURL(), service->event_sub_url);
+      case FIELD_ICON_WIDTH:
+        tmp = icon->width;
+        return tmp.c_str();
+      case FIELD_ICON_HEIGHT:
+        tmp = icon->height;
+        return tmp.c_str();
+      case FIELD_ICON_DEPTH:
+        tmp = icon->depth;
+        return tmp.c_str();
+      case FIELD_ICON_URL:
+        return tmp.buildPath(printBaseURL(), icon->icon_url);
+      default:
+        return nullptr;
+    }
   }
 
   size_t printServiceList() {
+    static const XMLSkeleton service_skeleton[] = {
+        {"<service>\r\n", FIELD_NONE},
+        {"serviceType", FIELD_SERVICE_TYPE},
+        {"serviceId", FIELD_SERVICE_ID},
+        {"SCPDURL", FIELD_SCPD_URL},
+        {"controlURL", FIELD_CONTROL_URL},
+        {"eventSubURL", FIELD_EVENT_SUB_URL},
+        {"</service>\r\n", FIELD_NONE},
+    };
     size_t result = 0;
     for (auto& service : services) {
-      auto printServiceCb =
-          std::bind(&DLNADevice::printService, this, &service);
-      result += xml.printNode("service", printServiceCb);
+      result += printSkeleton(service_skeleton,
+                              sizeof(service_skeleton) / sizeof(XMLSkeleton),
+                              &service);
     }
     return result;
   }
 
-  size_t printService(void* srv) {
-    size_t result = 0;
-    char buffer[DLNA_MAX_URL_LEN] = {0};
-    StrView url(buffer, DLNA_MAX_URL_LEN);
-    DLNAServiceInfo* service = (DLNAServiceInfo*)srv;
-    result += xml.printNode("serviceType", service->service_type);
-    result += xml.printNode("serviceId", service->service_id);
-    result += xml.printNode("SCPDURL",
-                            url.buildPath(base_url, service->scpd_url));
-    result += xml.printNode(
-        "controlURL", url.buildPath(base_url, service->control_url));
-    result += xml.printNode(
-        "eventSubURL", url.buildPath(base_url, service->event_sub_url));
-    return result;
-  }
-
   size_t printIconList() {
+    static const XMLSkeleton icon_skeleton[] = {
+        {"<mimetype>image/png</mimetype>\r\n", FIELD_NONE},
+        {"width", FIELD_ICON_WIDTH},
+        {"height", FIELD_ICON_HEIGHT},
+        {"depth", FIELD_ICON_DEPTH},
+        {"url", FIELD_ICON_URL},
+    };
     // make sure we have at least the default icon
     Icon icon;
     if (icons.empty()) {
       icons.push_back(icon);
     }
-    int result = 0;
+    size_t result = 0;
 
     // print all icons
-    for (auto icon : icons) {
-      auto printIconDlnaInfoCb =
-          std::bind(&DLNADevice::printIconDlnaInfo, this, icon);
-      result += xml.printNode("icon", printIconDlnaInfoCb);
-    }
-    return result;
-  }
-
-  size_t printIconDlnaInfo(Icon& icon) {
-    size_t result = 0;
-    if (!StrView(icon.icon_url).isEmpty()) {
-      char buffer[DLNA_MAX_URL_LEN] = {0};
-      StrView url(buffer, DLNA_MAX_URL_LEN);
-      result += xml.printNode("mimetype", "image/png");
-      result += xml.printNode("width", icon.width);
-      result += xml.printNode("height", icon.height);
-      result += xml.printNode("depth", icon.depth);
-      result +=
-          xml.printNode("url", url.buildPath(base_url, icon.icon_url));
+    for (auto& icon : icons) {
+      result += xml.print("<icon>\r\n");
+      if (!StrView(icon.icon_url).isEmpty()) {
+        result += printSkeleton(icon_skeleton,
+                                sizeof(icon_skeleton) / sizeof(XMLSkeleton),
+                                nullptr, &icon);
+      }
+      result += xml.print("</icon>\r\n");
     }
     return result;
   }
@@ -1,14 +1,56 @@
 #pragma once
 
-#include "DLNADeviceMgr.h"
+#include "DLNAActionDispatcher.h"
 #include "DLNADevice.h"
 #include "DLNADeviceRequestParser.h"
+#include "DLNAInterface.h"
+#include "DLNASubscriptionMgr.h"
 #include "Schedule.h"
+#include "basic/StrPrint.h"
 #include "basic/Url.h"
 #include "http/HttpServer.h"
 
+#if defined(ESP32)
+#include "basic/QueueLockFree.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+// number of received UDP requests which can be handed over to the logic task
+#ifndef DLNA_WORKER_QUEUE_SIZE
+#define DLNA_WORKER_QUEUE_SIZE 20
+#endif
+
+#ifndef DLNA_WORKER_STACK_SIZE
+#define DLNA_WORKER_STACK_SIZE 8192
+#endif
+
+#ifndef DLNA_WORKER_PRIORITY
+#define DLNA_WORKER_PRIORITY 5
+#endif
+#endif
+
 namespace tiny_dlna {
 
+#if defined(ESP32)
+/**
+ * @brief Settings of the FreeRTOS tasks which are used by the worker mode of
+ * the DLNADeviceMgr
+ * @author Phil Schatzmann
+ */
+struct DLNAWorkerConfig {
+  /// network task: http server and UDP receive
+  uint32_t io_stack_size = DLNA_WORKER_STACK_SIZE;
+  UBaseType_t io_priority = DLNA_WORKER_PRIORITY;
+  BaseType_t io_core = 0;
+  /// logic task: parsing of the UDP requests and scheduler
+  uint32_t logic_stack_size = DLNA_WORKER_STACK_SIZE;
+  UBaseType_t logic_priority = DLNA_WORKER_PRIORITY;
+  BaseType_t logic_core = 1;
+  /// max time in ms the logic task waits for new requests
+  uint32_t max_wait_ms = 1000;
+};
+#endif
+
 /**
  * @brief Setup of a Basic DLNA Device service. The device registers itself to
  * the network and answers to the DLNA queries and requests. A DLNA device uses
@@ -22,62 +64,84 @@ namespace tiny_dlna {
  */
 class DLNADeviceMgr {
  public:
+  virtual ~DLNADeviceMgr() = default;
+
   /// start the
-  bool begin(DLNADevice& device, IUDPService& udp, HttpServer& server) {
-    DlnaLogger.log(DlnaInfo, "DLNADevice::begin");
+  virtual bool begin(DLNADevice& device, IUDPService& udp,
+                     HttpServer& server) {
+    DLNA_LOG(DlnaInfo, "DLNADevice::begin");
 
     p_server = &server;
     p_udp = &udp;
+    if (is_event_driven) p_server->setNoConnectDelay(0);
     setDevice(device);
-    setupParser();
 
     // check base url
     const char* baseUrl = device.getBaseURL();
-    DlnaLogger.log(DlnaInfo, "base URL: %s", baseUrl);
+    DLNA_LOG(DlnaInfo, "base URL: %s", baseUrl);
 
     if (StrView(device.getBaseURL()).contains("localhost")) {
-      DlnaLogger.log(DlnaError, "invalid base address: %s", baseUrl);
+      DLNA_LOG(DlnaError, "invalid base address: %s", baseUrl);
       return false;
     }
 
-    // setup all services
+    if (!setupInterfaces()) {
+      DLNA_LOG(DlnaError, "network interfaces failed");
+      return false;
+    }
+
+    // setup all services: this might define the udn and device type, so the
+    // parser must be set up afterwards
     setupServices(*p_device);
+    setupParser();
+    subscription_mgr.begin(*p_device);
+    if (is_device_xml_cache && !is_device_xml_lazy) updateDeviceXML();
 
     // setup web server
     if (!setupDLNAServer(server)) {
-      DlnaLogger.log(DlnaError, "setupDLNAServer failed");
+      DLNA_LOG(DlnaError, "setupDLNAServer failed");
       return false;
     }
 
     // start web server
     Url url{baseUrl};
     if (!p_server->begin(url.port())) {
-      DlnaLogger.log(DlnaError, "Server failed");
+      DLNA_LOG(DlnaError, "Server failed");
       return false;
     }
 
     // setup UDP
     if (!p_udp->begin(DLNABroadcastAddress)) {
-      DlnaLogger.log(DlnaError, "UDP begin failed");
+      DLNA_LOG(DlnaError, "UDP begin failed");
       return false;
     }
 
     if (!setupScheduler()) {
-      DlnaLogger.log(DlnaError, "Scheduler failed");
+      DLNA_LOG(DlnaError, "Scheduler failed");
       return false;
     }
 
     is_active = true;
-    DlnaLogger.log(DlnaInfo, "Device successfully started");
+#if defined(ESP32)
+    if (is_worker_mode && !startWorkers()) {
+      DLNA_LOG(DlnaError, "Worker tasks failed");
+      return false;
+    }
+#endif
+    DLNA_LOG(DlnaInfo, "Device successfully started");
     return true;
   }
 
   /// Stops the processing and releases the resources
-  void end() {
+  virtual void end() {
+#if defined(ESP32)
+    stopWorkers();
+#endif
     p_server->end();
 
     // send 3 bye messages
-    PostByeSchedule* bye = new PostByeSchedule(*p_device);
+    PostByeSchedule* bye = new PostByeSchedule(*p_device, ssdp_cache);
+    bye->setInterfaces(interfaces);
     bye->repeat_ms = 800;
     scheduler.add(bye);
 
@@ -87,26 +151,36 @@ class DLNADeviceMgr {
       scheduler.execute(*p_udp);
     }
 
+    subscription_mgr.end();
     is_active = false;
   }
 
   /// call this method in the Arduino loop as often as possible
-  bool loop() {
+  virtual bool loop() {
     if (!is_active) return false;
 
+#if defined(ESP32)
+    // all processing is done by the worker tasks
+    if (is_worker_mode) {
+      delay(max_wait_ms);
+      return true;
+    }
+#endif
+
+    updateDevice();
+
+    if (is_event_driven) {
+      loopEventDriven();
+      return true;
+    }
+
     // handle server requests
     bool rc = p_server->doLoop();
-    DlnaLogger.log(DlnaDebug, "server %s", rc ? "true" : "false");
+    DLNA_LOG(DlnaDebug, "server %s", rc ? "true" : "false");
 
     if (isSchedulerActive()) {
       // process UDP requests
-      RequestData req = p_udp->receive();
-      if (req) {
-        Schedule* schedule = parser.parse(*p_device, req);
-        if (schedule != nullptr) {
-          scheduler.add(schedule);
-        }
-      }
+      processUDP();
 
       // execute scheduled udp replys
       scheduler.execute(*p_udp);
@@ -118,6 +192,70 @@ class DLNADeviceMgr {
     return true;
   }
 
+  /// Activates the event driven loop: instead of a fixed delay we wait until
+  /// we receive a http or udp request or until the next schedule is due. The
+  /// waiting time is limited by maxWaitMs.
+  void setEventDrivenLoop(bool active, uint32_t maxWaitMs = 1000) {
+    is_event_driven = active;
+    max_wait_ms = maxWaitMs;
+    if (p_server != nullptr && active) p_server->setNoConnectDelay(0);
+  }
+
+#if defined(ESP32)
+  /// Activates the worker mode (call before begin): the network I/O (http
+  /// server and UDP receive) runs in a task on config.io_core and the received
+  /// UDP requests are handed over via a lock free queue to a task on
+  /// config.logic_core which parses them and runs the scheduler.
+  /// Synchronization: the http handlers (and therefore the device xml) run in
+  /// the I/O task, the parser, the Scheduler and the Schedules only in the
+  /// logic task. The QueueLockFree is the only shared state and the logic task
+  /// is woken up with a task notification. Both tasks use the IUDPService,
+  /// so it must support a concurrent send and receive (e.g. UDPAsyncService).
+  /// The GENA events are published by the I/O task: setStateValue() can be
+  /// called from any task since the values are protected by a mutex.
+  /// Changes to the device should be done before calling begin().
+  void setWorkerMode(bool active,
+                     DLNAWorkerConfig config = DLNAWorkerConfig()) {
+    is_worker_mode = active;
+    worker_config = config;
+  }
+
+  /// Number of UDP requests which were dropped because the queue was full
+  size_t workerDroppedCount() { return worker_dropped_count; }
+#endif
+
+  /// Adds a further network interface (e.g. Ethernet besides WiFi) with its
+  /// own multicast socket: the device is announced on each interface with a
+  /// LOCATION which uses the address of the interface and the M-SEARCH
+  /// replies are sent via the interface of the peer. The udp of begin() is
+  /// used for the address of the device. Call this method before begin().
+  void addInterface(IPAddress address, IUDPService& udp,
+                    IPAddress subnetMask = IPAddress(255, 255, 255, 0)) {
+    // the first entry is reserved for the default interface
+    if (interfaces.empty()) interfaces.push_back(DLNAInterface());
+    DLNAInterface net;
+    net.address = address;
+    net.subnet_mask = subnetMask;
+    net.p_udp = &udp;
+    interfaces.push_back(std::move(net));
+  }
+
+  /// Provides the number of network interfaces (0 if only the default
+  /// interface is used)
+  int interfaceCount() { return interfaces.size(); }
+
+  /// Updates an evented state variable of a service (e.g. "TransportState"):
+  /// the changes are combined and sent to the subscribers once per
+  /// moderation interval. Call this method from the task which calls loop():
+  /// in the ESP32 worker mode it can be called from any task.
+  bool setStateValue(const char* serviceId, const char* name,
+                     const char* value) {
+    return subscription_mgr.setValue(serviceId, name, value);
+  }
+
+  /// Provides the event subscriptions
+  DLNASubscriptionMgr& subscriptionMgr() { return subscription_mgr; }
+
   /// Provide addess to the service information
   DLNAServiceInfo getService(const char* id) {
     return p_device->getService(id);
@@ -136,18 +274,229 @@ class DLNADeviceMgr {
   /// before calling begin!
   void setPostAliveRepeatMs(uint32_t ms) { post_alive_repeat_ms = ms; }
 
+  /// Render the device xml only once into a buffer which is then served for
+  /// all requests. If lazy is false, the xml is already generated in begin().
+  /// The xml is rebuilt when the device has been modified. Call this method
+  /// before calling begin!
+  void setDeviceXMLCache(bool active, bool lazy = true) {
+    is_device_xml_cache = active;
+    is_device_xml_lazy = lazy;
+  }
+
  protected:
   Scheduler scheduler;
+  SSDPPacketCache ssdp_cache;
+  DLNASubscriptionMgr subscription_mgr;
+  DLNAActionDispatcher action_dispatcher;
   DLNADeviceRequestParser parser;
   IUDPService* p_udp = nullptr;
   DLNADevice* p_device = nullptr;
   HttpServer* p_server = nullptr;
   bool is_active = false;
   bool scheduler_active = true;
+  bool is_event_driven = false;
+  uint32_t max_wait_ms = 1000;
+  bool is_device_xml_cache = false;
+  bool is_device_xml_lazy = true;
+  bool is_device_xml_valid = false;
+  uint32_t device_xml_version = 0;
+  StrPrint device_xml{1024};
+  // received UDP packets: the buffers are reused
+  RequestData udp_batch[DLNA_UDP_BATCH_SIZE];
+  // network interfaces: the first entry is the default interface
+  Vector<DLNAInterface> interfaces;
+  int next_interface = 0;
   uint32_t post_alive_repeat_ms = 0;
+#if defined(ESP32)
+  bool is_worker_mode = false;
+  DLNAWorkerConfig worker_config;
+  QueueLockFree<RequestData>* p_worker_queue = nullptr;
+  TaskHandle_t io_task = nullptr;
+  TaskHandle_t logic_task = nullptr;
+  std::atomic<bool> is_worker_stop{false};
+  std::atomic<int> worker_count{0};
+  std::atomic<size_t> worker_dropped_count{0};
+
+  bool startWorkers() {
+    if (p_worker_queue == nullptr) {
+      p_worker_queue = new QueueLockFree<RequestData>(DLNA_WORKER_QUEUE_SIZE);
+    }
+    is_worker_stop = false;
+    p_server->setNoConnectDelay(0);
+    // start the consumer first, so that io_task can notify it
+    worker_count = 2;
+    if (xTaskCreatePinnedToCore(logicTaskFn, "dlna-logic",
+                                worker_config.logic_stack_size, this,
+                                worker_config.logic_priority, &logic_task,
+                                worker_config.logic_core) != pdPASS) {
+      worker_count = 0;
+      return false;
+    }
+    if (xTaskCreatePinnedToCore(ioTaskFn, "dlna-io",
+                                worker_config.io_stack_size, this,
+                                worker_config.io_priority, &io_task,
+                                worker_config.io_core) != pdPASS) {
+      worker_count = 1;
+      stopWorkers();
+      return false;
+    }
+    return true;
+  }
+
+  /// Requests the tasks to stop and waits until they have ended
+  void stopWorkers() {
+    if (worker_count == 0) return;
+    is_worker_stop = true;
+    if (logic_task != nullptr) xTaskNotifyGive(logic_task);
+    while (worker_count > 0) delay(10);
+    io_task = nullptr;
+    logic_task = nullptr;
+    p_worker_queue->clear();
+  }
+
+  /// Network I/O: http server and receive of UDP requests
+  static void ioTaskFn(void* ref) {
+    DLNADeviceMgr* self = (DLNADeviceMgr*)ref;
+    while (!self->is_worker_stop) {
+      bool is_busy = self->p_server->copy();
+      // the device state and the subscriptions are managed by the http
+      // handlers in this task
+      self->updateDevice();
+      self->subscription_mgr.publishIfDue();
+      int count = 0;
+      if (self->isSchedulerActive()) {
+        count = self->receiveUDP();
+        for (int j = 0; j < count; j++) {
+          if (!self->p_worker_queue->enqueue(std::move(self->udp_batch[j]))) {
+            self->worker_dropped_count++;
+          }
+        }
+        if (count > 0) xTaskNotifyGive(self->logic_task);
+      }
+      // give other tasks a chance
+      if (!is_busy && count == 0) delay(1);
+    }
+    self->worker_count--;
+    vTaskDelete(nullptr);
+  }
+
+  /// DLNA logic: parsing of the UDP requests and execution of the schedules
+  static void logicTaskFn(void* ref) {
+    DLNADeviceMgr* self = (DLNADeviceMgr*)ref;
+    RequestData req;
+    while (!self->is_worker_stop) {
+      while (self->p_worker_queue->dequeue(req)) {
+        Schedule* schedule = self->parser.parse(*self->p_device, req);
+        if (schedule != nullptr) self->scheduler.add(schedule);
+      }
+      uint32_t wait_ms = self->worker_config.max_wait_ms;
+      if (self->isSchedulerActive()) {
+        self->scheduler.execute(*self->p_udp);
+        wait_ms = self->scheduler.timeToNext(wait_ms);
+      }
+      // wait for the next request or due schedule
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait_ms));
+    }
+    self->worker_count--;
+    vTaskDelete(nullptr);
+  }
+#endif
 
   void setDevice(DLNADevice& device) { p_device = &device; }
 
+  /// Processes all available UDP requests (up to DLNA_UDP_BATCH_SIZE):
+  /// returns true if we received some data
+  bool processUDP() {
+    int count = receiveUDP();
+    for (int j = 0; j < count; j++) {
+      Schedule* schedule = parser.parse(*p_device, udp_batch[j]);
+      if (schedule != nullptr) {
+        scheduler.add(schedule);
+      }
+    }
+    return count > 0;
+  }
+
+  /// Receives the UDP requests of all interfaces into the udp_batch (up to
+  /// DLNA_UDP_BATCH_SIZE): returns the number of received requests
+  int receiveUDP() {
+    if (interfaces.empty()) {
+      return p_udp->receive(udp_batch, DLNA_UDP_BATCH_SIZE);
+    }
+    // we start with a different interface each time, so that a busy network
+    // does not block the others
+    int count = 0;
+    int size = interfaces.size();
+    for (int j = 0; j < size && count < DLNA_UDP_BATCH_SIZE; j++) {
+      DLNAInterface& net = interfaces[(next_interface + j) % size];
+      int n = net.p_udp->receive(udp_batch + count, DLNA_UDP_BATCH_SIZE - count);
+      for (int k = count; k < count + n; k++) {
+        udp_batch[k].p_interface = replyInterface(udp_batch[k].peer, net);
+      }
+      count += n;
+    }
+    next_interface = (next_interface + 1) % size;
+    return count;
+  }
+
+  /// Determines the interface which is on the network of the peer: if the
+  /// same request is received on several interfaces, the parser ignores the
+  /// repeated requests
+  DLNAInterface* replyInterface(IPAddressAndPort& peer, DLNAInterface& net) {
+    for (auto& candidate : interfaces) {
+      if (candidate.isLocal(peer.address)) return &candidate;
+    }
+    return &net;
+  }
+
+  /// Determines the urls of the network interfaces and starts their UDP
+  bool setupInterfaces() {
+    if (interfaces.empty()) return true;
+    // default interface: uses the urls of the device
+    DLNAInterface& primary = interfaces[0];
+    primary.address = p_device->getIPAddress();
+    primary.p_udp = p_udp;
+    primary.base_url = p_device->getBaseURL();
+    primary.location = p_device->getDeviceURL().url();
+    primary.ssdp_cache.setLocation(primary.location.c_str());
+    for (int j = 1; j < interfaces.size(); j++) {
+      DLNAInterface& net = interfaces[j];
+      net.setup(*p_device);
+      DLNA_LOG(DlnaInfo, "interface %s: %s", toStr(net.address),
+               net.location.c_str());
+      net.p_udp->setReceiveFilter(DLNADeviceRequestParser::filter, &parser);
+      if (!net.p_udp->begin(DLNABroadcastAddress)) return false;
+    }
+    return true;
+  }
+
+  /// Provides the interface which received the http request (from the Host
+  /// header) or nullptr
+  DLNAInterface* findInterface(HttpServer& server) {
+    const char* host = server.requestHost();
+    for (auto& net : interfaces) {
+      if (net.isHost(host)) return &net;
+    }
+    return nullptr;
+  }
+
+  /// Waits for the next request or due schedule and processes it
+  void loopEventDriven() {
+    uint32_t wait_ms = isSchedulerActive()
+                           ? scheduler.timeToNext(max_wait_ms)
+                           : max_wait_ms;
+    uint64_t end = millis() + wait_ms;
+    while (true) {
+      bool is_busy = p_server->copy();
+      if (isSchedulerActive() && processUDP()) is_busy = true;
+      if (is_busy || millis() >= end) break;
+      // give other tasks a chance
+      delay(1);
+    }
+    // execute scheduled udp replys
+    if (isSchedulerActive()) scheduler.execute(*p_udp);
+  }
+
   /// MSearch requests reply to upnp:rootdevice and the device type defined in
   /// the device
   bool setupParser() {
@@ -155,6 +504,8 @@ class DLNADeviceMgr {
     parser.addMSearchST("ssdp:all");
     parser.addMSearchST(p_device->getUDN());
     parser.addMSearchST(p_device->getDeviceType());
+    // discard irrelevant UDP traffic before it is parsed
+    p_udp->setReceiveFilter(DLNADeviceRequestParser::filter, &parser);
     return true;
   }
 
@@ -163,15 +514,26 @@ class DLNADeviceMgr {
     // schedule post alive messages: Usually repeated 2 times (because UDP
     // messages might be lost)
     PostAliveSchedule* postAlive =
-        new PostAliveSchedule(*p_device, post_alive_repeat_ms);
+        new PostAliveSchedule(*p_device, ssdp_cache, post_alive_repeat_ms);
     PostAliveSchedule* postAlive1 =
-        new PostAliveSchedule(*p_device, post_alive_repeat_ms);
+        new PostAliveSchedule(*p_device, ssdp_cache, post_alive_repeat_ms);
     postAlive1->time = millis() + 100;
+    postAlive->setInterfaces(interfaces);
+    postAlive1->setInterfaces(interfaces);
     scheduler.add(postAlive);
     scheduler.add(postAlive1);
+#if defined(ESP32)
+    // in the worker mode the events are published by the io task
+    if (is_worker_mode) return true;
+#endif
+    scheduler.add(new EventNotifySchedule(subscription_mgr));
     return true;
   }
 
+  /// Called by loop() and in the ESP32 worker mode by the I/O task (which
+  /// also executes the http handlers): overwrite to update the device state
+  virtual void updateDevice() {}
+
   /// set up Web Server to handle Service Addresses
   virtual bool setupDLNAServer(HttpServer& srv) {
     char buffer[DLNA_MAX_URL_LEN] = {0};
@@ -181,14 +543,15 @@ class DLNADeviceMgr {
     const char* device_path = p_device->getDeviceURL().path();
     const char* prefix = p_device->getBaseURL();
 
-    DlnaLogger.log(DlnaInfo, "Setting up device path: %s", device_path);
+    DLNA_LOG(DlnaInfo, "Setting up device path: %s", device_path);
     void* ref[] = {p_device};
+    void* device_ref[] = {p_device, this};
 
     if (!StrView(device_path).isEmpty()) {
       p_server->rewrite("/", device_path);
       p_server->rewrite("/dlna/device.xml", device_path);
       p_server->rewrite("/index.html", device_path);
-      p_server->on(device_path, T_GET, deviceXMLCallback, ref, 1);
+      p_server->on(device_path, T_GET, deviceXMLCallback, device_ref, 2);
     }
 
     // Register icon and privide favicon.ico
@@ -206,34 +569,64 @@ class DLNADeviceMgr {
     for (DLNAServiceInfo& service : p_device->getServices()) {
       p_server->on(url.buildPath(prefix, service.scpd_url), T_GET,
                    service.scp_cb, ref, 1);
-      p_server->on(url.buildPath(prefix, service.control_url), T_POST,
-                   service.control_cb, ref, 1);
-      p_server->on(url.buildPath(prefix, service.event_sub_url), T_GET,
-                   service.event_sub_cb, ref, 1);
+      if (service.control_cb != nullptr) {
+        p_server->on(url.buildPath(prefix, service.control_url), T_POST,
+                     service.control_cb, ref, 1);
+      }
+      if (service.event_sub_cb != nullptr) {
+        p_server->on(url.buildPath(prefix, service.event_sub_url), T_GET,
+                     service.event_sub_cb, ref, 1);
+      }
     }
 
+    // SOAP actions of the services with an action table
+    action_dispatcher.setupServer(*p_server, *p_device, prefix);
+
+    // SUBSCRIBE and UNSUBSCRIBE of the service events
+    subscription_mgr.setupServer(*p_server, prefix);
+
     return true;
   }
 
+  /// renders the device xml into the cache if it is missing or outdated
+  void updateDeviceXML() {
+    if (is_device_xml_valid && device_xml_version == p_device->getVersion()) {
+      return;
+    }
+    DLNA_LOG(DlnaInfo, "Rendering %s", "DeviceXML");
+    device_xml.reset();
+    p_device->print(device_xml);
+    device_xml_version = p_device->getVersion();
+    is_device_xml_valid = true;
+  }
+
   /// callback to provide device XML
   static void deviceXMLCallback(HttpServer* server, const char* requestPath,
                                 HttpRequestHandlerLine* hl) {
     DLNADevice* device_xml = (DLNADevice*)(hl->context[0]);
+    DLNADeviceMgr* mgr =
+        hl->contextCount > 1 ? (DLNADeviceMgr*)(hl->context[1]) : nullptr;
     assert(device_xml != nullptr);
-    if (device_xml != nullptr) {
-      Client& client = server->client();
-      assert(&client != nullptr);
-      DlnaLogger.log(DlnaInfo, "reply %s", "DeviceXML");
-      server->replyHeader().setValues(200, "SUCCESS");
-      server->replyHeader().put(CONTENT_TYPE, "text/xml");
-      server->replyHeader().put(CONNECTION, CON_KEEP_ALIVE);
-      server->replyHeader().write(client);
-
-      // print xml result
-      device_xml->print(client);
+    // a further interface uses its own urls
+    DLNAInterface* net =
+        mgr != nullptr ? mgr->findInterface(*server) : nullptr;
+    if (net != nullptr && net != &mgr->interfaces[0]) {
+      DLNA_LOG(DlnaInfo, "reply %s for %s", "DeviceXML", toStr(net->address));
+      device_xml->print(server->replyPrint("text/xml"), net->base_url.c_str());
+      server->endClient();
+    } else if (mgr != nullptr && mgr->is_device_xml_cache) {
+      // reply from the cache with content length
+      DLNA_LOG(DlnaInfo, "reply %s", "DeviceXML (cached)");
+      mgr->updateDeviceXML();
+      server->reply("text/xml", (const uint8_t*)mgr->device_xml.c_str(),
+                    mgr->device_xml.length());
+    } else if (device_xml != nullptr) {
+      DLNA_LOG(DlnaInfo, "reply %s", "DeviceXML");
+      // print xml result: buffered in MSS sized chunks
+      device_xml->print(server->replyPrint("text/xml"));
       server->endClient();
     } else {
-      DlnaLogger.log(DlnaError, "DLNADevice is null");
+      DLNA_LOG(DlnaError, "DLNADevice is null");
       server->replyNotFound();
     }
   }
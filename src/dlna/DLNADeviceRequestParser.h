@@ -1,102 +1,268 @@
 #pragma once
 
 #include "IUDPService.h"
+#include "SSDPHeaderTokenizer.h"
 #include "Scheduler.h"
 #include "DLNAControlPointMgr.h"
 
+#ifndef DLNA_MSEARCH_REPLY_POOL_SIZE
+#define DLNA_MSEARCH_REPLY_POOL_SIZE 20
+#endif
+
+// max number of MSearch replies which can be scheduled in a row for a peer
+#ifndef DLNA_MSEARCH_PEER_BURST
+#define DLNA_MSEARCH_PEER_BURST 4
+#endif
+
+// ms after which a peer can get an additional MSearch reply
+#ifndef DLNA_MSEARCH_PEER_REFILL_MS
+#define DLNA_MSEARCH_PEER_REFILL_MS 1000
+#endif
+
+// max number of peers for which we keep track of the MSearch replies
+#ifndef DLNA_MSEARCH_PEER_SIZE
+#define DLNA_MSEARCH_PEER_SIZE 10
+#endif
+
 namespace tiny_dlna {
 
 /**
  * @brief Translates DLNA UDP Requests to Schedule so that we
- * can schedule a reply
+ * can schedule a reply. Repeated M-SEARCH requests for a reply which is
+ * still pending are ignored and the number of replies per peer is limited
+ * by a token bucket.
  * @author Phil Schatzmann
  */
 
 class DLNADeviceRequestParser {
  public:
-  // add ST that we consider as valid for the actual device
-  void addMSearchST(const char* accept) { mx_vector.push_back(accept); }
+  /// add ST that we consider as valid for the actual device: undefined values
+  /// (e.g. the UDN before setupServices()) are ignored
+  void addMSearchST(const char* accept) {
+    if (accept == nullptr || *accept == 0) return;
+    mx_vector.push_back(accept);
+  }
 
   Schedule* parse(DLNADevice& device, RequestData& req) {
     p_device = &device;
-    Schedule result;
-    if (req.data.contains("M-SEARCH")) {
+    if (req.data.startsWith("M-SEARCH")) {
       return processMSearch(req);
     }
 
     // We ignore alive notifications
     if (req.data.contains("NOTIFY")) {
       if (req.data.contains("ssdp:alive")) {
-        DlnaLogger.log(DlnaDebug, "invalid request: %s", req.data.c_str());
+        DLNA_LOG(DlnaDebug, "invalid request: %s", req.data.c_str());
       } else {
-        DlnaLogger.log(DlnaWarning, "invalid request: %s", req.data.c_str());
+        DLNA_LOG(DlnaWarning, "invalid request: %s", req.data.c_str());
       }
       return nullptr;
     }
 
     // We currently
-    DlnaLogger.log(DlnaWarning, "invalid request: %s", req.data.c_str());
+    DLNA_LOG(DlnaWarning, "invalid request: %s", req.data.c_str());
 
     return nullptr;
   }
 
+  /// Receive filter for IUDPService: we only accept M-SEARCH requests with a
+  /// relevant ST
+  static bool filter(void* ref, const char* data, int len) {
+    return ((DLNADeviceRequestParser*)ref)->isRelevant(data, len);
+  }
+
+  /// Quick check on the raw data w/o parsing
+  bool isRelevant(const char* data, int len) {
+    if (!SSDPHeaderTokenizer::startsWith(data, len, "M-SEARCH")) return false;
+    const char* st;
+    int st_len;
+    if (!SSDPHeaderTokenizer::findValue(data, len, "ST", st, st_len)) {
+      return false;
+    }
+    for (auto accept : mx_vector) {
+      if ((int)strlen(accept) == st_len && strncmp(accept, st, st_len) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Number of MSearch replies that were dropped because the pool was full
+  /// or because the peer has exceeded its rate
+  uint32_t droppedCount() { return dropped_count; }
+
+  /// Number of MSearch requests which were covered by a pending reply
+  uint32_t coalescedCount() { return coalesced_count; }
+
  protected:
+  /// MSearch reply which has been scheduled but is not sent yet
+  struct PendingReply {
+    IPAddressAndPort peer;
+    const char* search_target = nullptr;
+    uint64_t time = 0;
+  };
+  /// token bucket of a peer
+  struct PeerBucket {
+    IPAddress address;
+    int tokens = 0;
+    uint64_t last_refill = 0;
+  };
   Vector<const char*> mx_vector;
   DLNADevice* p_device = nullptr;
+  AllocatorPool reply_pool{sizeof(MSearchReplySchedule),
+                           DLNA_MSEARCH_REPLY_POOL_SIZE};
+  Vector<PendingReply> pending_replies;
+  Vector<PeerBucket> peer_buckets;
+  uint32_t dropped_count = 0;
+  uint32_t coalesced_count = 0;
 
   Schedule* processMSearch(RequestData& req) {
     assert(p_device != nullptr);
-    MSearchReplySchedule& result =
-        *new MSearchReplySchedule{*p_device, req.peer};
-    char tmp[200];
-    StrView tmp_str(tmp, 200);
+    int mx = 0;
+    const char* search_target = nullptr;
+    bool has_st = false;
 
-    DlnaLogger.log(DlnaInfo, "Parsing MSSearch");
+    DLNA_LOG(DlnaInfo, "Parsing MSSearch");
 
-    // determine MX (seconds to delay response)
-    if (parse(req.data, "\nMX:", tmp_str)) {
-      result.mx = tmp_str.toInt();
+    // single pass over the header: the request data is split in place
+    SSDPHeaderTokenizer tokenizer((char*)req.data.c_str(), req.data.length());
+    StrView key, value;
+    while (tokenizer.next(key, value)) {
+      if (key.equalsIgnoreCase("MX")) {
+        // determine MX (seconds to delay response)
+        mx = value.toInt();
+      } else if (key.equalsIgnoreCase("ST")) {
+        has_st = true;
+        search_target = findST(value);
+        if (search_target == nullptr) {
+          DLNA_LOG(DlnaDebug, "MX: %s not relevant", value.c_str());
+        }
+      }
     }
-    result.time = millis() + random(result.mx * 1000);
 
-    if (parse(req.data, "\nST:", tmp_str)) {
-      result.search_target = tmp;
+    if (!has_st) {
+      DLNA_LOG(DlnaError, "ST: not found");
+      return nullptr;
+    }
+    if (search_target == nullptr) return nullptr;
 
-      // determine ST if relevant for us
-      for (auto mx : mx_vector) {
-        if (result.search_target.equals(mx)) {
-          DlnaLogger.log(DlnaDebug, "MX: %s -> relevant", mx);
-          result.active = true;
-        }
-      }
-      if (!result.active) {
-        DlnaLogger.log(DlnaDebug, "MX: %s not relevant", tmp);
-      }
+    if (isPending(req.peer, search_target)) {
+      coalesced_count++;
+      DLNA_LOG(DlnaDebug, "MSearch %s from %s already scheduled",
+               search_target, req.peer.toString());
+      return nullptr;
+    }
+    if (!takeToken(req.peer.address)) {
+      dropped_count++;
+      DlnaMetrics.add(CNT_MSEARCH_DROPPED);
+      DLNA_LOG(DlnaWarning, "MSearch from %s: rate exceeded",
+               req.peer.toString());
+      return nullptr;
+    }
+
+    // we do not fall back to the heap if the pool is exhausted
+    MSearchReplySchedule* p_result =
+        reply_pool.create<MSearchReplySchedule>(*p_device, req.peer);
+    if (p_result == nullptr) {
+      dropped_count++;
+      DlnaMetrics.add(CNT_MSEARCH_DROPPED);
+      DLNA_LOG(DlnaWarning, "MSearch from %s dropped",
+               req.peer.toString());
+      return nullptr;
+    }
+    p_result->p_allocator = &reply_pool;
+    p_result->mx = mx;
+    p_result->time = millis() + random(mx * 1000);
+    p_result->search_target = search_target;
+    p_result->p_interface = req.p_interface;
+    p_result->active = true;
+    addPending(req.peer, search_target, p_result->time);
+    return p_result;
+  }
 
-    } else {
-      DlnaLogger.log(DlnaError, "ST: not found");
+  /// Checks if we have already scheduled a reply for the peer which covers
+  /// the search target: the entries which are due are removed
+  bool isPending(IPAddressAndPort& peer, const char* searchTarget) {
+    uint64_t now = millis();
+    bool result = false;
+    for (int j = pending_replies.size() - 1; j >= 0; j--) {
+      PendingReply& pending = pending_replies[j];
+      if (pending.time < now) {
+        pending_replies.erase(j);
+      } else if (pending.peer.address == peer.address &&
+                 pending.peer.port == peer.port &&
+                 (pending.search_target == searchTarget ||
+                  StrView(pending.search_target).equals("ssdp:all"))) {
+        // search targets are pointing to the registered values
+        result = true;
+      }
     }
+    return result;
+  }
 
-    return result.active ? &result : nullptr;
+  void addPending(IPAddressAndPort& peer, const char* searchTarget,
+                  uint64_t time) {
+    if (pending_replies.size() >= DLNA_MSEARCH_REPLY_POOL_SIZE) return;
+    PendingReply pending;
+    pending.peer = peer;
+    pending.search_target = searchTarget;
+    pending.time = time;
+    pending_replies.push_back(pending);
   }
 
-  bool parse(Str& in, const char* tag, StrView& result) {
-    result.clearAll();
-    int start = in.indexOf(tag);
-    if (start >= 0) {
-      start += strlen(tag);
-      int end = in.indexOf("\r\n", start);
-      if (end < 0) end = in.indexOf("\n", start);
-      if (end >= 0) {
-        result.substring(in.c_str(), start, end);
-        DlnaLogger.log(DlnaDebug, "%s substring (%d,%d)->%s", tag, start, end,
-                       result.c_str());
-
-        result.trim();
-        return true;
+  /// Consumes a token of the peer: returns false if there is none left
+  bool takeToken(IPAddress& address) {
+    uint64_t now = millis();
+    PeerBucket* p_bucket = nullptr;
+    int oldest = 0;
+    for (int j = 0; j < peer_buckets.size(); j++) {
+      if (peer_buckets[j].address == address) {
+        p_bucket = &peer_buckets[j];
+        break;
+      }
+      if (peer_buckets[j].last_refill < peer_buckets[oldest].last_refill) {
+        oldest = j;
       }
     }
-    return false;
+    if (p_bucket == nullptr) {
+      // new peer: we replace the least recently used one if we are full
+      PeerBucket bucket;
+      bucket.address = address;
+      bucket.tokens = DLNA_MSEARCH_PEER_BURST;
+      bucket.last_refill = now;
+      if (peer_buckets.size() >= DLNA_MSEARCH_PEER_SIZE) {
+        peer_buckets[oldest] = bucket;
+        p_bucket = &peer_buckets[oldest];
+      } else {
+        peer_buckets.push_back(bucket);
+        p_bucket = &peer_buckets[peer_buckets.size() - 1];
+      }
+    }
+    // refill
+    PeerBucket& bucket = *p_bucket;
+    int refill = (now - bucket.last_refill) / DLNA_MSEARCH_PEER_REFILL_MS;
+    if (refill > 0) {
+      bucket.tokens += refill;
+      if (bucket.tokens > DLNA_MSEARCH_PEER_BURST) {
+        bucket.tokens = DLNA_MSEARCH_PEER_BURST;
+      }
+      bucket.last_refill += (uint64_t)refill * DLNA_MSEARCH_PEER_REFILL_MS;
+    }
+    if (bucket.tokens <= 0) return false;
+    bucket.tokens--;
+    return true;
+  }
+
+  /// Provides the registered ST which is matching or nullptr if the ST is not
+  /// relevant for us
+  const char* findST(StrView& st) {
+    for (auto accept : mx_vector) {
+      if (st.equals(accept)) {
+        DLNA_LOG(DlnaDebug, "MX: %s -> relevant", accept);
+        return accept;
+      }
+    }
+    return nullptr;
   }
 };
 
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "IUDPService.h"
+#include "SSDPPacketCache.h"
+#include "basic/IPAddressAndPort.h"
+#include "basic/Str.h"
+#include "basic/Url.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief A network interface of a multi homed device (e.g. Ethernet and
+ * WiFi): each interface has its own multicast socket and announces the
+ * device with a LOCATION which uses the address of the interface.
+ * @author Phil Schatzmann
+ */
+struct DLNAInterface {
+  /// address of the device on this network
+  IPAddress address;
+  /// subnet mask which is used to find the interface of a peer
+  IPAddress subnet_mask;
+  /// multicast socket which is bound to this network
+  IUDPService* p_udp = nullptr;
+  /// base url with the address of the interface
+  Str base_url;
+  /// url of the device xml with the address of the interface
+  Str location;
+  /// alive and byebye messages with the location of this interface
+  SSDPPacketCache ssdp_cache;
+
+  /// Replaces the host of the device urls with the address of the interface
+  void setup(DLNADevice& device) {
+    Url& url = device.getDeviceURL();
+    char host[20];
+    strncpy(host, toStr(address), sizeof(host));
+    base_url = replaceHost(device.getBaseURL(), host);
+    location = replaceHost(url.url(), host);
+    ssdp_cache.setLocation(location.c_str());
+  }
+
+  /// Checks if the peer is on the network of this interface
+  bool isLocal(IPAddress peer) {
+    if (subnet_mask == IPAddress(0, 0, 0, 0)) return false;
+    for (int j = 0; j < 4; j++) {
+      if ((address[j] & subnet_mask[j]) != (peer[j] & subnet_mask[j])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Checks if the host (w/o port) is the address of this interface
+  bool isHost(const char* host) {
+    return host != nullptr && StrView(host).equals(toStr(address));
+  }
+
+ protected:
+  /// replaces the host in the url: http://host:port/path
+  static Str replaceHost(const char* url, const char* host) {
+    Str result;
+    const char* start = strstr(url, "://");
+    if (start == nullptr) return Str(url);
+    start += 3;
+    const char* end = start;
+    while (*end != 0 && *end != ':' && *end != '/') end++;
+    result.copyFrom(url, start - url);
+    result.add(host);
+    result.add(end);
+    return result;
+  }
+};
+
+}  // namespace tiny_dlna
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "basic/Url.h"
 #include "http/HttpServer.h"
 
 #define DLNA_MAX_URL_LEN 120
@@ -9,6 +10,21 @@ namespace tiny_dlna {
 typedef void (*http_callback)(HttpServer* server, const char* requestPath,
                               HttpRequestHandlerLine* hl);
 
+class DLNAAction;
+
+/// Handler of a SOAP action: ref is the reference which was registered with
+/// the table
+typedef void (*DLNAActionHandler)(DLNAAction& action, void* ref);
+
+/**
+ * @brief Entry of the table of the actions of a service
+ * @author Phil Schatzmann
+ */
+struct DLNAActionEntry {
+  const char* name;
+  DLNAActionHandler handler;
+};
+
 /**
  * @brief Attributes needed for the DLNA Service Definition
  * @author Phil Schatzmann
@@ -19,7 +35,7 @@ class DLNAServiceInfo {
   void setup(const char* type, const char* id, const char* scp,
              http_callback cbScp, const char* control, http_callback cbControl,
              const char* event, http_callback cbEvent) {
-    DlnaLogger.log(DlnaInfo, "setting up: %s | %s | %s", scp, control, event);
+    DLNA_LOG(DlnaInfo, "setting up: %s | %s | %s", scp, control, event);
 
     service_type = type;
     service_id = id;
@@ -38,6 +54,26 @@ class DLNAServiceInfo {
   http_callback scp_cb = nullptr;
   http_callback control_cb = nullptr;
   http_callback event_sub_cb = nullptr;
+  /// namespace of the LastChange event (e.g.
+  /// "urn:schemas-upnp-org:metadata-1-0/AVT/"): if not defined the evented
+  /// state variables are sent as individual properties
+  const char* last_change_ns = nullptr;
+  /// actions which are dispatched by the DLNAActionDispatcher if no
+  /// control_cb is defined
+  const DLNAActionEntry* actions = nullptr;
+  int action_count = 0;
+  void* action_ref = nullptr;
+  /// absolute control and event urls: they are resolved by the
+  /// DLNAControlPointMgr when the device is added
+  Url resolved_control_url;
+  Url resolved_event_sub_url;
+
+  /// Defines the table of the actions which are called with the reference
+  void setActions(const DLNAActionEntry* table, int count, void* ref) {
+    actions = table;
+    action_count = count;
+    action_ref = ref;
+  }
   bool is_active = true;
   operator bool() { return is_active; }
 };
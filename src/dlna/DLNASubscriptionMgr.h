@@ -0,0 +1,550 @@
+#pragma once
+
+#include "Arduino.h"  // for millis and random
+#include "DLNADevice.h"
+#include "DLNAServiceInfo.h"
+#include "Schedule.h"
+#include "basic/Str.h"
+#include "basic/StrPrint.h"
+#include "basic/Url.h"
+#include "basic/Vector.h"
+#include "http/HttpServer.h"
+#include "service/State.h"
+#include "xml/XMLPrinter.h"
+
+#if defined(ESP32)
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#endif
+
+// max number of active event subscriptions
+#ifndef DLNA_EVENT_MAX_SUBSCRIPTIONS
+#define DLNA_EVENT_MAX_SUBSCRIPTIONS 10
+#endif
+
+// max (and default) subscription timeout in seconds
+#ifndef DLNA_EVENT_TIMEOUT_SEC
+#define DLNA_EVENT_TIMEOUT_SEC 1800
+#endif
+
+// interval in ms in which the state changes are combined into one NOTIFY
+#ifndef DLNA_EVENT_MODERATION_MS
+#define DLNA_EVENT_MODERATION_MS 200
+#endif
+
+// subscriptions which failed n times in a row are removed
+#ifndef DLNA_EVENT_MAX_FAILURES
+#define DLNA_EVENT_MAX_FAILURES 3
+#endif
+
+// timeout in ms for the connect (if supported by the client) and the reply
+// of a NOTIFY
+#ifndef DLNA_EVENT_NOTIFY_TIMEOUT_MS
+#define DLNA_EVENT_NOTIFY_TIMEOUT_MS 500
+#endif
+
+// max time in ms which one publish() spends with sending: the remaining
+// NOTIFY messages are sent by the next call
+#ifndef DLNA_EVENT_NOTIFY_BUDGET_MS
+#define DLNA_EVENT_NOTIFY_BUDGET_MS 100
+#endif
+
+namespace tiny_dlna {
+
+/**
+ * @brief GENA event subscription of a control point to a service
+ * @author Phil Schatzmann
+ */
+struct DLNASubscription {
+  Str sid;
+  /// url to which the NOTIFY messages are sent
+  Str callback_url;
+  /// index of the evented service
+  int service_idx = 0;
+  /// millis() when the subscription ends
+  uint64_t expires = 0;
+  /// event key: 0 for the initial event
+  uint32_t seq = 0;
+  /// number of failed NOTIFY messages in a row
+  int failures = 0;
+  /// the initial event with all values still needs to be sent
+  bool is_initial = true;
+  /// the last change event of the service still needs to be sent
+  bool is_pending = false;
+};
+
+/**
+ * @brief Subscription table and event delivery (GENA) of the services of a
+ * device: the SUBSCRIBE and UNSUBSCRIBE requests are handled by the
+ * HttpServer on the event_sub_url of each service. The changes of the state
+ * variables are collected with setValue() and published by a Schedule once
+ * per moderation interval: all changes of a service are combined into one
+ * NOTIFY (with a LastChange variable if DLNAServiceInfo::last_change_ns is
+ * defined). The NOTIFY messages are sent with keep-alive, so the connection
+ * to a subscriber is reused. A short timeout and a time budget per publish()
+ * limit the blocking by unreachable subscribers. On the ESP32 the values are protected by a
+ * mutex, so setValue() can be called from a different task than publish().
+ * @author Phil Schatzmann
+ */
+class DLNASubscriptionMgr {
+ public:
+  DLNASubscriptionMgr() {
+    http.setKeepAlive(true);
+    http.setTimeout(DLNA_EVENT_NOTIFY_TIMEOUT_MS);
+  }
+
+#if defined(ESP32)
+  ~DLNASubscriptionMgr() {
+    if (mutex != nullptr) vSemaphoreDelete(mutex);
+  }
+#endif
+
+  /// Registers the services of the device: call after setupServices()
+  void begin(DLNADevice& device) {
+    end();
+    for (DLNAServiceInfo& info : device.getServices()) {
+      EventedService service;
+      service.p_info = &info;
+      services.push_back(service);
+    }
+  }
+
+  /// Removes all subscriptions and services
+  void end() {
+    subscriptions.clear();
+    services.clear();
+    http.connectionPool().end();
+  }
+
+  /// Registers the SUBSCRIBE and UNSUBSCRIBE handlers for the event url of
+  /// each service
+  void setupServer(HttpServer& server, const char* prefix) {
+    char buffer[DLNA_MAX_URL_LEN] = {0};
+    StrView url(buffer, DLNA_MAX_URL_LEN);
+    for (int j = 0; j < services.size(); j++) {
+      EventedService& service = services[j];
+      if (service.p_info->event_sub_url == nullptr) continue;
+      void* ref[] = {this, (void*)(intptr_t)j};
+      const char* path = url.buildPath(prefix, service.p_info->event_sub_url);
+      server.on(path, T_SUBSCRIBE, subscriptionCB, ref, 2);
+      server.on(path, T_UNSUBSCRIBE, subscriptionCB, ref, 2);
+    }
+  }
+
+  /// Updates the value of an evented state variable: returns true if it has
+  /// changed and will be published
+  bool setValue(const char* serviceId, const char* name, const char* value) {
+    EventedService* p_service = findService(serviceId);
+    if (p_service == nullptr || name == nullptr) {
+      DLNA_LOG(DlnaError, "invalid service: %s", serviceId);
+      return false;
+    }
+    if (value == nullptr) value = "";
+    lock();
+    bool result = updateValue(*p_service, name, value);
+    unlock();
+    return result;
+  }
+
+  /// Provides the actual value of an evented state variable: the result is
+  /// only valid until the value is changed
+  const char* getValue(const char* serviceId, const char* name) {
+    EventedService* p_service = findService(serviceId);
+    if (p_service == nullptr) return nullptr;
+    const char* result = nullptr;
+    lock();
+    for (EventedValue& state : p_service->values) {
+      if (state.name.equals(name)) result = state.value.c_str();
+    }
+    unlock();
+    return result;
+  }
+
+  /// Sends the initial events to the new subscribers and the changed values
+  /// to all others: called by the EventNotifySchedule. When the time budget
+  /// is used up, the remaining messages are sent by the next call.
+  void publish() {
+    removeExpired();
+    uint64_t end = millis() + DLNA_EVENT_NOTIFY_BUDGET_MS;
+    for (int j = 0; j < services.size(); j++) {
+      EventedService& service = services[j];
+      // the changes are only collected when the last event has been sent to
+      // all subscribers. The values are only locked while the event is
+      // printed, not while it is sent.
+      if (!hasPending(j)) {
+        lock();
+        bool is_changed = service.is_changed;
+        if (is_changed) {
+          printEvent(service, false, service.event);
+          service.is_changed = false;
+          for (auto& state : service.values) state.is_changed = false;
+        }
+        unlock();
+        if (is_changed) {
+          for (auto& sub : subscriptions) {
+            if (sub.service_idx == j && !sub.is_initial) sub.is_pending = true;
+          }
+        }
+      }
+      for (auto& sub : subscriptions) {
+        if (millis() >= end) break;
+        if (sub.service_idx == j && sub.is_pending) {
+          sub.is_pending = false;
+          notify(sub, service.event);
+        }
+      }
+      if (hasInitial(j) && millis() < end) {
+        lock();
+        printEvent(service, true, body);
+        unlock();
+        for (auto& sub : subscriptions) {
+          if (millis() >= end) break;
+          if (sub.service_idx == j && sub.is_initial) {
+            sub.is_initial = false;
+            notify(sub, body);
+          }
+        }
+      }
+    }
+    removeFailed();
+  }
+
+  /// Calls publish() if the moderation interval has passed: for the
+  /// processing outside of the Scheduler
+  void publishIfDue() {
+    uint64_t now = millis();
+    if (now < next_publish) return;
+    next_publish = now + moderation_ms;
+    publish();
+  }
+
+  /// Number of active subscriptions
+  int size() { return subscriptions.size(); }
+
+  /// Provides the subscription for the indicated SID (or nullptr)
+  DLNASubscription* find(const char* sid) {
+    if (sid == nullptr) return nullptr;
+    for (auto& sub : subscriptions) {
+      if (sub.sid.equals(sid)) return &sub;
+    }
+    return nullptr;
+  }
+
+  /// Defines the interval in which the changes are combined (call before
+  /// begin of the device)
+  void setModerationMs(uint32_t ms) { moderation_ms = ms; }
+
+  /// Interval in which the changes are combined
+  uint32_t moderationMs() { return moderation_ms; }
+
+ protected:
+  struct EventedValue {
+    Str name;
+    Str value;
+    bool is_changed = false;
+  };
+  struct EventedService {
+    DLNAServiceInfo* p_info = nullptr;
+    Vector<EventedValue> values;
+    bool is_changed = false;
+    // last change event which is sent to the subscribers
+    StrPrint event;
+  };
+  Vector<EventedService> services;
+  Vector<DLNASubscription> subscriptions;
+  HttpRequest http;
+  // the initial event: reused for all new subscribers of a service
+  StrPrint body{512};
+  StrPrint last_change{256};
+  uint32_t moderation_ms = DLNA_EVENT_MODERATION_MS;
+  uint64_t next_publish = 0;
+#if defined(ESP32)
+  SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+
+  void lock() { xSemaphoreTake(mutex, portMAX_DELAY); }
+  void unlock() { xSemaphoreGive(mutex); }
+#else
+  void lock() {}
+  void unlock() {}
+#endif
+
+  /// updates or adds the value: returns true if it has changed
+  bool updateValue(EventedService& service, const char* name,
+                   const char* value) {
+    for (EventedValue& state : service.values) {
+      if (state.name.equals(name)) {
+        if (state.value.equals(value)) return false;
+        state.value = value;
+        state.is_changed = true;
+        service.is_changed = true;
+        return true;
+      }
+    }
+    EventedValue state;
+    state.name = name;
+    state.value = value;
+    state.is_changed = true;
+    service.values.push_back(state);
+    service.is_changed = true;
+    return true;
+  }
+
+  /// handles the SUBSCRIBE and UNSUBSCRIBE requests
+  static void subscriptionCB(HttpServer* server, const char* requestPath,
+                             HttpRequestHandlerLine* hl) {
+    DLNASubscriptionMgr* mgr = (DLNASubscriptionMgr*)hl->context[0];
+    int service_idx = (int)(intptr_t)hl->context[1];
+    mgr->processRequest(*server, service_idx);
+  }
+
+  void processRequest(HttpServer& server, int serviceIdx) {
+    HttpRequestHeader& req = server.requestHeader();
+    const char* sid = req.get("SID");
+    const char* callback = req.get("CALLBACK");
+    const char* nt = req.get("NT");
+
+    if (req.method() == T_UNSUBSCRIBE) {
+      if (callback != nullptr || nt != nullptr) {
+        server.reply(400, "Bad Request");
+      } else if (remove(sid)) {
+        server.replyOK();
+      } else {
+        server.reply(412, "Precondition Failed");
+      }
+      return;
+    }
+
+    int timeout = parseTimeout(req.get("TIMEOUT"));
+    if (sid != nullptr) {
+      // renewal
+      DLNASubscription* p_sub = find(sid);
+      if (callback != nullptr || nt != nullptr) {
+        server.reply(400, "Bad Request");
+      } else if (p_sub == nullptr || p_sub->service_idx != serviceIdx) {
+        server.reply(412, "Precondition Failed");
+      } else {
+        p_sub->expires = millis() + 1000ul * timeout;
+        replySubscribe(server, *p_sub, timeout);
+      }
+      return;
+    }
+
+    // new subscription
+    DLNASubscription sub;
+    if (nt == nullptr || !StrView(nt).equals("upnp:event") ||
+        !parseCallback(callback, sub.callback_url)) {
+      server.reply(412, "Precondition Failed");
+      return;
+    }
+    removeExpired();
+    if (subscriptions.size() >= DLNA_EVENT_MAX_SUBSCRIPTIONS) {
+      DLNA_LOG(DlnaWarning, "too many subscriptions");
+      server.reply(503, "Service Unavailable");
+      return;
+    }
+    newSID(sub.sid);
+    sub.service_idx = serviceIdx;
+    sub.expires = millis() + 1000ul * timeout;
+    subscriptions.push_back(sub);
+    DLNA_LOG(DlnaInfo, "subscribed %s -> %s", sub.sid.c_str(),
+             sub.callback_url.c_str());
+    replySubscribe(server, subscriptions[subscriptions.size() - 1], timeout);
+  }
+
+  void replySubscribe(HttpServer& server, DLNASubscription& sub, int timeout) {
+    char tmp[40];
+    snprintf(tmp, sizeof(tmp), "Second-%d", timeout);
+    server.replyHeader().put("SID", sub.sid.c_str());
+    server.replyHeader().put("TIMEOUT", tmp);
+    server.replyOK();
+  }
+
+  /// Determines the timeout from e.g. "Second-1800" or "infinite"
+  int parseTimeout(const char* timeout) {
+    int result = DLNA_EVENT_TIMEOUT_SEC;
+    if (timeout != nullptr && strncasecmp(timeout, "Second-", 7) == 0) {
+      result = atoi(timeout + 7);
+    }
+    if (result <= 0 || result > DLNA_EVENT_TIMEOUT_SEC) {
+      result = DLNA_EVENT_TIMEOUT_SEC;
+    }
+    return result;
+  }
+
+  /// Determines the first url from "<url1><url2>"
+  bool parseCallback(const char* callback, Str& result) {
+    if (callback == nullptr) return false;
+    const char* start = strchr(callback, '<');
+    if (start == nullptr) return false;
+    const char* end = strchr(start, '>');
+    if (end == nullptr) return false;
+    int len = end - start - 1;
+    if (len <= 7 || strncmp(start + 1, "http://", 7) != 0) return false;
+    result.copyFrom(start + 1, len);
+    return true;
+  }
+
+  void newSID(Str& sid) {
+    char tmp[44];
+    snprintf(tmp, sizeof(tmp), "uuid:%08lx-%04lx-4%03lx-%04lx-%08lx%04lx",
+             (unsigned long)random(0x7FFFFFFF),
+             (unsigned long)random(0xFFFF), (unsigned long)random(0xFFF),
+             (unsigned long)(0x8000 | random(0x3FFF)),
+             (unsigned long)millis(), (unsigned long)random(0xFFFF));
+    sid = tmp;
+  }
+
+  bool remove(const char* sid) {
+    if (sid == nullptr) return false;
+    for (int j = 0; j < subscriptions.size(); j++) {
+      if (subscriptions[j].sid.equals(sid)) {
+        DLNA_LOG(DlnaInfo, "unsubscribed %s", sid);
+        subscriptions.erase(j);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void removeExpired() {
+    uint64_t now = millis();
+    for (int j = subscriptions.size() - 1; j >= 0; j--) {
+      if (subscriptions[j].expires < now) {
+        DLNA_LOG(DlnaInfo, "expired %s", subscriptions[j].sid.c_str());
+        subscriptions.erase(j);
+      }
+    }
+  }
+
+  void removeFailed() {
+    for (int j = subscriptions.size() - 1; j >= 0; j--) {
+      if (subscriptions[j].failures >= DLNA_EVENT_MAX_FAILURES) {
+        DLNA_LOG(DlnaWarning, "removed %s", subscriptions[j].sid.c_str());
+        subscriptions.erase(j);
+      }
+    }
+  }
+
+  bool hasPending(int serviceIdx) {
+    for (auto& sub : subscriptions) {
+      if (sub.service_idx == serviceIdx && sub.is_pending) return true;
+    }
+    return false;
+  }
+
+  bool hasInitial(int serviceIdx) {
+    for (auto& sub : subscriptions) {
+      if (sub.service_idx == serviceIdx && sub.is_initial) return true;
+    }
+    return false;
+  }
+
+  EventedService* findService(const char* serviceId) {
+    if (serviceId == nullptr) return nullptr;
+    for (auto& service : services) {
+      const char* id = service.p_info->service_id;
+      if (id != nullptr && strcmp(id, serviceId) == 0) {
+        return &service;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Sends the event to the subscriber
+  bool notify(DLNASubscription& sub, StrPrint& event) {
+    Url url(sub.callback_url.c_str());
+    char seq[12];
+    snprintf(seq, sizeof(seq), "%lu", (unsigned long)sub.seq);
+    http.request().put("NT", "upnp:event");
+    http.request().put("NTS", "upnp:propchange");
+    http.request().put("SID", sub.sid.c_str());
+    http.request().put("SEQ", seq);
+    int rc = http.notify(url, "text/xml; charset=\"utf-8\"", event.c_str(),
+                         event.length());
+    http.stop();
+    // the event key wraps around to 1
+    sub.seq = sub.seq == 0xFFFFFFFF ? 1 : sub.seq + 1;
+    if (rc != 200) {
+      DLNA_LOG(DlnaWarning, "NOTIFY %s failed: %d", sub.callback_url.c_str(),
+               rc);
+      sub.failures++;
+      return false;
+    }
+    sub.failures = 0;
+    return true;
+  }
+
+  /// Prints the event xml for all or only the changed values
+  void printEvent(EventedService& service, bool all, StrPrint& out) {
+    out.reset();
+    out.print("<?xml version=\"1.0\"?>\r\n");
+    out.print("<e:propertyset xmlns:e=\"urn:schemas-upnp-org:event-1-0\">");
+    const char* ns = service.p_info->last_change_ns;
+    if (ns != nullptr) {
+      last_change.reset();
+      last_change.print("<Event xmlns=\"");
+      last_change.print(ns);
+      last_change.print("\"><InstanceID val=\"0\">");
+      for (auto& state : service.values) {
+        if (!all && !state.is_changed) continue;
+        last_change.print("<");
+        last_change.print(state.name.c_str());
+        // the RenderingControl values are defined per channel
+        if (isChannelValue(state.name.c_str())) {
+          last_change.print(" channel=\"Master\"");
+        }
+        last_change.print(" val=\"");
+        XMLPrinter::printEscaped(last_change, state.value.c_str());
+        last_change.print("\"/>");
+      }
+      last_change.print("</InstanceID></Event>");
+      out.print("<e:property><LastChange>");
+      XMLPrinter::printEscaped(out, last_change.c_str());
+      out.print("</LastChange></e:property>");
+    } else {
+      for (auto& state : service.values) {
+        if (!all && !state.is_changed) continue;
+        out.print("<e:property><");
+        out.print(state.name.c_str());
+        out.print(">");
+        XMLPrinter::printEscaped(out, state.value.c_str());
+        out.print("</");
+        out.print(state.name.c_str());
+        out.print("></e:property>");
+      }
+    }
+    out.print("</e:propertyset>");
+  }
+
+  /// Checks if the LastChange value needs a channel attribute
+  static bool isChannelValue(const char* name) {
+    const char* names[] = {"Volume", "VolumeDB", "Mute", "Loudness"};
+    for (auto channel_name : names) {
+      if (strcmp(name, channel_name) == 0) return true;
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief Publishes the collected state changes once per moderation interval
+ * @author Phil Schatzmann
+ */
+class EventNotifySchedule : public Schedule {
+ public:
+  EventNotifySchedule(DLNASubscriptionMgr& mgr) {
+    p_mgr = &mgr;
+    repeat_ms = mgr.moderationMs();
+  }
+  const char* name() override { return "EventNotify"; }
+
+  bool process(IUDPService& udp) override {
+    p_mgr->publish();
+    return true;
+  }
+
+ protected:
+  DLNASubscriptionMgr* p_mgr = nullptr;
+};
+
+}  // namespace tiny_dlna
@@ -5,15 +5,29 @@
 #include <WiFiUdp.h>
 
 #include "basic/IPAddressAndPort.h"
+#include "basic/Metrics.h"
 #include "basic/Str.h"
 #include "assert.h"
 
+// max number of UDP packets which are processed in one loop
+#ifndef DLNA_UDP_BATCH_SIZE
+#define DLNA_UDP_BATCH_SIZE 10
+#endif
+
+// max number of UDP packets (including the filtered ones) which are read by
+// one receive call
+#ifndef DLNA_UDP_MAX_PACKETS
+#define DLNA_UDP_MAX_PACKETS 20
+#endif
+
 namespace tiny_dlna {
 
 // multicast address for SSDP
 static IPAddressAndPort DLNABroadcastAddress{IPAddress(239, 255, 255, 250),
                                              1900};
 
+struct DLNAInterface;
+
 /**
  * @brief Provides information of the received UDP which consists of the (xml)
  * data and the peer address and port
@@ -21,11 +35,17 @@ static IPAddressAndPort DLNABroadcastAddress{IPAddress(239, 255, 255, 250),
  */
 
 struct RequestData {
-  Str data{0};
+  Str data;
   IPAddressAndPort peer;
+  /// network interface which should reply (nullptr = default interface)
+  DLNAInterface *p_interface = nullptr;
   operator bool() { return !data.isEmpty(); }
 };
 
+/// Filter which is called with the raw received data: return false to discard
+/// the packet
+typedef bool (*UDPReceiveFilter)(void *ref, const char *data, int len);
+
 /**
  * @brief Abstract Interface for UDP API
  * @author Phil Schatzmann
@@ -38,6 +58,66 @@ class IUDPService {
   virtual bool send(uint8_t *data, int len) = 0;
   virtual bool send(IPAddressAndPort addr, uint8_t *data, int len) = 0;
   virtual RequestData receive() = 0;
+
+  /// Receives up to maxCount packets: returns the number of filled entries.
+  /// Packets which were discarded by the filter do not end the batch, but
+  /// not more than max packets are read.
+  virtual int receive(RequestData *result, int maxCount) {
+    int count = 0;
+    for (int j = 0; j < max_packets && count < maxCount; j++) {
+      uint32_t filtered = filtered_count;
+      RequestData req = receive();
+      if (!req) {
+        // the packet was filtered: there might be more in the queue
+        if (filtered_count != filtered) continue;
+        break;
+      }
+      result[count++] = std::move(req);
+    }
+    return count;
+  }
+
+  /// Number of received packets which were lost (e.g. because the receive
+  /// queue was full)
+  virtual uint32_t droppedCount() { return dropped_count; }
+
+  /// Defines a filter which is applied to the received data before any
+  /// memory is allocated
+  virtual void setReceiveFilter(UDPReceiveFilter filter, void *ref = nullptr) {
+    receive_filter = filter;
+    receive_filter_ref = ref;
+  }
+
+  /// Number of received packets which were discarded by the filter
+  virtual uint32_t filteredCount() { return filtered_count; }
+
+  /// Defines the max number of packets (including the filtered ones) which
+  /// are read by one receive call, so that a flood of irrelevant packets can
+  /// not block the loop
+  void setMaxPackets(int count) { max_packets = count; }
+
+ protected:
+  UDPReceiveFilter receive_filter = nullptr;
+  void *receive_filter_ref = nullptr;
+  uint32_t filtered_count = 0;
+  uint32_t dropped_count = 0;
+  int max_packets = DLNA_UDP_MAX_PACKETS;
+
+  /// checks the raw data with the receive filter
+  bool isAccepted(const char *data, int len) {
+    DlnaMetrics.add(CNT_UDP_RECEIVED);
+    if (receive_filter == nullptr) return true;
+    if (receive_filter(receive_filter_ref, data, len)) return true;
+    filtered_count++;
+    DlnaMetrics.add(CNT_UDP_FILTERED);
+    return false;
+  }
+
+  /// counts a received packet which was lost
+  void addDropped() {
+    dropped_count++;
+    DlnaMetrics.add(CNT_UDP_DROPPED);
+  }
 };
 
 }  // namespace tiny_dlna
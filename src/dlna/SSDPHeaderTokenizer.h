@@ -0,0 +1,155 @@
+#pragma once
+
+#include "basic/StrView.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief Single pass tokenizer for SSDP/HTTP headers: the data is split in
+ * place (by replacing the line ends with 0) and the method, path, header
+ * keys and values are provided as StrView slices into the original buffer.
+ * So no additional memory needs to be allocated. The buffer must be 0
+ * terminated (as provided by Str).
+ * @author Phil Schatzmann
+ */
+
+class SSDPHeaderTokenizer {
+ public:
+  SSDPHeaderTokenizer() = default;
+  SSDPHeaderTokenizer(char* data, int len) { begin(data, len); }
+
+  /// Starts to tokenize the indicated buffer by parsing the request line
+  bool begin(char* data, int len) {
+    this->data = data;
+    this->end = data + len;
+    this->pos = data;
+    this->is_header_end = false;
+    method_str = StrView("");
+    path_str = StrView("");
+    body_str = StrView("");
+    if (data == nullptr || len <= 0) return false;
+
+    // request line e.g. "NOTIFY * HTTP/1.1" or "HTTP/1.1 200 OK"
+    char* line = nextLine();
+    if (line == nullptr) return false;
+    char* sep = strchr(line, ' ');
+    if (sep == nullptr) {
+      setView(method_str, line, line + strlen(line));
+      return true;
+    }
+    setView(method_str, line, sep);
+    *sep = 0;
+    char* path = sep + 1;
+    char* path_end = strchr(path, ' ');
+    if (path_end != nullptr) *path_end = 0;
+    setView(path_str, path, path + strlen(path));
+    return true;
+  }
+
+  /// Provides the next header key and value: returns false at the end of the
+  /// header
+  bool next(StrView& key, StrView& value) {
+    while (!is_header_end) {
+      char* line = nextLine();
+      if (line == nullptr) return false;
+      if (*line == 0) {
+        // empty line: the body follows
+        is_header_end = true;
+        setView(body_str, pos, end);
+        return false;
+      }
+      char* sep = strchr(line, ':');
+      if (sep == nullptr) continue;
+      *sep = 0;
+      setView(key, line, sep);
+      setView(value, sep + 1, sep + 1 + strlen(sep + 1));
+      return true;
+    }
+    return false;
+  }
+
+  /// e.g. NOTIFY, M-SEARCH or HTTP/1.1
+  StrView& method() { return method_str; }
+
+  /// e.g. * or the GENA delivery path
+  StrView& path() { return path_str; }
+
+  /// the content after the header: only available after next() returned false
+  StrView& body() { return body_str; }
+
+  /// Checks if the raw data starts with the indicated prefix
+  static bool startsWith(const char* data, int len, const char* prefix) {
+    int prefix_len = strlen(prefix);
+    return len >= prefix_len && strncmp(data, prefix, prefix_len) == 0;
+  }
+
+  /// Finds the value of the indicated header key (ignoring the case) without
+  /// changing the data: the value is not 0 terminated!
+  static bool findValue(const char* data, int len, const char* key,
+                        const char*& value, int& valueLen) {
+    int key_len = strlen(key);
+    const char* end = data + len;
+    const char* line = data;
+    while (line < end) {
+      const char* eol = (const char*)memchr(line, '\n', end - line);
+      if (eol == nullptr) eol = end;
+      if (eol - line > key_len && line[key_len] == ':' &&
+          equalsIgnoreCase(line, key, key_len)) {
+        const char* start = line + key_len + 1;
+        const char* stop = eol;
+        while (start < stop && (*start == ' ' || *start == '\t')) start++;
+        while (stop > start && (stop[-1] == ' ' || stop[-1] == '\r')) stop--;
+        value = start;
+        valueLen = stop - start;
+        return true;
+      }
+      line = eol + 1;
+    }
+    return false;
+  }
+
+ protected:
+  char* data = nullptr;
+  char* end = nullptr;
+  char* pos = nullptr;
+  bool is_header_end = false;
+  StrView method_str;
+  StrView path_str;
+  StrView body_str;
+
+  /// terminates the next line with 0 and returns it
+  char* nextLine() {
+    if (pos >= end) return nullptr;
+    char* line = pos;
+    char* eol = (char*)memchr(pos, '\n', end - pos);
+    if (eol == nullptr) {
+      pos = end;
+    } else {
+      *eol = 0;
+      pos = eol + 1;
+      if (eol > line && eol[-1] == '\r') eol[-1] = 0;
+    }
+    return line;
+  }
+
+  static bool equalsIgnoreCase(const char* str, const char* key, int len) {
+    for (int j = 0; j < len; j++) {
+      if (tolower(str[j]) != tolower(key[j])) return false;
+    }
+    return true;
+  }
+
+  /// assigns the trimmed range to the view
+  void setView(StrView& view, char* start, char* stop) {
+    while (start < stop && (*start == ' ' || *start == '\t')) start++;
+    while (stop > start && (stop[-1] == ' ' || stop[-1] == '\t' ||
+                            stop[-1] == '\r' || stop[-1] == 0)) {
+      stop--;
+    }
+    *stop = 0;
+    int len = stop - start;
+    view.set(start, len, len, false);
+  }
+};
+
+}  // namespace tiny_dlna
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "DLNADevice.h"
+#include "IUDPService.h"
+#include "basic/Str.h"
+#include "basic/Vector.h"
+
+#ifndef MAX_TMP_SIZE
+#define MAX_TMP_SIZE 300
+#endif
+
+namespace tiny_dlna {
+
+/**
+ * @brief Renders the SSDP alive and byebye datagrams of a device once for
+ * each NT (udn, upnp:rootdevice, device type and service types), so that the
+ * periodic announcements are just plain udp.send() calls. The packets are
+ * rebuilt when the version of the device has changed. By default the
+ * LOCATION is the device url: on a multi homed device each interface uses
+ * its own cache with the location of the interface.
+ * @author Phil Schatzmann
+ */
+
+class SSDPPacketCache {
+ public:
+  /// Sends all alive messages
+  bool sendAlive(DLNADevice& device, IUDPService& udp) {
+    update(device);
+    return send(alive, udp);
+  }
+
+  /// Sends all byebye messages
+  bool sendBye(DLNADevice& device, IUDPService& udp) {
+    update(device);
+    return send(bye, udp);
+  }
+
+  /// Number of cached datagrams per message type
+  int size() { return alive.offsets.size(); }
+
+  /// Forces a rebuild with the next send
+  void clear() { p_device = nullptr; }
+
+  /// Defines the LOCATION which is announced instead of the device url
+  void setLocation(const char* url) {
+    location = url;
+    clear();
+  }
+
+ protected:
+  /// all datagrams of one type in a single buffer
+  struct Packets {
+    Str data;
+    Vector<int> offsets;
+    Vector<int> lengths;
+    void clear() {
+      data.reset();
+      offsets.clear();
+      lengths.clear();
+    }
+  };
+  Packets alive;
+  Packets bye;
+  DLNADevice* p_device = nullptr;
+  uint32_t version = 0;
+  int alive_max_age = 100;
+  Str location;
+
+  void update(DLNADevice& device) {
+    if (p_device == &device && version == device.getVersion()) return;
+    DLNA_LOG(DlnaInfo, "Rendering SSDP announcements");
+    p_device = &device;
+    version = device.getVersion();
+    alive.clear();
+    bye.clear();
+
+    const char* udn = device.getUDN();
+    // announce with udn
+    add(device, udn, udn);
+    add(device, "upnp:rootdevice", nullptr);
+    add(device, device.getDeviceType(), nullptr);
+    // announce with service udn
+    for (auto& service : device.getServices()) {
+      add(device, service.service_type, nullptr);
+    }
+  }
+
+  /// renders the alive and bye datagram for the indicated nt
+  void add(DLNADevice& device, const char* nt, const char* usn) {
+    char usn_buffer[200];
+    if (usn == nullptr) {
+      snprintf(usn_buffer, 200, "%s::%s", device.getUDN(), nt);
+      usn = usn_buffer;
+    }
+    char buffer[MAX_TMP_SIZE] = {0};
+    const char* tmp_alive =
+        "NOTIFY * HTTP/1.1\r\n"
+        "HOST:%s\r\n"
+        "CACHE-CONTROL: max-age = %d\r\n"
+        "LOCATION: %s\r\n"
+        "NT: %s\r\n"
+        "NTS: ssdp:alive\r\n"
+        "USN: %s\r\n\r\n";
+    int n = snprintf(buffer, MAX_TMP_SIZE, tmp_alive,
+                     DLNABroadcastAddress.toString(), alive_max_age,
+                     location.isEmpty() ? device.getDeviceURL().url()
+                                        : location.c_str(),
+                     nt, usn);
+    assert(n < MAX_TMP_SIZE);
+    add(alive, buffer, n);
+
+    const char* tmp_bye =
+        "NOTIFY * HTTP/1.1\r\n"
+        "HOST: %s\r\n"
+        "NT: %s\r\n"
+        "NTS: ssdp:byebye\r\n"
+        "USN: %s\r\n\r\n";
+    n = snprintf(buffer, MAX_TMP_SIZE, tmp_bye,
+                 DLNABroadcastAddress.toString(), nt, usn);
+    assert(n < MAX_TMP_SIZE);
+    add(bye, buffer, n);
+  }
+
+  void add(Packets& packets, const char* data, int len) {
+    packets.offsets.push_back(packets.data.length());
+    packets.lengths.push_back(len);
+    packets.data.add(data);
+  }
+
+  bool send(Packets& packets, IUDPService& udp) {
+    bool result = true;
+    uint8_t* data = (uint8_t*)packets.data.c_str();
+    for (int j = 0; j < packets.offsets.size(); j++) {
+      if (!udp.send(DLNABroadcastAddress, data + packets.offsets[j],
+                    packets.lengths[j])) {
+        result = false;
+      }
+    }
+    return result;
+  }
+};
+
+}  // namespace tiny_dlna
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <functional>
+
 #include "DLNADevice.h"
+#include "DLNAInterface.h"
 #include "IUDPService.h"
+#include "SSDPPacketCache.h"
 
 #define MAX_TMP_SIZE 300
 #define ALIVE_MS 0
@@ -24,6 +28,10 @@ struct Schedule {
   uint64_t end_time = 0;
   // schedle is active
   bool active = false;
+  // allocator which was used to create the schedule (nullptr = new)
+  Allocator *p_allocator = nullptr;
+
+  virtual ~Schedule() = default;
 
   virtual bool process(IUDPService &udp) { return false; }
 
@@ -46,8 +54,8 @@ class MSearchSchedule : public Schedule {
 
   bool process(IUDPService &udp) override {
     // we keep the data on the stack
-    DlnaLogger.log(DlnaDebug, "Sending %s for %s to %s", name(), search_target,
-                   address.toString());
+    DLNA_LOG(DlnaDebug, "Sending %s for %s to %s", name(), search_target,
+             address.toString());
 
     char buffer[MAX_TMP_SIZE] = {0};
     const char *tmp =
@@ -59,7 +67,7 @@ class MSearchSchedule : public Schedule {
     int n = snprintf(buffer, MAX_TMP_SIZE, tmp, address.toString(), max_age,
                      search_target);
     assert(n < MAX_TMP_SIZE);
-    DlnaLogger.log(DlnaInfo, "sending: %s", buffer);
+    DLNA_LOG(DlnaInfo, "sending: %s", buffer);
     udp.send(address, (uint8_t *)buffer, n);
     return true;
   }
@@ -71,7 +79,10 @@ class MSearchSchedule : public Schedule {
 };
 
 /**
- * @brief Answer from device to MSearch request by sending a reply
+ * @brief Answer from device to MSearch request by sending a reply. For
+ * ssdp:all we send one reply for each NT of the device (udn, upnp:rootdevice,
+ * device type and service types) in one burst. On a multi homed device the
+ * reply is sent via the interface of the peer with its LOCATION.
  * @author Phil Schatzmann
  */
 class MSearchReplySchedule : public Schedule {
@@ -83,11 +94,44 @@ class MSearchReplySchedule : public Schedule {
   const char *name() override { return "MSearchReply"; }
 
   bool process(IUDPService &udp) override {
-    // we keep the data on the stack
-    DlnaLogger.log(DlnaInfo, "Sending %s for %s to %s", name(),
-                   search_target.c_str(), address.toString());
+    DLNA_LOG(DlnaInfo, "Sending %s for %s to %s", name(),
+             search_target, address.toString());
 
     DLNADevice &device = *p_device;
+    IUDPService &out = p_interface != nullptr ? *p_interface->p_udp : udp;
+    if (!StrView(search_target).equals("ssdp:all")) {
+      return send(out, search_target, device.getUDN());
+    }
+    const char *udn = device.getUDN();
+    bool result = send(out, udn, udn);
+    result = sendNT(out, "upnp:rootdevice") && result;
+    result = sendNT(out, device.getDeviceType()) && result;
+    for (auto &service : device.getServices()) {
+      result = sendNT(out, service.service_type) && result;
+    }
+    return result;
+  }
+
+  // points to the registered (relevant) search target
+  const char *search_target = "";
+  IPAddressAndPort address;
+  DLNADevice *p_device;
+  // interface which received the request (nullptr = default interface)
+  DLNAInterface *p_interface = nullptr;
+  int mx = 0;
+
+ protected:
+  int max_age = MAX_AGE;
+
+  /// sends the reply for the nt with the usn udn::nt
+  bool sendNT(IUDPService &udp, const char *nt) {
+    char usn[200];
+    snprintf(usn, 200, "%s::%s", p_device->getUDN(), nt);
+    return send(udp, nt, usn);
+  }
+
+  bool send(IUDPService &udp, const char *st, const char *usn) {
+    // we keep the data on the stack
     char buffer[MAX_TMP_SIZE] = {0};
     const char *tmp =
         "HTTP/1.1 200 OK\r\n"
@@ -95,22 +139,16 @@ class MSearchReplySchedule : public Schedule {
         "LOCATION: %s\r\n"
         "ST: %s\r\n"
         "USN: %s\r\n\r\n";
-    int n = snprintf(buffer, MAX_TMP_SIZE, tmp, max_age,
-                     device.getDeviceURL().url(), search_target.c_str(),
-                     device.getUDN());
+    const char *location = p_interface != nullptr
+                               ? p_interface->location.c_str()
+                               : p_device->getDeviceURL().url();
+    int n = snprintf(buffer, MAX_TMP_SIZE, tmp, max_age, location, st, usn);
     assert(n < MAX_TMP_SIZE);
-    DlnaLogger.log(DlnaDebug, "sending: %s", buffer);
-    udp.send(address, (uint8_t *)buffer, n);
+    DLNA_LOG(DlnaDebug, "sending: %s", buffer);
+    if (!udp.send(address, (uint8_t *)buffer, n)) return false;
+    DlnaMetrics.add(CNT_MSEARCH_REPLIES);
     return true;
   }
-
-  Str search_target;
-  IPAddressAndPort address;
-  DLNADevice *p_device;
-  int mx = 0;
-
- protected:
-  int max_age = MAX_AGE;
 };
 
 /**
@@ -121,12 +159,16 @@ class MSearchReplySchedule : public Schedule {
 class MSearchReplyCP : public Schedule {
  public:
   const char *name() override { return "MSearchReplyCP"; }
-  Str location;
-  Str usn;
-  Str search_target;
+  // received datagram: the fields below are pointing into it
+  Str data;
+  StrView location{""};
+  StrView usn{""};
+  StrView search_target{""};
+  // seconds from the CACHE-CONTROL max-age (0 if not defined)
+  int max_age = 0;
 
   bool process(IUDPService &udp) override {
-    DlnaLogger.log(DlnaInfo, "-> %s not processed", search_target.c_str());
+    DLNA_LOG(DlnaInfo, "-> %s not processed", search_target.c_str());
     return true;
   }
 
@@ -135,97 +177,87 @@ class MSearchReplyCP : public Schedule {
 class NotifyReplyCP : public MSearchReplyCP {
  public:
   const char *name() override { return "NotifyReplyCP"; }
-  Str nts;
-  Str delivery_host_and_port;
-  Str delivery_path;
-  Str subscription_id;
-  Str event_key;
-  Str xml;
+  StrView nts{""};
+  StrView delivery_host_and_port{""};
+  StrView delivery_path{""};
+  StrView subscription_id{""};
+  StrView event_key{""};
+  StrView xml{""};
 
   // callback 
   std::function<bool(NotifyReplyCP &ref)> callback;
 
   bool process(IUDPService &udp) override {
     if (callback(*this)){
-      DlnaLogger.log(DlnaInfo, "%s -> %s", name(), nts.c_str());
+      DLNA_LOG(DlnaInfo, "%s -> %s", name(), nts.c_str());
       return true;
     }
 
-    DlnaLogger.log(DlnaInfo, "-> %s not processed", nts.c_str());
+    DLNA_LOG(DlnaInfo, "-> %s not processed", nts.c_str());
     return true;
   }
 };
 
 /**
- * @brief Send out PostAlive messages: Repeated every 5 seconds
+ * @brief Regular processing at the control point: it is used to remove the
+ * expired devices
+ * @author Phil Schatzmann
+ */
+class ExpireDevicesCP : public Schedule {
+ public:
+  ExpireDevicesCP(uint32_t repeatMs) {
+    repeat_ms = repeatMs;
+    time = millis() + repeatMs;
+  }
+  const char *name() override { return "ExpireDevicesCP"; }
+
+  // callback
+  std::function<bool(ExpireDevicesCP &ref)> callback;
+
+  bool process(IUDPService &udp) override {
+    return callback ? callback(*this) : false;
+  }
+};
+
+/**
+ * @brief Send out PostAlive messages: Repeated every 5 seconds. The datagrams
+ * are rendered only once by the SSDPPacketCache.
  * @author Phil Schatzmann
  */
 class PostAliveSchedule : public Schedule {
  public:
-  PostAliveSchedule(DLNADevice &device, uint32_t repeatMs) {
+  PostAliveSchedule(DLNADevice &device, SSDPPacketCache &cache,
+                    uint32_t repeatMs) {
     p_device = &device;
+    p_cache = &cache;
     this->repeat_ms = repeatMs;
   }
   const char *name() override { return "PostAlive"; }
 
   void setRepeatMs(uint32_t ms) { this->repeat_ms = ms; }
 
-  bool process(IUDPService &udp) override {
-    DlnaLogger.log(DlnaInfo, "Sending %s to %s", name(),
-                   DLNABroadcastAddress.toString());
-    DLNADevice &device = *p_device;
-    char nt[100];
-    char usn[200];
+  /// Announces the device on all interfaces (instead of the cache)
+  void setInterfaces(Vector<DLNAInterface> &interfaces) {
+    p_interfaces = &interfaces;
+  }
 
-    const char *device_url = device.getDeviceURL().url();
-    int max_age = 100;
-    // announce with udn
-    process(device.getUDN(), device.getUDN(), device_url, max_age, udp);
-    // NT: upnp:rootdevice\r\n
-    setupData("upnp:rootdevice", device.getUDN(), nt, usn);
-    process(nt, usn, device_url, max_age, udp);
-    // NT: urn:schemas-upnp-org:device:MediaRenderer:1\r\n
-    setupData(device.getDeviceType(), device.getUDN(), nt, usn);
-    process(nt, usn, device_url, max_age, udp);
-
-    // announce with service udn
-    for (auto &service : device.getServices()) {
-      setupData(service.service_type, device.getUDN(), nt, usn);
-      process(nt, usn, device_url, max_age, udp);
+  bool process(IUDPService &udp) override {
+    DLNA_LOG(DlnaInfo, "Sending %s to %s", name(),
+             DLNABroadcastAddress.toString());
+    if (p_interfaces == nullptr || p_interfaces->empty()) {
+      return p_cache->sendAlive(*p_device, udp);
     }
-    return true;
+    bool result = true;
+    for (auto &net : *p_interfaces) {
+      result = net.ssdp_cache.sendAlive(*p_device, *net.p_udp) && result;
+    }
+    return result;
   }
 
  protected:
   DLNADevice *p_device;
-  void setupData(const char *nt, const char *udn, char *result_nt,
-                 char *result_usn) {
-    strcpy(result_nt, nt);
-    strcpy(result_usn, udn);
-    strcat(result_usn, "::");
-    strcat(result_usn, nt);
-  }
-
-  bool process(const char *nt, const char *usn, const char *device_url,
-               int max_age, IUDPService &udp) {
-    // we keep the data on the stack
-    char buffer[MAX_TMP_SIZE] = {0};
-    const char *tmp =
-        "NOTIFY * HTTP/1.1\r\n"
-        "HOST:%s\r\n"
-        "CACHE-CONTROL: max-age = %d\r\n"
-        "LOCATION: %s\r\n"
-        "NT: %s\r\n"
-        "NTS: ssdp:alive\r\n"
-        "USN: %s\r\n\r\n";
-    int n = snprintf(buffer, MAX_TMP_SIZE, tmp, DLNABroadcastAddress.toString(),
-                     max_age, device_url, nt, usn);
-
-    assert(n < MAX_TMP_SIZE);
-    DlnaLogger.log(DlnaDebug, "sending: %s", buffer);
-    udp.send(DLNABroadcastAddress, (uint8_t *)buffer, n);
-    return true;
-  }
+  SSDPPacketCache *p_cache;
+  Vector<DLNAInterface> *p_interfaces = nullptr;
 };
 
 /**
@@ -234,76 +266,34 @@ class PostAliveSchedule : public Schedule {
  */
 class PostByeSchedule : public Schedule {
  public:
-  PostByeSchedule(DLNADevice &device) { p_device = &device; }
-  const char *name() override { return "ByeBye"; }
-  bool process(IUDPService &udp) override {
-    DlnaLogger.log(DlnaInfo, "Sending %s to %s", name(),
-                   DLNABroadcastAddress.toString());
-    // we keep the data on the stack
-    char buffer[MAX_TMP_SIZE] = {0};
-    const char *tmp =
-        "NOTIFY * HTTP/1.1\r\n"
-        "HOST: %s\r\n"
-        "CACHE-CONTROL: max-age = %d\r\n"
-        "LOCATION: *\r\n"
-        "NT: %s\r\n"
-        "NTS: ssdp:byebye\r\n"
-        "USN: %s\r\n\r\n";
-    int n = snprintf(buffer, MAX_TMP_SIZE, tmp, DLNABroadcastAddress.toString(),
-                     max_age, p_device->getDeviceType(), p_device->getUDN());
-
-    DlnaLogger.log(DlnaDebug, "sending: %s", buffer);
-    udp.send(DLNABroadcastAddress, (uint8_t *)buffer, n);
-    return true;
+  PostByeSchedule(DLNADevice &device, SSDPPacketCache &cache) {
+    p_device = &device;
+    p_cache = &cache;
   }
+  const char *name() override { return "ByeBye"; }
 
- protected:
-  int max_age = 120;
-  DLNADevice *p_device;
-};
-
-/**
- * @brief Send SUBSCRIBE message via UDP unicast
- * @author Phil Schatzmann
- */
-class PostSubscribe : public Schedule {
- public:
-  PostSubscribe(IPAddressAndPort address, const char *path, uint32_t sec) {
-    setDestination(address, path);
-    setDuration(sec);
+  /// Sends the messages on all interfaces (instead of the cache)
+  void setInterfaces(Vector<DLNAInterface> &interfaces) {
+    p_interfaces = &interfaces;
   }
-  const char *name() override { return "Subscribe"; }
 
   bool process(IUDPService &udp) override {
-    ///
-    DlnaLogger.log(DlnaInfo, "Sending Subscribe  to %s", address);
-
-    char buffer[MAX_TMP_SIZE] = {0};
-    const char *tmp =
-        "SUBSCRIBE %s HTTP/1.1\r\n"
-        "HOST: %s\r\n"
-        "CALLBACK: %s"
-        "NT: upnp-event\r\n"
-        "TIMEOUT: Second-%d\r\n\r\n";
-    int n = snprintf(buffer, MAX_TMP_SIZE, tmp, path, address.toString(),
-                     durationSec);
-    assert(n < MAX_TMP_SIZE);
-    DlnaLogger.log(DlnaDebug, "sending: %s", buffer);
-    udp.send(address, (uint8_t *)buffer, n);
-    return true;
+    DLNA_LOG(DlnaInfo, "Sending %s to %s", name(),
+             DLNABroadcastAddress.toString());
+    if (p_interfaces == nullptr || p_interfaces->empty()) {
+      return p_cache->sendBye(*p_device, udp);
+    }
+    bool result = true;
+    for (auto &net : *p_interfaces) {
+      result = net.ssdp_cache.sendBye(*p_device, *net.p_udp) && result;
+    }
+    return result;
   }
 
  protected:
-  IPAddressAndPort address;
-  const char *path;
-  int durationSec;
-
-  void setDestination(IPAddressAndPort address, const char *path) {
-    this->address = address;
-    this->path = path;
-  }
-
-  void setDuration(uint32_t sec) { durationSec = sec; }
+  DLNADevice *p_device;
+  SSDPPacketCache *p_cache;
+  Vector<DLNAInterface> *p_interfaces = nullptr;
 };
 
 }  // namespace tiny_dlna
\ No newline at end of file
@@ -4,11 +4,15 @@
 #include "DLNADevice.h"
 #include "IUDPService.h"
 #include "Schedule.h"
+#include "basic/Metrics.h"
 
 namespace tiny_dlna {
 
 /**
- * @brief Scheduler which processes all due Schedules (to send out UDP replies)
+ * @brief Scheduler which processes all due Schedules (to send out UDP replies).
+ * The schedules are kept in a binary min-heap which is ordered by the
+ * Schedule::time, so that we only need to touch the due entries. The delay
+ * between the Schedule::time and the execution is recorded in the DlnaMetrics.
  * @author Phil Schatzmann
  */
 
@@ -16,60 +20,121 @@ class Scheduler {
  public:
   /// Add a schedule to the scheduler
   void add(Schedule *schedule) {
+    if (schedule == nullptr) return;
     schedule->active = true;
-    DlnaLogger.log(DlnaInfo, "Schedule %s", schedule->name());
+    DLNA_LOG(DlnaInfo, "Schedule %s", schedule->name());
     queue.push_back(schedule);
+    siftUp(queue.size() - 1);
   }
 
   /// Execute all due schedules
   void execute(IUDPService &udp) {
-    // DlnaLogger.log(DlnaDebug, "Scheduler::execute");
-    bool is_cleanup = false;
-    for (auto &p_s : queue) {
-      if (p_s == nullptr) continue;
+    // DLNA_LOG(DlnaDebug, "Scheduler::execute");
+    uint64_t now = millis();
+    while (!queue.empty() && queue[0]->time <= now) {
+      Schedule *p_s = pop();
       Schedule &s = *p_s;
-      if (millis() >= s.time) {
-        // handle end time: if expired set inactive
-        if (s.end_time != 0ul && millis() > s.end_time) {
-          s.active = false;
+      // handle end time: if expired set inactive
+      if (s.end_time != 0ul && now > s.end_time) {
+        s.active = false;
+      }
+      // process active schedules
+      if (s.active) {
+        DLNA_LOG(DlnaDebug, "Executing %s", s.name());
+        // time 0 means as soon as possible
+        if (s.time > 0) {
+          DlnaMetrics.record(HIST_SCHEDULER_LAG_MS, now - s.time);
         }
-        // process active schedules
-        if (s.active) {
-          DlnaLogger.log(DlnaDebug, "Executing", s.name());
-
-          s.process(udp);
-          // reschedule if necessary
-          if (s.repeat_ms > 0) {
-            s.time = millis() + s.repeat_ms;
-          } else {
-            s.active = false;
-            is_cleanup = true;
-          }
-        } else {
-          DlnaLogger.log(DlnaDebug, "Inactive", s.name());
+        s.process(udp);
+        // reschedule if necessary
+        if (s.repeat_ms > 0) {
+          s.time = now + s.repeat_ms;
+          queue.push_back(p_s);
+          siftUp(queue.size() - 1);
+          continue;
         }
+      } else {
+        DLNA_LOG(DlnaDebug, "Inactive %s", s.name());
       }
+      // remove processed or inactive schedule
+      DLNA_LOG(DlnaDebug, "cleanup queue: %s", s.name());
+      release(p_s);
     }
+  }
+
+  /// Provides the number of ms until the next schedule is due (0 if one is
+  /// already due). If there is no schedule we return maxMs.
+  uint32_t timeToNext(uint32_t maxMs = 0xFFFFFFFF) {
+    if (queue.empty()) return maxMs;
+    uint64_t now = millis();
+    uint64_t next = queue[0]->time;
+    if (next <= now) return 0;
+    uint64_t diff = next - now;
+    return diff < maxMs ? (uint32_t)diff : maxMs;
+  }
+
+  /// Number of scheduled entries
+  int size() { return queue.size(); }
 
-    if (is_cleanup) cleanup();
+  /// Removes and deletes all schedules
+  void clear() {
+    for (auto &p_s : queue) release(p_s);
+    queue.clear();
   }
 
  protected:
+  // binary min-heap ordered by Schedule::time
   Vector<Schedule *> queue;
 
-  void cleanup() {
-    for (auto it = queue.begin(); it != queue.end(); ++it) {
-      auto p_rule = *it;
-      if (!(p_rule)->active) {
-        DlnaLogger.log(DlnaDebug, "cleanup queue: %s", p_rule->name());
-        // remove schedule from collection
-        queue.erase(it);
-        // delete schedule
-        delete p_rule;
-        break;
+  /// deletes the schedule or returns it to its pool
+  void release(Schedule *p_s) {
+    if (p_s->p_allocator != nullptr) {
+      p_s->p_allocator->remove(p_s);
+    } else {
+      delete p_s;
+    }
+  }
+
+  /// removes the first (=earliest) entry from the heap
+  Schedule *pop() {
+    Schedule *result = queue[0];
+    int last = queue.size() - 1;
+    queue[0] = queue[last];
+    queue.pop_back();
+    if (!queue.empty()) siftDown(0);
+    return result;
+  }
+
+  void siftUp(int pos) {
+    while (pos > 0) {
+      int parent = (pos - 1) / 2;
+      if (queue[parent]->time <= queue[pos]->time) break;
+      swap(parent, pos);
+      pos = parent;
+    }
+  }
+
+  void siftDown(int pos) {
+    int size = queue.size();
+    while (true) {
+      int left = 2 * pos + 1;
+      if (left >= size) break;
+      int smallest = left;
+      int right = left + 1;
+      if (right < size && queue[right]->time < queue[left]->time) {
+        smallest = right;
       }
+      if (queue[pos]->time <= queue[smallest]->time) break;
+      swap(pos, smallest);
+      pos = smallest;
     }
   }
+
+  void swap(int a, int b) {
+    Schedule *tmp = queue[a];
+    queue[a] = queue[b];
+    queue[b] = tmp;
+  }
 };
 
-}  // namespace tiny_dlna
\ No newline at end of file
+}  // namespace tiny_dlna
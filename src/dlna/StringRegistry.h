@@ -1,40 +1,163 @@
 #pragma once
-#include "basic/Str.h"
+#include <string.h>
+
+#include "basic/Logger.h"
+#include "basic/Vector.h"
+
+// size of the memory blocks in which the strings are stored
+#ifndef DLNA_STRING_REGISTRY_BLOCK_SIZE
+#define DLNA_STRING_REGISTRY_BLOCK_SIZE 512
+#endif
 
 namespace tiny_dlna {
 /***
- * @brief Make sure that a string is stored only once
+ * @brief Make sure that a string is stored only once. The strings are
+ * stored one after the other in memory blocks which are never moved, so the
+ * returned pointers stay valid until clear() is called. The lookup uses an
+ * open addressing hash table.
  * @author Phil Schatzmann
  */
 class StringRegistry {
  public:
+  StringRegistry() = default;
+  StringRegistry(const StringRegistry&) = delete;
+  StringRegistry& operator=(const StringRegistry&) = delete;
+  ~StringRegistry() { clear(); }
+
   /// adds a string
-  const char* add(char* in) {
-    for (auto& str : strings) {
-      if (str.equals(in)) {
-        return str.c_str();
-      }
+  const char* add(const char* in) {
+    if (in == nullptr) return nullptr;
+    // keep the load factor <= 0.5
+    if ((string_count + 1) * 2 > (size_t)slots.size()) {
+      rehash(slots.size() * 2);
     }
-    strings.push_back(in);
-    return strings[strings.size() - 1].c_str();
+    uint32_t hash_value = hash(in);
+    int pos = find(in, hash_value);
+    if (slots[pos].str != nullptr) return slots[pos].str;
+
+    const char* result = store(in);
+    if (result == nullptr) return nullptr;
+    slots[pos].str = result;
+    slots[pos].hash = hash_value;
+    string_count++;
+    return result;
+  }
+
+  /// Removes all strings: the provided pointers are not valid any more
+  void clear() {
+    for (auto block : blocks) delete[] block;
+    blocks.clear();
+    slots.clear();
+    string_count = 0;
+    total_len = 0;
+    p_block = nullptr;
+    block_used = 0;
   }
 
-  void clear() { strings.clear(); }
+  /// Exchanges the content with the other registry
+  void swap(StringRegistry& other) {
+    slots.swap(other.slots);
+    blocks.swap(other.blocks);
+    swapValue(p_block, other.p_block);
+    swapValue(block_used, other.block_used);
+    swapValue(string_count, other.string_count);
+    swapValue(total_len, other.total_len);
+  }
 
   /// Reports the number of strings
-  size_t count() { return strings.size();}
+  size_t count() { return string_count; }
 
   /// Reports the total size of all allocated strings
-  size_t size() {
-    size_t total = 0;
-    for (auto &str : strings){
-      total += str.length();
+  size_t size() { return total_len; }
+
+ protected:
+  struct Slot {
+    const char* str = nullptr;
+    uint32_t hash = 0;
+  };
+  Vector<Slot> slots;
+  Vector<char*> blocks;
+  // actual block for the short strings and the used bytes in it
+  char* p_block = nullptr;
+  int block_used = 0;
+  size_t string_count = 0;
+  size_t total_len = 0;
+
+  template <typename T>
+  void swapValue(T& a, T& b) {
+    T tmp = a;
+    a = b;
+    b = tmp;
+  }
+
+  /// FNV-1a hash
+  uint32_t hash(const char* str) {
+    uint32_t result = 2166136261u;
+    for (const char* p = str; *p != 0; p++) {
+      result = (result ^ (uint8_t)*p) * 16777619u;
     }
-    return total;
+    return result;
   }
 
- protected:
-  Vector<Str> strings;
+  /// provides the slot with the string or the free slot where it belongs
+  int find(const char* str, uint32_t hash_value) {
+    int mask = slots.size() - 1;
+    int pos = hash_value & mask;
+    while (slots[pos].str != nullptr) {
+      if (slots[pos].hash == hash_value && strcmp(slots[pos].str, str) == 0) {
+        break;
+      }
+      pos = (pos + 1) & mask;
+    }
+    return pos;
+  }
+
+  /// rebuilds the hash table with the new size (a power of 2)
+  void rehash(int newSize) {
+    if (newSize < 16) newSize = 16;
+    Vector<Slot> old;
+    old.swap(slots);
+    slots.resize(newSize);
+    Slot empty;
+    for (auto& slot : slots) slot = empty;
+    for (auto& slot : old) {
+      if (slot.str != nullptr) slots[find(slot.str, slot.hash)] = slot;
+    }
+  }
+
+  /// copies the string into the arena
+  const char* store(const char* in) {
+    int len = strlen(in) + 1;
+    char* result = nullptr;
+    if (len > DLNA_STRING_REGISTRY_BLOCK_SIZE / 2) {
+      // long strings get their own block
+      result = allocate(len);
+    } else {
+      if (p_block == nullptr ||
+          len > DLNA_STRING_REGISTRY_BLOCK_SIZE - block_used) {
+        p_block = allocate(DLNA_STRING_REGISTRY_BLOCK_SIZE);
+        block_used = 0;
+      }
+      if (p_block != nullptr) {
+        result = p_block + block_used;
+        block_used += len;
+      }
+    }
+    if (result == nullptr) {
+      DLNA_LOG(DlnaError, "StringRegistry: not enough memory");
+      return nullptr;
+    }
+    memcpy(result, in, len);
+    total_len += len - 1;
+    return result;
+  }
+
+  /// allocates a new block
+  char* allocate(int size) {
+    char* result = new char[size];
+    if (result != nullptr) blocks.push_back(result);
+    return result;
+  }
 };
 
-}  // namespace tiny_dlna
\ No newline at end of file
+}  // namespace tiny_dlna
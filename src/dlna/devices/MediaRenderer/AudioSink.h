@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Print.h"
+
+// max number of bytes which are moved in one step from the prefetch buffer
+#ifndef DLNA_PIPELINE_BLOCK_SIZE
+#define DLNA_PIPELINE_BLOCK_SIZE 512
+#endif
+
+namespace tiny_dlna {
+
+/**
+ * @brief Destination of the audio data of the MediaPipeline: e.g. a decoder
+ * which outputs to I2S. The data is provided as it has been received (e.g.
+ * mp3), so the sink needs to decode it.
+ * @author Phil Schatzmann
+ */
+class AudioSink {
+ public:
+  virtual ~AudioSink() = default;
+
+  /// Called before the first data of a stream with the Content-Type (or
+  /// nullptr): return false if the format is not supported
+  virtual bool begin(const char* mime) { return true; }
+
+  /// Called when the playback has been stopped or has ended
+  virtual void end() {}
+
+  /// Max number of bytes which can be written w/o blocking
+  virtual int availableForWrite() { return DLNA_PIPELINE_BLOCK_SIZE; }
+
+  /// Writes the audio data: returns the number of accepted bytes
+  virtual size_t write(const uint8_t* data, size_t len) = 0;
+};
+
+/**
+ * @brief AudioSink which forwards the data to a Print (e.g. the input stream
+ * of a decoder).
+ * @author Phil Schatzmann
+ */
+class AudioSinkPrint : public AudioSink {
+ public:
+  AudioSinkPrint() = default;
+  AudioSinkPrint(Print& out) { setOutput(out); }
+
+  void setOutput(Print& out) { p_out = &out; }
+
+  size_t write(const uint8_t* data, size_t len) override {
+    if (p_out == nullptr) return 0;
+    return p_out->write(data, len);
+  }
+
+ protected:
+  Print* p_out = nullptr;
+};
+
+}  // namespace tiny_dlna
@@ -0,0 +1,617 @@
+#pragma once
+
+#include "AudioSink.h"
+#include "basic/Logger.h"
+#include "basic/Metrics.h"
+#include "basic/RingBuffer.h"
+#include "basic/Str.h"
+#include "basic/Url.h"
+#include "http/Server/HttpRequest.h"
+
+#if defined(ESP32)
+#include <atomic>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#endif
+
+// size of the prefetch buffer in bytes
+#ifndef DLNA_PIPELINE_BUFFER_SIZE
+#define DLNA_PIPELINE_BUFFER_SIZE (16 * 1024)
+#endif
+
+// number of bytes which are buffered before the playback starts
+#ifndef DLNA_PIPELINE_PREFETCH_SIZE
+#define DLNA_PIPELINE_PREFETCH_SIZE (8 * 1024)
+#endif
+
+// max number of blocks which are moved by one call of copy()
+#ifndef DLNA_PIPELINE_COPY_BLOCKS
+#define DLNA_PIPELINE_COPY_BLOCKS 8
+#endif
+
+// max number of redirects which are followed when opening an uri
+#ifndef DLNA_PIPELINE_MAX_REDIRECTS
+#define DLNA_PIPELINE_MAX_REDIRECTS 3
+#endif
+
+// max time in ms to wait for the reply header when opening an uri
+#ifndef DLNA_PIPELINE_OPEN_TIMEOUT
+#define DLNA_PIPELINE_OPEN_TIMEOUT 5000
+#endif
+
+#if defined(ESP32)
+#ifndef DLNA_PIPELINE_STACK_SIZE
+#define DLNA_PIPELINE_STACK_SIZE 6144
+#endif
+
+#ifndef DLNA_PIPELINE_PRIORITY
+#define DLNA_PIPELINE_PRIORITY 6
+#endif
+
+#ifndef DLNA_PIPELINE_CORE
+#define DLNA_PIPELINE_CORE 1
+#endif
+#endif
+
+namespace tiny_dlna {
+
+/// State of the MediaPipeline
+enum PipelineState {
+  PIPELINE_STOPPED,
+  PIPELINE_BUFFERING,
+  PIPELINE_PLAYING,
+  PIPELINE_PAUSED,
+  PIPELINE_ENDED,
+  PIPELINE_ERROR
+};
+
+/**
+ * @brief Playback pipeline of the MediaRenderer: the uri is requested with a
+ * HttpRequest (which removes a chunked transfer encoding with the
+ * HttpChunkReader) and the data is prefetched into a RingBuffer by fill().
+ * copy() moves the data from the buffer to the AudioSink as soon as the
+ * prefetch size has been reached. If the buffer runs empty the playback is
+ * suspended until it has been refilled (underrun).
+ *
+ * Gapless playback: when the current stream has been received completely the
+ * next uri is requested right away, while the buffered data is still played,
+ * and the data is appended to the same buffer. Connections to the same host
+ * are kept alive.
+ *
+ * On the ESP32 fill() runs in a separate task which is started by begin():
+ * the buffer and the commands are protected by a mutex. Otherwise fill() is
+ * called by copy().
+ *
+ * An uri is opened in separate steps (connect, send, wait for the reply
+ * header), so that the waiting for the server does not block. Only the
+ * connect of the Arduino Client API is blocking (up to the timeout of the
+ * httpRequest()): without the fill task it is never done by copy() but by
+ * play() (i.e. in the Play action) and by update() for redirects and for the
+ * gapless next uri on a different host.
+ * @author Phil Schatzmann
+ */
+class MediaPipeline {
+ public:
+  MediaPipeline(int bufferSize = DLNA_PIPELINE_BUFFER_SIZE)
+      : buffer(bufferSize) {
+    request.setKeepAlive(true);
+  }
+
+  ~MediaPipeline() {
+    end();
+#if defined(ESP32)
+    if (mutex != nullptr) vSemaphoreDelete(mutex);
+#endif
+  }
+
+  /// Defines the output of the audio data
+  void setSink(AudioSink& sink) { p_sink = &sink; }
+
+  AudioSink* sink() { return p_sink; }
+
+  /// Defines the size of the prefetch buffer: call before begin()
+  void setBufferSize(int size) {
+    lock();
+    buffer.resize(size);
+    unlock();
+  }
+
+  /// Defines the number of bytes which are buffered before the playback
+  /// starts (or restarts after an underrun)
+  void setPrefetchSize(int size) { prefetch_size = size; }
+
+#if defined(ESP32)
+  /// Defines if fill() runs in a separate task: call before begin()
+  void setTaskActive(bool active) { is_task = active; }
+#endif
+
+  /// Starts the fill task (on the ESP32)
+  bool begin() {
+#if defined(ESP32)
+    if (!is_task || task_active) return true;
+    is_task_stop = false;
+    task_active = true;
+    if (xTaskCreatePinnedToCore(taskFn, "dlna-pipeline",
+                                DLNA_PIPELINE_STACK_SIZE, this,
+                                DLNA_PIPELINE_PRIORITY, &task,
+                                DLNA_PIPELINE_CORE) != pdPASS) {
+      DLNA_LOG(DlnaError, "pipeline task failed");
+      task_active = false;
+      return false;
+    }
+#endif
+    return true;
+  }
+
+  /// Stops the playback and the fill task
+  void end() {
+    stop();
+#if defined(ESP32)
+    if (task_active) {
+      is_task_stop = true;
+      while (task_active) delay(10);
+      task = nullptr;
+    }
+#endif
+    closeRequest();
+    closeSink();
+  }
+
+  /// Defines the uri of the media: a running playback is stopped
+  void setURI(const char* uri) {
+    lock();
+    current_uri = uri;
+    next_uri = "";
+    unlock();
+    stop();
+  }
+
+  /// Defines the uri which is played (gapless) after the current one
+  void setNextURI(const char* uri) {
+    lock();
+    next_uri = uri;
+    unlock();
+  }
+
+  /// Starts or resumes the playback
+  bool play() {
+    lock();
+    bool result = !current_uri.isEmpty();
+    if (result) {
+      if (state == PIPELINE_PAUSED) {
+        state = PIPELINE_PLAYING;
+      } else if (state != PIPELINE_PLAYING && state != PIPELINE_BUFFERING) {
+        discard();
+        is_open_request = true;
+        is_received_end = false;
+        has_track_start = false;
+        state = PIPELINE_BUFFERING;
+      }
+    }
+    unlock();
+    // the blocking connect is done right away and not in copy()
+    if (result) update();
+    return result;
+  }
+
+  /// Suspends the output: the buffer is still filled
+  void pause() {
+    lock();
+    if (state == PIPELINE_PLAYING || state == PIPELINE_BUFFERING) {
+      state = PIPELINE_PAUSED;
+    }
+    unlock();
+  }
+
+  /// Stops the playback and discards the buffered data
+  void stop() {
+    lock();
+    if (state != PIPELINE_STOPPED) is_close_request = true;
+    is_open_request = false;
+    discard();
+    state = PIPELINE_STOPPED;
+    unlock();
+  }
+
+  /// Reads the next block of data from the http stream into the buffer or
+  /// executes the next step of the opening of an uri: returns true if some
+  /// processing was done
+  bool fill() { return fillStep(true); }
+
+  /// Executes a pending (blocking) connect when fill() is not running in its
+  /// own task: call regularly outside of the audio output e.g. in the loop().
+  /// Returns true if a connect was done.
+  bool update() {
+    if (isTaskActive()) return false;
+    processCommands();
+    if (open_step != OPEN_CONNECT) return false;
+    processOpen();
+    return true;
+  }
+
+
+  /// Moves the buffered data to the sink (up to DLNA_PIPELINE_COPY_BLOCKS):
+  /// call as often as possible. Returns the number of written bytes.
+  size_t copy() {
+    size_t result = 0;
+    for (int j = 0; j < DLNA_PIPELINE_COPY_BLOCKS; j++) {
+      // the connect is left to update()
+      if (!isTaskActive()) fillStep(false);
+      size_t len = copyBlock();
+      if (len == 0) break;
+      result += len;
+    }
+    return result;
+  }
+
+  PipelineState getState() { return state; }
+
+  /// Returns true while the audio data is output
+  bool isPlaying() { return state == PIPELINE_PLAYING; }
+
+  /// Returns true if the last stream has been played completely
+  bool isEnded() { return state == PIPELINE_ENDED; }
+
+  /// Uri of the stream which is currently received
+  const char* getURI() { return current_uri.c_str(); }
+
+  /// Number of gapless track changes (to the next uri)
+  uint32_t trackCount() { return track_count; }
+
+  /// Capacity of the prefetch buffer in bytes
+  int bufferSize() { return buffer.size(); }
+
+  /// Number of buffered bytes
+  int bufferAvailable() { return buffer.available(); }
+
+  /// Fill level of the prefetch buffer in percent
+  int bufferPercent() {
+    return buffer.size() == 0 ? 0 : buffer.available() * 100 / buffer.size();
+  }
+
+  /// Number of times the buffer has run empty during the playback
+  uint32_t underrunCount() { return underrun_count; }
+
+  /// Total number of received bytes
+  uint64_t bytesReceived() { return bytes_received; }
+
+  /// Total number of bytes written to the sink
+  uint64_t bytesPlayed() { return bytes_played; }
+
+  /// Provides access to the http request: e.g. to define the agent
+  HttpRequest& httpRequest() { return request; }
+
+ protected:
+  HttpRequest request;
+  RingBuffer buffer;
+  AudioSink* p_sink = nullptr;
+  int prefetch_size = DLNA_PIPELINE_PREFETCH_SIZE;
+  volatile PipelineState state = PIPELINE_STOPPED;
+  // shared state: protected by lock()
+  Str current_uri;
+  Str next_uri;
+  Str mime;
+  bool is_open_request = false;
+  bool is_close_request = false;
+  bool is_received_end = false;
+  bool has_track_start = false;
+  uint64_t track_start = 0;
+  uint64_t bytes_received = 0;
+  // position of the next buffer read relative to bytes_received
+  uint64_t read_pos = 0;
+  uint32_t track_count = 0;
+  // only used by fill()
+  /// Steps of the opening of an uri
+  enum OpenStep { OPEN_NONE, OPEN_CONNECT, OPEN_SEND, OPEN_HEADER };
+  OpenStep open_step = OPEN_NONE;
+  Url open_url;
+  Str open_uri;
+  int open_redirects = 0;
+  uint32_t open_start = 0;
+  bool is_open_next = false;
+  bool is_request_open = false;
+  uint8_t fill_block[DLNA_PIPELINE_BLOCK_SIZE];
+  // only used by copy()
+  uint8_t out_block[DLNA_PIPELINE_BLOCK_SIZE];
+  int out_pos = 0;
+  int out_len = 0;
+  bool is_sink_active = false;
+  uint64_t bytes_played = 0;
+  uint32_t underrun_count = 0;
+#if defined(ESP32)
+  SemaphoreHandle_t mutex = xSemaphoreCreateMutex();
+  TaskHandle_t task = nullptr;
+  bool is_task = true;
+  std::atomic<bool> is_task_stop{false};
+  std::atomic<bool> task_active{false};
+
+  static void taskFn(void* ref) {
+    MediaPipeline* self = (MediaPipeline*)ref;
+    while (!self->is_task_stop) {
+      if (!self->fill()) delay(5);
+    }
+    self->task_active = false;
+    vTaskDelete(nullptr);
+  }
+
+  void lock() { xSemaphoreTake(mutex, portMAX_DELAY); }
+  void unlock() { xSemaphoreGive(mutex); }
+  bool isTaskActive() { return task_active; }
+#else
+  void lock() {}
+  void unlock() {}
+  bool isTaskActive() { return false; }
+#endif
+
+  /// Reads the next block or executes the next open step: the connect is
+  /// skipped if isConnect is false
+  bool fillStep(bool isConnect) {
+    bool result = processCommands();
+    if (open_step == OPEN_CONNECT && !isConnect) return result;
+    if (open_step != OPEN_NONE) return processOpen();
+    if (!is_request_open) return result;
+
+    lock();
+    int len = buffer.availableToWrite();
+    unlock();
+    if (len > (int)sizeof(fill_block)) len = sizeof(fill_block);
+    if (len > 0) len = request.read(fill_block, len);
+    if (len > 0) {
+      lock();
+      // the data is dropped if the playback was stopped in the meantime
+      if (!is_close_request && !is_open_request) {
+        buffer.write(fill_block, len);
+        bytes_received += len;
+      }
+      unlock();
+    }
+
+    if (request.isReplyComplete()) {
+      closeRequest();
+      openNext();
+      return true;
+    }
+    return len > 0;
+  }
+
+  /// Executes the requested stop or play: returns true if there was one
+  bool processCommands() {
+    lock();
+    bool is_close = is_close_request;
+    bool is_open = is_open_request;
+    is_close_request = false;
+    is_open_request = false;
+    if (is_open) open_uri = current_uri;
+    unlock();
+
+    if (is_close || is_open) closeRequest();
+    if (is_open) startOpen(open_uri.c_str(), false);
+    return is_close || is_open;
+  }
+
+  /// Writes the next block to the sink
+  size_t copyBlock() {
+    if (p_sink == nullptr) return 0;
+    lock();
+    PipelineState actual = state;
+    if (actual == PIPELINE_BUFFERING &&
+        (buffer.available() >= prefetch_size ||
+         buffer.availableToWrite() == 0 || is_received_end)) {
+      state = PIPELINE_PLAYING;
+      actual = PIPELINE_PLAYING;
+    }
+    unlock();
+
+    if (actual == PIPELINE_STOPPED || actual == PIPELINE_ERROR) {
+      out_len = 0;
+      closeSink();
+      return 0;
+    }
+    if (actual != PIPELINE_PLAYING) return 0;
+
+    if (!is_sink_active) {
+      lock();
+      Str mime_type = mime;
+      unlock();
+      is_sink_active = true;
+      if (!p_sink->begin(mime_type.isEmpty() ? nullptr : mime_type.c_str())) {
+        DLNA_LOG(DlnaError, "unsupported format: %s", mime_type.c_str());
+        lock();
+        state = PIPELINE_ERROR;
+        unlock();
+        return 0;
+      }
+    }
+
+    // refill the output block
+    if (out_len == 0) {
+      lock();
+      int max = p_sink->availableForWrite();
+      if (max > (int)sizeof(out_block)) max = sizeof(out_block);
+      out_pos = 0;
+      out_len = max > 0 ? buffer.read(out_block, max) : 0;
+      read_pos += out_len;
+      // report the start of the next (gapless) track
+      if (has_track_start && read_pos > track_start) {
+        has_track_start = false;
+        track_count++;
+      }
+      bool is_empty = out_len == 0 && max > 0;
+      if (is_empty) {
+        if (is_received_end) {
+          state = PIPELINE_ENDED;
+        } else {
+          underrun_count++;
+          DlnaMetrics.add(CNT_AUDIO_UNDERRUNS);
+          state = PIPELINE_BUFFERING;
+        }
+      }
+      unlock();
+      if (is_empty && state == PIPELINE_ENDED) closeSink();
+    }
+    if (out_len == 0) return 0;
+
+    size_t result = p_sink->write(out_block + out_pos, out_len);
+    out_pos += result;
+    out_len -= result;
+    bytes_played += result;
+    return result;
+  }
+
+  /// Starts the opening of the uri: isNext is true for the gapless next uri
+  void startOpen(const char* uri, bool isNext) {
+    open_url.setUrl(uri);
+    open_redirects = 0;
+    is_open_next = isNext;
+    open_step = OPEN_CONNECT;
+  }
+
+  /// Executes the next step of the GET request and follows redirects
+  bool processOpen() {
+    switch (open_step) {
+      case OPEN_CONNECT:
+        DLNA_LOG(DlnaInfo, "pipeline open: %s", open_url.url());
+        if (!request.open(open_url)) {
+          DLNA_LOG(DlnaError, "pipeline connect failed: %s", open_url.url());
+          return openFailed();
+        }
+        open_step = OPEN_SEND;
+        return true;
+
+      case OPEN_SEND:
+        if (!request.send(T_GET, open_url, nullptr, nullptr)) {
+          DLNA_LOG(DlnaError, "pipeline send failed: %s", open_url.url());
+          return openFailed();
+        }
+        open_start = millis();
+        open_step = OPEN_HEADER;
+        return true;
+
+      case OPEN_HEADER: {
+        // wait until we can read the reply header w/o blocking
+        if (!request.isReplyHeaderAvailable()) {
+          if (request.connected() &&
+              millis() - open_start < DLNA_PIPELINE_OPEN_TIMEOUT) {
+            return false;
+          }
+          DLNA_LOG(DlnaError, "pipeline open: no reply");
+          return openFailed();
+        }
+        int rc = request.receive(T_GET);
+        if (rc == 200) {
+          lock();
+          mime = request.reply().get(CONTENT_TYPE);
+          unlock();
+          is_request_open = true;
+          open_step = OPEN_NONE;
+          return true;
+        }
+        const char* redirect = request.reply().get(LOCATION);
+        if (rc < 300 || rc >= 400 || redirect == nullptr) {
+          DLNA_LOG(DlnaError, "pipeline open failed: %d", rc);
+          return openFailed();
+        }
+        if (open_redirects >= DLNA_PIPELINE_MAX_REDIRECTS) {
+          DLNA_LOG(DlnaError, "pipeline open: too many redirects");
+          return openFailed();
+        }
+        Str location;
+        resolveLocation(open_url, redirect, location);
+        request.stop();
+        open_url.setUrl(location.c_str());
+        open_redirects++;
+        open_step = OPEN_CONNECT;
+        return true;
+      }
+
+      default:
+        return false;
+    }
+  }
+
+  /// Ends the opening: the playback fails or ends with the data received
+  /// so far for the gapless next uri
+  bool openFailed() {
+    request.stop();
+    open_step = OPEN_NONE;
+    lock();
+    if (is_open_next) {
+      is_received_end = true;
+      has_track_start = false;
+    } else if (state == PIPELINE_BUFFERING) {
+      state = PIPELINE_ERROR;
+    }
+    unlock();
+    return true;
+  }
+
+  /// Resolves the (potentially relative) Location of a redirect against the
+  /// request url
+  void resolveLocation(Url& base, const char* redirect, Str& result) {
+    if (strstr(redirect, "://") != nullptr) {
+      result = redirect;
+    } else if (strncmp(redirect, "//", 2) == 0) {
+      // network path reference: we keep the protocol
+      result = base.protocol();
+      result += ":";
+      result += redirect;
+    } else {
+      result = base.urlRoot();
+      if (redirect[0] != '/') {
+        // relative to the directory of the request path w/o query
+        const char* path = base.path();
+        int len = strcspn(path, "?#");
+        while (len > 0 && path[len - 1] != '/') len--;
+        if (len == 0) result += "/";
+        result.append(path, len);
+      }
+      result += redirect;
+    }
+  }
+
+  /// Removes the buffered data: call with the lock
+  void discard() {
+    buffer.clear();
+    read_pos = bytes_received;
+  }
+
+  void closeRequest() {
+    if (!is_request_open && open_step == OPEN_NONE) return;
+    request.stop();
+    is_request_open = false;
+    open_step = OPEN_NONE;
+  }
+
+  /// Requests the next uri (if defined) when the current stream is complete
+  void openNext() {
+    lock();
+    bool is_next = !next_uri.isEmpty();
+    if (is_next) {
+      open_uri = next_uri;
+      current_uri = next_uri;
+      next_uri = "";
+      track_start = bytes_received;
+      has_track_start = true;
+    }
+    unlock();
+
+    if (is_next) {
+      startOpen(open_uri.c_str(), true);
+      return;
+    }
+    // a started track is still reported when it is played
+    lock();
+    is_received_end = true;
+    unlock();
+  }
+
+  void closeSink() {
+    if (!is_sink_active) return;
+    is_sink_active = false;
+    p_sink->end();
+  }
+};
+
+}  // namespace tiny_dlna
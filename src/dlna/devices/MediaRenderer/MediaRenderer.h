@@ -1,3 +1,6 @@
+#pragma once
+
+#include "MediaPipeline.h"
 #include "conmgr.h"
 #include "control.h"
 #include "dlna/DLNADeviceMgr.h"
@@ -5,60 +8,462 @@
 
 namespace tiny_dlna {
 
+/// Events of the MediaRenderer which were triggered by a control point
+enum MediaEvent {
+  SET_URI,
+  SET_NEXT_URI,
+  PLAY,
+  PAUSE,
+  STOP,
+  SET_VOLUME,
+  SET_MUTE
+};
+
+class MediaRenderer;
+
+/// Callback which is called when a control point has changed the renderer
+typedef void (*MediaEventCallback)(MediaEvent event, MediaRenderer& renderer);
+
 /**
- * @brief MediaRenderer DLNA Device
+ * @brief MediaRenderer DLNA Device: the AVTransport, RenderingControl and
+ * ConnectionManager actions are dispatched to the handlers of this class and
+ * the changes are published as LastChange events. The application is
+ * informed via the MediaEventCallback.
+ *
+ * If an AudioSink is defined, the uri is played by the MediaPipeline: the
+ * data is output in loop(). In the ESP32 worker mode, call pipeline().update()
+ * and pipeline().copy() from your own task instead: the playback state is
+ * updated by the I/O task.
  * @author Phil Schatzmann
  */
 class MediaRenderer : public DLNADeviceMgr {
  public:
+  /// Starts the device (and the fill task of the pipeline)
+  bool begin(DLNADevice& device, IUDPService& udp,
+             HttpServer& server) override {
+    if (is_pipeline && !media_pipeline.begin()) return false;
+    return DLNADeviceMgr::begin(device, udp, server);
+  }
+
+  /// Stops the device and the playback
+  void end() override {
+    if (is_pipeline) media_pipeline.end();
+    DLNADeviceMgr::end();
+  }
+
+  /// Call in the Arduino loop as often as possible: outputs the audio data
+  bool loop() override {
+    if (is_pipeline) {
+      media_pipeline.update();
+      media_pipeline.copy();
+    }
+    return DLNADeviceMgr::loop();
+  }
+
+  /// Plays the uri with the MediaPipeline to the indicated sink (e.g. a
+  /// decoder)
+  void setAudioSink(AudioSink& sink) {
+    media_pipeline.setSink(sink);
+    is_pipeline = true;
+  }
+
+  /// Provides access to the playback pipeline: e.g. to define the buffer
+  /// size or to query the fill level and the number of underruns
+  MediaPipeline& pipeline() { return media_pipeline; }
+
+  /// Defines the callback which is called for the actions which change the
+  /// renderer
+  void setMediaEventCallback(MediaEventCallback cb) { event_cb = cb; }
+
+  /// Defines the supported formats: e.g. "http-get:*:audio/mpeg:*"
+  void setProtocolInfo(const char* sink) { protocol_info = sink; }
+
+  /// Uri which was defined by SetAVTransportURI
+  const char* getCurrentURI() { return current_uri.c_str(); }
+
+  /// Metadata which was defined by SetAVTransportURI
+  const char* getCurrentURIMetaData() { return current_uri_metadata.c_str(); }
+
+  /// Uri which was defined by SetNextAVTransportURI
+  const char* getNextURI() { return next_uri.c_str(); }
+
+  /// Actual transport state: e.g. PLAYING
+  const char* getTransportState() { return transport_state; }
+
+  /// Updates the transport state (e.g. STOPPED when the playback has ended)
+  void setTransportState(const char* state) {
+    transport_state = state;
+    setStateValue(avt_id, "TransportState", state);
+  }
+
+  /// Volume in the range of 0 to 100
+  int getVolume() { return volume; }
+
+  /// Updates the volume (0 to 100)
+  void setVolume(int vol) {
+    volume = vol;
+    char tmp[12];
+    snprintf(tmp, sizeof(tmp), "%d", vol);
+    setStateValue(rc_id, "Volume", tmp);
+  }
+
+  bool isMuted() { return is_muted; }
+
+  /// Updates the mute state
+  void setMute(bool mute) {
+    is_muted = mute;
+    setStateValue(rc_id, "Mute", mute ? "1" : "0");
+  }
+
  protected:
   // Renderer, Player or Server
   const char* st = "urn:schemas-upnp-org:device:MediaRenderer:1";
   const char* usn = "uuid:09349455-2941-4cf7-9847-1dd5ab210e97";
+  const char* avt_id = "urn:upnp-org:serviceId:AVTransport";
+  const char* rc_id = "urn:upnp-org:serviceId:RenderingControl";
+  const char* cm_id = "urn:upnp-org:serviceId:ConnectionManager";
+  const char* protocol_info =
+      "http-get:*:audio/mpeg:*,http-get:*:audio/wav:*,http-get:*:audio/L16:*";
+  const char* transport_state = "NO_MEDIA_PRESENT";
+  Str current_uri;
+  Str current_uri_metadata;
+  Str next_uri;
+  Str next_uri_metadata;
+  int volume = 50;
+  bool is_muted = false;
+  MediaEventCallback event_cb = nullptr;
+  MediaPipeline media_pipeline;
+  bool is_pipeline = false;
+  uint32_t track_count = 0;
+
+  void updateDevice() override {
+    if (is_pipeline) updatePlayback();
+  }
+
+  /// Updates the state when the pipeline has ended or changed the track
+  void updatePlayback() {
+    if (media_pipeline.trackCount() != track_count) {
+      track_count = media_pipeline.trackCount();
+      current_uri = next_uri;
+      current_uri_metadata = next_uri_metadata;
+      next_uri = "";
+      next_uri_metadata = "";
+      setStateValue(avt_id, "AVTransportURI", current_uri.c_str());
+      setStateValue(avt_id, "CurrentTrackURI", current_uri.c_str());
+      setStateValue(avt_id, "NextAVTransportURI", "");
+    }
+    PipelineState state = media_pipeline.getState();
+    if (state == PIPELINE_ENDED || state == PIPELINE_ERROR) {
+      media_pipeline.stop();
+      setStateValue(avt_id, "TransportStatus",
+                    state == PIPELINE_ERROR ? "ERROR_OCCURRED" : "OK");
+      setTransportState("STOPPED");
+      notify(STOP);
+    }
+  }
 
   void setupServices(DLNADevice& device) override {
-    DlnaLogger.log(DlnaInfo, "MediaRenderer::setupServices");
+    DLNA_LOG(DlnaInfo, "MediaRenderer::setupServices");
     device.clear();
     device.setUDN(usn);
     device.setDeviceType(st);
 
-    auto dummyCB = [](HttpServer* server, const char* requestPath,
-                      HttpRequestHandlerLine* hl) {
-      DlnaLogger.log(DlnaError, "Unhandled request: %s", requestPath);
-      server->reply("text/xml", "<test/>");
-    };
-
     auto transportCB = [](HttpServer* server, const char* requestPath,
                           HttpRequestHandlerLine* hl) {
-      server->reply("text/xml", transport_xml);
+      server->replyGzip("text/xml", transport_xml_gz, transport_xml_gz_len,
+                        transport_xml_len);
     };
 
     auto connmgrCB = [](HttpServer* server, const char* requestPath,
                         HttpRequestHandlerLine* hl) {
-      server->reply("text/xml", connmgr_xml);
+      server->replyGzip("text/xml", connmgr_xml_gz, connmgr_xml_gz_len,
+                        connmgr_xml_len);
     };
 
     auto controlCB = [](HttpServer* server, const char* requestPath,
                         HttpRequestHandlerLine* hl) {
-      server->reply("text/xml", control_xml);
+      server->replyGzip("text/xml", control_xml_gz, control_xml_gz_len,
+                        control_xml_len);
     };
 
-    // define services
+    // define services: the control and the events are handled by the
+    // DLNAActionDispatcher and the DLNASubscriptionMgr
     DLNAServiceInfo rc, cm, avt;
-    avt.setup("urn:schemas-upnp-org:service:AVTransport:1",
-              "urn:upnp-org:serviceId:AVTransport", "/AVT/service.xml",
-              transportCB, "/AVT/control", dummyCB, "/AVT/event", dummyCB);
-    cm.setup("urn:schemas-upnporg:service:ConnectionManager:1",
-             "urn:upnp-org:serviceId:ConnectionManager", "/CM/service.xml",
-             connmgrCB, "/CM/control", dummyCB, "/CM/event", dummyCB);
-    rc.setup("urn:schemas-upnporg:service:RenderingControl:1",
-             "urn:upnp-org:serviceId:RenderingControl", "/RC/service.xml",
-             controlCB, "/RC/control", dummyCB, "/RC/event", dummyCB);
+    avt.setup("urn:schemas-upnp-org:service:AVTransport:1", avt_id,
+              "/AVT/service.xml", transportCB, "/AVT/control", nullptr,
+              "/AVT/event", nullptr);
+    cm.setup("urn:schemas-upnporg:service:ConnectionManager:1", cm_id,
+             "/CM/service.xml", connmgrCB, "/CM/control", nullptr,
+             "/CM/event", nullptr);
+    rc.setup("urn:schemas-upnporg:service:RenderingControl:1", rc_id,
+             "/RC/service.xml", controlCB, "/RC/control", nullptr,
+             "/RC/event", nullptr);
+
+    avt.last_change_ns = "urn:schemas-upnp-org:metadata-1-0/AVT/";
+    rc.last_change_ns = "urn:schemas-upnp-org:metadata-1-0/RCS/";
+
+    int count = 0;
+    const DLNAActionEntry* table = transportActions(count);
+    avt.setActions(table, count, this);
+    table = controlActions(count);
+    rc.setActions(table, count, this);
+    table = connmgrActions(count);
+    cm.setActions(table, count, this);
 
     device.addService(rc);
     device.addService(cm);
     device.addService(avt);
   }
+
+  /// Actions of the AVTransport SCPD (transport.h)
+  static const DLNAActionEntry* transportActions(int& count) {
+    static const DLNAActionEntry table[] = {
+        {"SetAVTransportURI", setAVTransportURI},
+        {"SetNextAVTransportURI", setNextAVTransportURI},
+        {"GetMediaInfo", getMediaInfo},
+        {"GetTransportInfo", getTransportInfo},
+        {"GetPositionInfo", getPositionInfo},
+        {"GetDeviceCapabilities", getDeviceCapabilities},
+        {"GetTransportSettings", getTransportSettings},
+        {"GetCurrentTransportActions", getCurrentTransportActions},
+        {"Stop", stop},
+        {"Play", play},
+        {"Pause", pause},
+        {"Seek", seek}};
+    count = sizeof(table) / sizeof(table[0]);
+    return table;
+  }
+
+  /// Actions of the RenderingControl SCPD (control.h) which are supported
+  static const DLNAActionEntry* controlActions(int& count) {
+    static const DLNAActionEntry table[] = {{"ListPresets", listPresets},
+                                            {"GetMute", getMute},
+                                            {"SetMute", setMute},
+                                            {"GetVolume", getVolume},
+                                            {"SetVolume", setVolume}};
+    count = sizeof(table) / sizeof(table[0]);
+    return table;
+  }
+
+  /// Actions of the ConnectionManager SCPD (conmgr.h) which are supported
+  static const DLNAActionEntry* connmgrActions(int& count) {
+    static const DLNAActionEntry table[] = {
+        {"GetProtocolInfo", getProtocolInfo},
+        {"GetCurrentConnectionIDs", getCurrentConnectionIDs},
+        {"GetCurrentConnectionInfo", getCurrentConnectionInfo}};
+    count = sizeof(table) / sizeof(table[0]);
+    return table;
+  }
+
+  /// checks the InstanceID: we support only 0
+  static MediaRenderer* self(DLNAAction& action, void* ref) {
+    if (action.getArgumentInt("InstanceID", 0) != 0) {
+      action.setError(718, "Invalid InstanceID");
+      return nullptr;
+    }
+    return (MediaRenderer*)ref;
+  }
+
+  void notify(MediaEvent event) {
+    if (event_cb != nullptr) event_cb(event, *this);
+  }
+
+  static void setAVTransportURI(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    const char* uri = action.getArgument("CurrentURI");
+    if (uri == nullptr) {
+      action.setError(402, "Invalid Args");
+      return;
+    }
+    const char* meta = action.getArgument("CurrentURIMetaData");
+    p_self->current_uri = uri;
+    p_self->current_uri_metadata = meta == nullptr ? "" : meta;
+    p_self->setStateValue(p_self->avt_id, "AVTransportURI", uri);
+    p_self->setStateValue(p_self->avt_id, "CurrentTrackURI", uri);
+    if (StrView(p_self->transport_state).equals("NO_MEDIA_PRESENT")) {
+      p_self->setTransportState("STOPPED");
+    }
+    if (p_self->is_pipeline) {
+      p_self->media_pipeline.setURI(uri);
+      // a running playback continues with the new uri
+      if (StrView(p_self->transport_state).equals("PLAYING")) {
+        p_self->media_pipeline.play();
+      }
+    }
+    p_self->notify(SET_URI);
+  }
+
+  static void setNextAVTransportURI(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    const char* uri = action.getArgument("NextURI");
+    const char* meta = action.getArgument("NextURIMetaData");
+    p_self->next_uri = uri == nullptr ? "" : uri;
+    p_self->next_uri_metadata = meta == nullptr ? "" : meta;
+    p_self->setStateValue(p_self->avt_id, "NextAVTransportURI",
+                          p_self->next_uri.c_str());
+    if (p_self->is_pipeline) {
+      p_self->media_pipeline.setNextURI(p_self->next_uri.c_str());
+    }
+    p_self->notify(SET_NEXT_URI);
+  }
+
+  static void getMediaInfo(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    action.addResult("NrTracks", p_self->current_uri.isEmpty() ? 0l : 1l);
+    action.addResult("MediaDuration", "NOT_IMPLEMENTED");
+    action.addResult("CurrentURI", p_self->current_uri.c_str());
+    action.addResult("CurrentURIMetaData",
+                     p_self->current_uri_metadata.c_str());
+    action.addResult("NextURI", p_self->next_uri.c_str());
+    action.addResult("NextURIMetaData", p_self->next_uri_metadata.c_str());
+    action.addResult("PlayMedium", "NETWORK");
+    action.addResult("RecordMedium", "NOT_IMPLEMENTED");
+    action.addResult("WriteStatus", "NOT_IMPLEMENTED");
+  }
+
+  static void getTransportInfo(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    action.addResult("CurrentTransportState", p_self->transport_state);
+    action.addResult("CurrentTransportStatus", "OK");
+    action.addResult("CurrentSpeed", "1");
+  }
+
+  static void getPositionInfo(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    action.addResult("Track", p_self->current_uri.isEmpty() ? 0l : 1l);
+    action.addResult("TrackDuration", "0:00:00");
+    action.addResult("TrackMetaData", p_self->current_uri_metadata.c_str());
+    action.addResult("TrackURI", p_self->current_uri.c_str());
+    action.addResult("RelTime", "0:00:00");
+    action.addResult("AbsTime", "0:00:00");
+    action.addResult("RelCount", 2147483647l);
+    action.addResult("AbsCount", 2147483647l);
+  }
+
+  static void getDeviceCapabilities(DLNAAction& action, void* ref) {
+    if (self(action, ref) == nullptr) return;
+    action.addResult("PlayMedia", "NETWORK");
+    action.addResult("RecMedia", "NOT_IMPLEMENTED");
+    action.addResult("RecQualityModes", "NOT_IMPLEMENTED");
+  }
+
+  static void getTransportSettings(DLNAAction& action, void* ref) {
+    if (self(action, ref) == nullptr) return;
+    action.addResult("PlayMode", "NORMAL");
+    action.addResult("RecQualityMode", "NOT_IMPLEMENTED");
+  }
+
+  static void getCurrentTransportActions(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    StrView state(p_self->transport_state);
+    const char* actions = "Play";
+    if (state.equals("PLAYING")) actions = "Pause,Stop";
+    if (state.equals("NO_MEDIA_PRESENT")) actions = "";
+    action.addResult("Actions", actions);
+  }
+
+  static void stop(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    if (p_self->is_pipeline) p_self->media_pipeline.stop();
+    p_self->setTransportState("STOPPED");
+    p_self->notify(STOP);
+  }
+
+  static void play(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    if (p_self->current_uri.isEmpty()) {
+      action.setError(701, "Transition not available");
+      return;
+    }
+    if (p_self->is_pipeline) p_self->media_pipeline.play();
+    p_self->setTransportState("PLAYING");
+    p_self->notify(PLAY);
+  }
+
+  static void pause(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    if (!StrView(p_self->transport_state).equals("PLAYING")) {
+      action.setError(701, "Transition not available");
+      return;
+    }
+    if (p_self->is_pipeline) p_self->media_pipeline.pause();
+    p_self->setTransportState("PAUSED_PLAYBACK");
+    p_self->notify(PAUSE);
+  }
+
+  static void seek(DLNAAction& action, void* ref) {
+    if (self(action, ref) == nullptr) return;
+    action.setError(710, "Seek mode not supported");
+  }
+
+  static void listPresets(DLNAAction& action, void* ref) {
+    if (self(action, ref) == nullptr) return;
+    action.addResult("CurrentPresetNameList", "FactoryDefaults");
+  }
+
+  static void getMute(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    action.addResult("CurrentMute", p_self->is_muted ? "1" : "0");
+  }
+
+  static void setMute(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    p_self->setMute(action.getArgumentBool("DesiredMute"));
+    p_self->notify(SET_MUTE);
+  }
+
+  static void getVolume(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    action.addResult("CurrentVolume", (long)p_self->volume);
+  }
+
+  static void setVolume(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = self(action, ref);
+    if (p_self == nullptr) return;
+    long vol = action.getArgumentInt("DesiredVolume", -1);
+    if (vol < 0 || vol > 100) {
+      action.setError(402, "Invalid Args");
+      return;
+    }
+    p_self->setVolume(vol);
+    p_self->notify(SET_VOLUME);
+  }
+
+  static void getProtocolInfo(DLNAAction& action, void* ref) {
+    MediaRenderer* p_self = (MediaRenderer*)ref;
+    action.addResult("Source", "");
+    action.addResult("Sink", p_self->protocol_info);
+  }
+
+  static void getCurrentConnectionIDs(DLNAAction& action, void* ref) {
+    action.addResult("ConnectionIDs", "0");
+  }
+
+  static void getCurrentConnectionInfo(DLNAAction& action, void* ref) {
+    if (action.getArgumentInt("ConnectionID", 0) != 0) {
+      action.setError(706, "Invalid connection reference");
+      return;
+    }
+    action.addResult("RcsID", 0l);
+    action.addResult("AVTransportID", 0l);
+    action.addResult("ProtocolInfo", "");
+    action.addResult("PeerConnectionManager", "");
+    action.addResult("PeerConnectionID", -1l);
+    action.addResult("Direction", "Input");
+    action.addResult("Status", "OK");
+  }
 };
 
 }  // namespace tiny_dlna
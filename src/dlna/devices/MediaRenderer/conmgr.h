@@ -1,402 +1,77 @@
-const char connmgr_xml[] = {
-  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x63, 0x70, 0x64, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22,
-  0x75, 0x72, 0x6e, 0x3a, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x73, 0x2d,
-  0x75, 0x70, 0x6e, 0x70, 0x2d, 0x6f, 0x72, 0x67, 0x3a, 0x73, 0x65, 0x72,
-  0x76, 0x69, 0x63, 0x65, 0x2d, 0x31, 0x2d, 0x30, 0x22, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x70, 0x65, 0x63, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x3e, 0x31, 0x3c,
-  0x2f, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69,
-  0x6e, 0x6f, 0x72, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x6f, 0x72,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x70, 0x65, 0x63, 0x56, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x47, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x43,
-  0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x73,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x6f, 0x6e, 0x6e, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x73, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65,
-  0x6e, 0x74, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x49, 0x44, 0x73, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x47, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x43,
-  0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x6e, 0x66,
-  0x6f, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x6f, 0x6e, 0x6e,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x52, 0x63, 0x73, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54,
-  0x59, 0x50, 0x45, 0x5f, 0x52, 0x63, 0x73, 0x49, 0x44, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73,
-  0x70, 0x6f, 0x72, 0x74, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54,
-  0x59, 0x50, 0x45, 0x5f, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70,
-  0x6f, 0x72, 0x74, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x49, 0x6e, 0x66,
-  0x6f, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74,
-  0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x50,
-  0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x49, 0x6e, 0x66, 0x6f, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x50, 0x65, 0x65, 0x72, 0x43,
-  0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4d, 0x61, 0x6e,
-  0x61, 0x67, 0x65, 0x72, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50,
-  0x45, 0x5f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x4d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x72, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x50, 0x65, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x6e, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x44, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x50, 0x72,
-  0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x49, 0x6e, 0x66, 0x6f, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x53, 0x6f,
-  0x75, 0x72, 0x63, 0x65, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c,
-  0x49, 0x6e, 0x66, 0x6f, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x53, 0x69, 0x6e, 0x6b, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x53, 0x69, 0x6e, 0x6b, 0x50, 0x72, 0x6f, 0x74, 0x6f,
-  0x63, 0x6f, 0x6c, 0x49, 0x6e, 0x66, 0x6f, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x50, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65,
-  0x46, 0x6f, 0x72, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65, 0x6d, 0x6f,
-  0x74, 0x65, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x49, 0x6e,
-  0x66, 0x6f, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e,
-  0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x50,
-  0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x49, 0x6e, 0x66, 0x6f, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x50, 0x65, 0x65, 0x72, 0x43,
-  0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4d, 0x61, 0x6e,
-  0x61, 0x67, 0x65, 0x72, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45,
-  0x5f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4d,
-  0x61, 0x6e, 0x61, 0x67, 0x65, 0x72, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x50, 0x65, 0x65, 0x72, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59,
-  0x50, 0x45, 0x5f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x44,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x6f,
-  0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x6f, 0x6e, 0x6e,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70,
-  0x6f, 0x72, 0x74, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59,
-  0x50, 0x45, 0x5f, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f,
-  0x72, 0x74, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x52, 0x63, 0x73, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59,
-  0x50, 0x45, 0x5f, 0x52, 0x63, 0x73, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63,
-  0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65,
-  0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54,
-  0x59, 0x50, 0x45, 0x5f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x4d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x72, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x79, 0x65, 0x73, 0x22,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x69, 0x6e,
-  0x6b, 0x50, 0x72, 0x6f, 0x74, 0x6f, 0x63, 0x6f, 0x6c, 0x49, 0x6e, 0x66,
-  0x6f, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64,
-  0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69,
-  0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20,
-  0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22,
-  0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x43,
-  0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x53, 0x74, 0x61,
-  0x74, 0x75, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x4f, 0x4b, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x46, 0x6f, 0x72, 0x6d, 0x61,
-  0x74, 0x4d, 0x69, 0x73, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x75, 0x66, 0x66, 0x69, 0x63,
-  0x69, 0x65, 0x6e, 0x74, 0x42, 0x61, 0x6e, 0x64, 0x77, 0x69, 0x64, 0x74,
-  0x68, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x55, 0x6e, 0x72, 0x65,
-  0x6c, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65,
-  0x6c, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x55, 0x6e, 0x6b, 0x6e,
-  0x6f, 0x77, 0x6e, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45,
-  0x5f, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74,
-  0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x69, 0x34, 0x3c,
-  0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x44, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e,
-  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x49, 0x6e, 0x70, 0x75, 0x74, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65,
-  0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f,
-  0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x5f,
-  0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x52, 0x63, 0x73,
-  0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x69, 0x34, 0x3c,
-  0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x50, 0x72, 0x6f, 0x74,
-  0x6f, 0x63, 0x6f, 0x6c, 0x49, 0x6e, 0x66, 0x6f, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64,
-  0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45,
-  0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47,
-  0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65,
-  0x3e, 0x69, 0x34, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d,
-  0x22, 0x79, 0x65, 0x73, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x53, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x50, 0x72, 0x6f, 0x74,
-  0x6f, 0x63, 0x6f, 0x6c, 0x49, 0x6e, 0x66, 0x6f, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64,
-  0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45,
-  0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x79, 0x65, 0x73, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72,
-  0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x49, 0x44, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73,
-  0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x73, 0x63, 0x70, 0x64, 0x3e, 0x0d, 0x0a, 0x00,
+// connmgr_xml compressed with gzip (window size 512 bytes)
+const uint8_t connmgr_xml_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xb5, 0x8f,
+  0xcb, 0x6e, 0xdb, 0x48, 0x10, 0x45, 0xf7, 0x03, 0xe4, 0x1f, 0x0c, 0xed,
+  0x3d, 0xb4, 0x81, 0xac, 0x02, 0x5a, 0x81, 0x46, 0x52, 0x04, 0x22, 0x32,
+  0x42, 0x48, 0x8c, 0x00, 0xaf, 0x84, 0x4e, 0xb3, 0x24, 0xf7, 0x98, 0xaa,
+  0x22, 0xaa, 0x9a, 0xf2, 0xf8, 0xef, 0xa7, 0xa9, 0x07, 0x5f, 0x62, 0x60,
+  0x85, 0x61, 0x36, 0x8d, 0xea, 0x7a, 0xdc, 0x7b, 0xae, 0xff, 0xf9, 0xbf,
+  0x5d, 0x72, 0xb3, 0x07, 0x16, 0x43, 0xf8, 0x30, 0xb8, 0xff, 0xfb, 0x6e,
+  0xf0, 0x79, 0xf8, 0xe1, 0x2f, 0x5f, 0x74, 0x1a, 0xdf, 0xb8, 0x11, 0xca,
+  0xc3, 0x20, 0x63, 0xfc, 0x24, 0xfa, 0x19, 0x76, 0x4a, 0x6e, 0xb3, 0x14,
+  0xd3, 0x5b, 0xe2, 0xed, 0x27, 0x01, 0xde, 0x1b, 0x0d, 0xb7, 0xf7, 0xb7,
+  0x77, 0x83, 0xc3, 0x41, 0x0a, 0x7a, 0x75, 0x94, 0xc9, 0xbf, 0x3b, 0xf5,
+  0x2f, 0xf1, 0xf0, 0xde, 0xf7, 0x8e, 0x45, 0xde, 0x31, 0xe8, 0x8a, 0x3b,
+  0xd7, 0x39, 0x14, 0xae, 0xe3, 0x35, 0x6e, 0x94, 0xb6, 0xae, 0x9a, 0x1b,
+  0xb1, 0xe5, 0x2f, 0xaf, 0x50, 0xed, 0x60, 0x38, 0x03, 0x3b, 0xce, 0x98,
+  0x01, 0xed, 0x98, 0x10, 0xe1, 0x30, 0x0c, 0x26, 0xe2, 0x7b, 0x87, 0x69,
+  0xbe, 0xcf, 0xdb, 0x6c, 0xe7, 0xc6, 0xc5, 0xfd, 0xe9, 0x5f, 0x28, 0xfc,
+  0xe4, 0x2e, 0x36, 0x7c, 0xec, 0x0e, 0x29, 0xb3, 0xbe, 0x57, 0x7e, 0xdd,
+  0x8c, 0x21, 0x51, 0x16, 0xe2, 0xa5, 0x75, 0xef, 0x4a, 0xb1, 0x51, 0x3f,
+  0x12, 0xa7, 0xd3, 0x8a, 0xd1, 0xba, 0x9a, 0x87, 0xac, 0x72, 0x78, 0x4d,
+  0x48, 0xaf, 0x4c, 0x79, 0x4d, 0x5e, 0xdc, 0x50, 0xc7, 0xc0, 0x6d, 0x79,
+  0x0d, 0x5e, 0x13, 0x77, 0xb4, 0x1e, 0x2d, 0x66, 0xeb, 0xe8, 0x29, 0x9c,
+  0xae, 0xeb, 0x82, 0x57, 0x25, 0xbe, 0x80, 0x5a, 0x68, 0x69, 0xa7, 0xa1,
+  0xcc, 0xfe, 0x22, 0xce, 0x49, 0xaa, 0x1b, 0xc7, 0x68, 0x15, 0xb1, 0x42,
+  0x49, 0x89, 0x6d, 0x5f, 0x3c, 0x0d, 0xc9, 0x6e, 0x5c, 0x21, 0x93, 0x25,
+  0x4d, 0x49, 0x80, 0x1b, 0xea, 0x07, 0xab, 0xae, 0xd8, 0x91, 0x0a, 0x80,
+  0xc7, 0x84, 0x78, 0x74, 0x7d, 0x54, 0xa8, 0xb6, 0xc0, 0xfd, 0xe0, 0xb5,
+  0xc8, 0xf6, 0xc1, 0x18, 0x4c, 0xfa, 0xc6, 0xcb, 0x15, 0xbb, 0x91, 0x4d,
+  0xce, 0x86, 0xfd, 0x20, 0x55, 0xe4, 0xba, 0xf1, 0xe4, 0xeb, 0x99, 0xf4,
+  0x03, 0x33, 0x26, 0xc4, 0xe3, 0xf6, 0x59, 0xf5, 0x2a, 0xa6, 0xe2, 0x33,
+  0x37, 0x72, 0x6a, 0x14, 0x96, 0x65, 0x75, 0x00, 0x9c, 0x81, 0x0d, 0x99,
+  0x2c, 0x69, 0x4a, 0x02, 0xdc, 0x50, 0x89, 0xdd, 0x94, 0xb8, 0xcc, 0x49,
+  0x19, 0x6b, 0xf8, 0x8d, 0x9c, 0x47, 0x81, 0xba, 0xfb, 0x55, 0xf1, 0x2e,
+  0x51, 0x0c, 0xbe, 0xfc, 0x0e, 0x88, 0x3b, 0xef, 0x80, 0x51, 0x7c, 0xe6,
+  0x46, 0x4e, 0x8d, 0xc2, 0xa7, 0xac, 0x0e, 0x54, 0x21, 0x43, 0xaa, 0x18,
+  0xbe, 0x10, 0x8f, 0x09, 0xf1, 0x88, 0x53, 0x02, 0x37, 0x75, 0x2e, 0xf2,
+  0x2d, 0x60, 0x47, 0x16, 0xea, 0x88, 0x97, 0x69, 0x0d, 0x5e, 0x13, 0x76,
+  0xb4, 0x1e, 0x2d, 0x66, 0xeb, 0xe8, 0x29, 0x9c, 0xae, 0x3b, 0x64, 0xbe,
+  0x40, 0x0b, 0x01, 0x2a, 0x99, 0x1e, 0x15, 0xaa, 0x2d, 0x70, 0x2f, 0x74,
+  0x2d, 0xaa, 0x7d, 0x20, 0x06, 0x93, 0x9e, 0xe9, 0x72, 0xc1, 0x6e, 0x60,
+  0x93, 0xb3, 0x61, 0x2f, 0x44, 0x15, 0xb5, 0x6e, 0x38, 0xf5, 0x48, 0x97,
+  0x44, 0x94, 0xd9, 0x5f, 0x44, 0xaa, 0x2b, 0x76, 0xa3, 0x1a, 0xad, 0x22,
+  0x56, 0x28, 0x29, 0xb1, 0xed, 0x0b, 0xab, 0x21, 0xd9, 0x8d, 0x6b, 0xa1,
+  0xa5, 0x2f, 0x9e, 0x93, 0xd4, 0x55, 0x1c, 0xc5, 0x67, 0x6e, 0xe4, 0xd4,
+  0x28, 0x7c, 0x4e, 0xe5, 0x79, 0x22, 0xc0, 0x7b, 0xa3, 0xe1, 0xa0, 0x17,
+  0x9d, 0xc5, 0xa4, 0xaa, 0x7e, 0x23, 0x80, 0xf1, 0x74, 0xef, 0xd4, 0xe4,
+  0x61, 0x80, 0x34, 0x28, 0xc2, 0x55, 0xe0, 0xc6, 0x84, 0x78, 0x8c, 0xf2,
+  0xa8, 0x50, 0x6d, 0x81, 0x2b, 0x99, 0x95, 0x55, 0xd1, 0x5b, 0x0a, 0x43,
+  0xb1, 0x6c, 0x70, 0xeb, 0x52, 0x9f, 0x1b, 0x39, 0x8c, 0x34, 0x73, 0xfc,
+  0xdc, 0xfa, 0x0d, 0xa4, 0xf4, 0x5e, 0x1a, 0x7c, 0x09, 0x99, 0x2c, 0x69,
+  0x4a, 0x02, 0xdc, 0xd0, 0x1f, 0xf0, 0x7b, 0x37, 0xea, 0xd2, 0x9d, 0x66,
+  0x72, 0xa5, 0xb3, 0x4a, 0x12, 0x7a, 0x85, 0x78, 0xa5, 0x92, 0x0c, 0xe6,
+  0x46, 0x6c, 0xb3, 0x37, 0xfc, 0xf6, 0xd5, 0xf7, 0x6a, 0x8d, 0xe6, 0x82,
+  0x33, 0xb6, 0x8e, 0xec, 0x0b, 0xf1, 0x4e, 0xd9, 0x47, 0x23, 0xee, 0xd5,
+  0xcf, 0xef, 0xdc, 0x04, 0x28, 0xd9, 0x66, 0x63, 0xb4, 0x71, 0x87, 0xff,
+  0x28, 0x8c, 0x5f, 0x4d, 0x6c, 0xdf, 0xbb, 0xf9, 0x8e, 0x0c, 0x89, 0x51,
+  0x3f, 0x12, 0x18, 0x3f, 0x2b, 0x97, 0x35, 0x79, 0x77, 0xff, 0x05, 0xe9,
+  0x15, 0x2f, 0xb7, 0xbc, 0xb6, 0xcc, 0x9e, 0x58, 0x65, 0x61, 0xa5, 0xf8,
+  0xe0, 0x90, 0x77, 0x6a, 0x8d, 0x1b, 0x01, 0x8c, 0xa7, 0x7b, 0x87, 0x2b,
+  0x0f, 0x03, 0xa4, 0x41, 0xbe, 0x80, 0x6a, 0x07, 0xc3, 0xd1, 0x7a, 0xb4,
+  0x98, 0xad, 0xa3, 0xa7, 0x70, 0xba, 0x1e, 0xad, 0x22, 0x56, 0x28, 0x29,
+  0xb1, 0x0d, 0x26, 0xbe, 0x77, 0x18, 0xbb, 0xb5, 0x58, 0x59, 0x15, 0xbd,
+  0xa5, 0x30, 0x34, 0x1f, 0x7d, 0xaf, 0xf8, 0xf4, 0x63, 0x39, 0x31, 0x0c,
+  0xda, 0x1a, 0xc2, 0x16, 0x3b, 0xb1, 0x6c, 0x70, 0x5b, 0xb7, 0x6c, 0x4b,
+  0x5e, 0xed, 0x0d, 0x03, 0x4c, 0x33, 0xeb, 0x7b, 0xb5, 0x5e, 0x73, 0xe7,
+  0x5b, 0x66, 0x5b, 0x97, 0xbc, 0x36, 0xf5, 0x1e, 0x42, 0x2e, 0xb4, 0x04,
+  0x93, 0x96, 0x80, 0xe6, 0x63, 0x3d, 0x5c, 0x0f, 0x56, 0x21, 0x93, 0x25,
+  0x4d, 0x49, 0x80, 0x1b, 0x6a, 0x71, 0x14, 0xcb, 0x06, 0xb7, 0xbd, 0xbb,
+  0x8e, 0x09, 0x11, 0xb4, 0x35, 0x84, 0xbd, 0xe7, 0x7c, 0x03, 0x29, 0x2d,
+  0x97, 0x94, 0xb1, 0x86, 0x3f, 0x9c, 0xb1, 0xe6, 0x38, 0xce, 0x98, 0x5d,
+  0xbb, 0x1a, 0x50, 0x3a, 0x7b, 0x7a, 0x02, 0xbc, 0x37, 0x1a, 0x96, 0xf9,
+  0x20, 0x2a, 0xbb, 0x3a, 0x8d, 0x5d, 0xf1, 0x3f, 0xe2, 0xa6, 0xdc, 0x2e,
+  0xaf, 0x12, 0x00, 0x00
 };
-unsigned int connmgr_xml_len = 4783;
+const unsigned int connmgr_xml_gz_len = 856;
+const unsigned int connmgr_xml_len = 4783;
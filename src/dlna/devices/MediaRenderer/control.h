@@ -1,1113 +1,210 @@
-const char control_xml[] = {
-  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x63, 0x70, 0x64, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22,
-  0x75, 0x72, 0x6e, 0x3a, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x73, 0x2d,
-  0x75, 0x70, 0x6e, 0x70, 0x2d, 0x6f, 0x72, 0x67, 0x3a, 0x73, 0x65, 0x72,
-  0x76, 0x69, 0x63, 0x65, 0x2d, 0x31, 0x2d, 0x30, 0x22, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x70, 0x65, 0x63, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x3e, 0x31, 0x3c,
-  0x2f, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69,
-  0x6e, 0x6f, 0x72, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x6f, 0x72,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x70, 0x65, 0x63, 0x56, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x47, 0x65, 0x74, 0x42, 0x6c, 0x75, 0x65, 0x56, 0x69, 0x64, 0x65,
-  0x6f, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45,
-  0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65,
-  0x6e, 0x74, 0x42, 0x6c, 0x75, 0x65, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x42,
-  0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x42, 0x6c, 0x75, 0x65,
-  0x56, 0x69, 0x64, 0x65, 0x6f, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65,
-  0x76, 0x65, 0x6c, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x47, 0x65, 0x74, 0x42, 0x6c, 0x75, 0x65, 0x56, 0x69, 0x64, 0x65,
-  0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c,
-  0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52,
-  0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x42, 0x6c, 0x75, 0x65,
-  0x56, 0x69, 0x64, 0x65, 0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x42, 0x6c, 0x75, 0x65,
-  0x56, 0x69, 0x64, 0x65, 0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x42, 0x72,
-  0x69, 0x67, 0x68, 0x74, 0x6e, 0x65, 0x73, 0x73, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49,
-  0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c,
-  0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41,
-  0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e,
-  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x42,
-  0x72, 0x69, 0x67, 0x68, 0x74, 0x6e, 0x65, 0x73, 0x73, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x42, 0x72, 0x69, 0x67,
-  0x68, 0x74, 0x6e, 0x65, 0x73, 0x73, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72,
-  0x54, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45,
-  0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65,
-  0x6e, 0x74, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x54, 0x65, 0x6d, 0x70, 0x65,
-  0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x54, 0x65,
-  0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x61, 0x73, 0x74, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74,
-  0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x43, 0x6f, 0x6e,
-  0x74, 0x72, 0x61, 0x73, 0x74, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x73, 0x74,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65,
-  0x74, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x42,
-  0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
-  0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e,
-  0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
-  0x47, 0x72, 0x65, 0x65, 0x6e, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x42, 0x6c,
-  0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x47, 0x72, 0x65, 0x65, 0x6e,
-  0x56, 0x69, 0x64, 0x65, 0x6f, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65,
-  0x76, 0x65, 0x6c, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x47, 0x65, 0x74, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x56, 0x69, 0x64,
-  0x65, 0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74,
-  0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x47, 0x72, 0x65,
-  0x65, 0x6e, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x47, 0x72,
-  0x65, 0x65, 0x6e, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x47, 0x61, 0x69, 0x6e,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65,
-  0x74, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x4b,
-  0x65, 0x79, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f,
-  0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73,
-  0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x48, 0x6f,
-  0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x4b, 0x65, 0x79, 0x73,
-  0x74, 0x6f, 0x6e, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x48, 0x6f, 0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61,
-  0x6c, 0x4b, 0x65, 0x79, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x4c, 0x6f,
-  0x75, 0x64, 0x6e, 0x65, 0x73, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74,
-  0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47,
-  0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65,
-  0x6c, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72,
-  0x72, 0x65, 0x6e, 0x74, 0x4c, 0x6f, 0x75, 0x64, 0x6e, 0x65, 0x73, 0x73,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c,
-  0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x4c,
-  0x6f, 0x75, 0x64, 0x6e, 0x65, 0x73, 0x73, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x4d, 0x75, 0x74, 0x65,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50,
-  0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x68, 0x61, 0x6e,
-  0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69,
-  0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f,
-  0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x4d, 0x75,
-  0x74, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75,
-  0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x4d, 0x75, 0x74, 0x65, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x52, 0x65, 0x64, 0x56, 0x69, 0x64,
-  0x65, 0x6f, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76, 0x65, 0x6c,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50,
-  0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72,
-  0x65, 0x6e, 0x74, 0x52, 0x65, 0x64, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x42,
-  0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x52, 0x65, 0x64, 0x56,
-  0x69, 0x64, 0x65, 0x6f, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76,
-  0x65, 0x6c, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x47, 0x65, 0x74, 0x52, 0x65, 0x64, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x47,
-  0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e,
-  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
-  0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43,
-  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x52, 0x65, 0x64, 0x56, 0x69, 0x64,
-  0x65, 0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x52, 0x65, 0x64, 0x56, 0x69, 0x64, 0x65,
-  0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x53, 0x68, 0x61, 0x72, 0x70, 0x6e,
-  0x65, 0x73, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e,
-  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
-  0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43,
-  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x53, 0x68, 0x61, 0x72, 0x70, 0x6e,
-  0x65, 0x73, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f,
-  0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x53, 0x68, 0x61, 0x72, 0x70, 0x6e, 0x65, 0x73, 0x73, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c,
-  0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74,
-  0x56, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x4b, 0x65, 0x79, 0x73,
-  0x74, 0x6f, 0x6e, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47,
-  0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x56, 0x65, 0x72, 0x74, 0x69,
-  0x63, 0x61, 0x6c, 0x4b, 0x65, 0x79, 0x73, 0x74, 0x6f, 0x6e, 0x65, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x56, 0x65,
-  0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x4b, 0x65, 0x79, 0x73, 0x74, 0x6f,
-  0x6e, 0x65, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x47, 0x65, 0x74, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
-  0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e,
-  0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f,
-  0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x68, 0x61,
-  0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x56, 0x6f, 0x6c, 0x75, 0x6d,
-  0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74,
-  0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x56, 0x6f, 0x6c, 0x75, 0x6d,
-  0x65, 0x44, 0x42, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e,
-  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
-  0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43,
-  0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59,
-  0x50, 0x45, 0x5f, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e,
-  0x74, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65,
-  0x44, 0x42, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x47, 0x65, 0x74, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x44, 0x42, 0x52,
-  0x61, 0x6e, 0x67, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47,
-  0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54,
-  0x59, 0x50, 0x45, 0x5f, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4d, 0x69, 0x6e, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f,
-  0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x44, 0x42, 0x3c, 0x2f,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4d, 0x61, 0x78, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75,
-  0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x44, 0x42, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4c, 0x69, 0x73, 0x74, 0x50,
-  0x72, 0x65, 0x73, 0x65, 0x74, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74,
-  0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x72, 0x65,
-  0x73, 0x65, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x50, 0x72,
-  0x65, 0x73, 0x65, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x4c, 0x69, 0x73, 0x74,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x65,
-  0x74, 0x4d, 0x75, 0x74, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c,
-  0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52,
-  0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x44, 0x65, 0x73, 0x69,
-  0x72, 0x65, 0x64, 0x4d, 0x75, 0x74, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x4d, 0x75, 0x74, 0x65, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x65, 0x74, 0x56, 0x6f,
-  0x6c, 0x75, 0x6d, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47,
-  0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54,
-  0x59, 0x50, 0x45, 0x5f, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x44, 0x65, 0x73, 0x69, 0x72,
-  0x65, 0x64, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x65,
-  0x74, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x44, 0x42, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
-  0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e,
-  0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f,
-  0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x43, 0x68, 0x61,
-  0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x44, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x56, 0x6f, 0x6c, 0x75, 0x6d,
-  0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c,
-  0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x56,
-  0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x44, 0x42, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e,
-  0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x56, 0x69, 0x64,
-  0x65, 0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65,
-  0x3e, 0x75, 0x69, 0x32, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x30,
-  0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x31, 0x30, 0x30,
-  0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73, 0x74, 0x65,
-  0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73,
-  0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e,
-  0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x42,
-  0x6c, 0x75, 0x65, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x42, 0x6c, 0x61, 0x63,
-  0x6b, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65,
-  0x3e, 0x75, 0x69, 0x32, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x30,
-  0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x31, 0x30, 0x30,
-  0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73, 0x74, 0x65,
-  0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73,
-  0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e,
-  0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x56,
-  0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x4b, 0x65, 0x79, 0x73, 0x74,
-  0x6f, 0x6e, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x69, 0x32,
-  0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d,
-  0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x2d, 0x33, 0x32, 0x37, 0x36,
-  0x38, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x33, 0x32,
-  0x37, 0x36, 0x37, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f,
-  0x73, 0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e,
-  0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x47, 0x72, 0x65, 0x65, 0x6e, 0x56, 0x69, 0x64, 0x65, 0x6f,
-  0x42, 0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76, 0x65, 0x6c, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x32, 0x3c, 0x2f, 0x64, 0x61,
-  0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61,
-  0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d,
-  0x75, 0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75,
-  0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x31, 0x30, 0x30, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75,
-  0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c,
-  0x2f, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61,
-  0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
-  0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x32, 0x3c, 0x2f, 0x64, 0x61, 0x74,
-  0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e,
-  0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75,
-  0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e,
-  0x31, 0x30, 0x30, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f,
-  0x73, 0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e,
-  0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x4c, 0x6f, 0x75, 0x64, 0x6e, 0x65, 0x73, 0x73, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x62, 0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e,
-  0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65,
-  0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f,
-  0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x5f,
-  0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73,
-  0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70,
-  0x65, 0x3e, 0x75, 0x69, 0x34, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
-  0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x52, 0x65, 0x64, 0x56, 0x69, 0x64, 0x65, 0x6f, 0x47,
-  0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x75, 0x69,
-  0x32, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d,
-  0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61,
-  0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x31, 0x30, 0x30, 0x3c, 0x2f, 0x6d,
-  0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74,
-  0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x6f, 0x6c, 0x6f,
-  0x72, 0x54, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75, 0x72, 0x65,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61,
-  0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x32, 0x3c, 0x2f,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e,
-  0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69,
-  0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d,
-  0x75, 0x6d, 0x3e, 0x36, 0x35, 0x35, 0x33, 0x35, 0x3c, 0x2f, 0x6d, 0x61,
-  0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65,
-  0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45,
-  0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x68, 0x61, 0x72, 0x70,
-  0x6e, 0x65, 0x73, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x75,
-  0x69, 0x32, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x30, 0x3c, 0x2f,
-  0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d,
-  0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x31, 0x30, 0x30, 0x3c, 0x2f,
-  0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x73,
-  0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x50, 0x72, 0x65, 0x73,
-  0x65, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65,
-  0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74,
-  0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x46, 0x61, 0x63, 0x74, 0x6f, 0x72,
-  0x79, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6c, 0x6c, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x56, 0x65, 0x6e, 0x64, 0x6f,
-  0x72, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65, 0x64, 0x56,
-  0x69, 0x64, 0x65, 0x6f, 0x42, 0x6c, 0x61, 0x63, 0x6b, 0x4c, 0x65, 0x76,
-  0x65, 0x6c, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x32,
-  0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d,
-  0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69,
-  0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78,
-  0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x31, 0x30, 0x30, 0x3c, 0x2f, 0x6d, 0x61,
-  0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65,
-  0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45,
-  0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x42, 0x6c, 0x75, 0x65, 0x56,
-  0x69, 0x64, 0x65, 0x6f, 0x47, 0x61, 0x69, 0x6e, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x75, 0x69, 0x32, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x31,
-  0x30, 0x30, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73,
-  0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d,
-  0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x4d, 0x75, 0x74, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e,
-  0x62, 0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 0x3c, 0x2f, 0x64, 0x61, 0x74,
-  0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65,
-  0x6e, 0x74, 0x73, 0x3d, 0x22, 0x79, 0x65, 0x73, 0x22, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4c, 0x61, 0x73, 0x74, 0x43, 0x68,
-  0x61, 0x6e, 0x67, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73,
-  0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
-  0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50,
-  0x45, 0x5f, 0x43, 0x68, 0x61, 0x6e, 0x6e, 0x65, 0x6c, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4d, 0x61, 0x73,
-  0x74, 0x65, 0x72, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4c, 0x46,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x52, 0x46, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x48, 0x6f, 0x72, 0x69,
-  0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x4b, 0x65, 0x79, 0x73, 0x74, 0x6f,
-  0x6e, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x69, 0x32, 0x3c,
-  0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69,
-  0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x2d, 0x33, 0x32, 0x37, 0x36, 0x38,
-  0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x33, 0x32, 0x37,
-  0x36, 0x37, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73,
-  0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d,
-  0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x56, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x44, 0x42, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x69, 0x32, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x2d, 0x31, 0x35, 0x33, 0x36, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e,
-  0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69,
-  0x6d, 0x75, 0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d,
-  0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20,
-  0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22,
-  0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x50, 0x72, 0x65, 0x73, 0x65, 0x74, 0x4e, 0x61, 0x6d, 0x65, 0x4c, 0x69,
-  0x73, 0x74, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d,
-  0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x61, 0x73, 0x74, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x32, 0x3c, 0x2f, 0x64, 0x61, 0x74,
-  0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e,
-  0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75,
-  0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e,
-  0x31, 0x30, 0x30, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f,
-  0x73, 0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e,
-  0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x42, 0x72, 0x69, 0x67, 0x68, 0x74, 0x6e, 0x65, 0x73, 0x73,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61,
-  0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x32, 0x3c, 0x2f,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e,
-  0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69,
-  0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d,
-  0x75, 0x6d, 0x3e, 0x31, 0x30, 0x30, 0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69,
-  0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x65, 0x70, 0x3e,
-  0x31, 0x3c, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x63, 0x70, 0x64, 0x3e, 0x0d, 0x0a, 0x00
+// control_xml compressed with gzip (window size 512 bytes)
+const uint8_t control_xml_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xdd, 0x8f,
+  0x6f, 0x6f, 0xdb, 0x38, 0x12, 0x87, 0xdf, 0x1f, 0x70, 0xdf, 0xa1, 0xc8,
+  0xfb, 0x9e, 0xed, 0xf4, 0xda, 0x2e, 0x16, 0xae, 0x17, 0xb2, 0xa5, 0xd5,
+  0x0a, 0x55, 0x16, 0x82, 0x22, 0x18, 0xf0, 0x2b, 0x82, 0x95, 0x67, 0x63,
+  0x5e, 0xe9, 0xa1, 0xc1, 0x3f, 0x69, 0xb2, 0x9f, 0xfe, 0x28, 0x45, 0x21,
+  0x15, 0x49, 0x6d, 0xb8, 0xbe, 0x6c, 0x71, 0xe8, 0x1b, 0x7b, 0x66, 0xc4,
+  0xf9, 0xcd, 0xf3, 0x2c, 0x7f, 0xb9, 0x3b, 0xf2, 0x57, 0xb7, 0x20, 0x15,
+  0x13, 0xf8, 0xe1, 0x62, 0xf1, 0xaf, 0xf9, 0xc5, 0x2f, 0xab, 0x7f, 0xfe,
+  0x63, 0xa9, 0xea, 0xd3, 0xfe, 0x95, 0xfd, 0x84, 0xea, 0xc3, 0x85, 0x91,
+  0xf8, 0xb3, 0xaa, 0x0f, 0x70, 0xa4, 0xea, 0xb5, 0x39, 0xe1, 0xe9, 0xb5,
+  0x90, 0x37, 0x3f, 0x2b, 0x90, 0xb7, 0xac, 0x86, 0xd7, 0x8b, 0xd7, 0xf3,
+  0x8b, 0x76, 0xe1, 0x04, 0xf5, 0xf6, 0x21, 0xa6, 0x69, 0x8f, 0xf4, 0x3f,
+  0x42, 0xae, 0x16, 0xcb, 0xd9, 0x43, 0xd1, 0x4c, 0x18, 0xda, 0x62, 0x6e,
+  0x27, 0x6d, 0x61, 0x27, 0xb3, 0xc1, 0x0e, 0xad, 0xb5, 0xad, 0x72, 0xa6,
+  0xb4, 0xef, 0x9a, 0x0a, 0xe9, 0x11, 0x56, 0x29, 0xe8, 0x35, 0x37, 0xb0,
+  0x65, 0x7b, 0x10, 0x6b, 0x4e, 0xeb, 0xcf, 0x39, 0xdc, 0x02, 0x5f, 0xce,
+  0xda, 0x8f, 0xcd, 0x73, 0x79, 0x63, 0x8e, 0x80, 0xda, 0xad, 0x77, 0xbd,
+  0x0b, 0xc8, 0x50, 0x69, 0x8a, 0x35, 0x64, 0xb1, 0x5f, 0xda, 0x33, 0x09,
+  0x0f, 0x67, 0x18, 0x2e, 0x67, 0xbe, 0xb3, 0x9f, 0x24, 0x70, 0xaa, 0x61,
+  0x7f, 0xad, 0xed, 0xef, 0x96, 0x4a, 0x46, 0x3f, 0x71, 0x58, 0x45, 0x24,
+  0x2a, 0x53, 0x52, 0xed, 0x8a, 0x84, 0xf4, 0xe3, 0x26, 0xdf, 0x36, 0x82,
+  0x7d, 0x88, 0x11, 0xd0, 0xc6, 0x48, 0x69, 0xfb, 0x6f, 0x5a, 0x79, 0x24,
+  0x61, 0x74, 0x08, 0xe1, 0x64, 0x5a, 0x10, 0x9f, 0x6b, 0x72, 0xa6, 0xba,
+  0x81, 0x3b, 0xe5, 0xab, 0x16, 0x2c, 0x05, 0x4f, 0x9d, 0x52, 0x86, 0x9e,
+  0x77, 0x98, 0x31, 0x92, 0xce, 0x50, 0x69, 0x8a, 0x35, 0x64, 0xf1, 0x94,
+  0x64, 0x13, 0xf5, 0xbc, 0x63, 0x44, 0xa2, 0x32, 0x25, 0xd5, 0xae, 0x48,
+  0x48, 0x3f, 0x2e, 0xc8, 0x72, 0x04, 0xb4, 0x31, 0x52, 0xda, 0xfe, 0x2b,
+  0x3e, 0x1e, 0x46, 0x18, 0x1d, 0xc2, 0x36, 0xc8, 0x09, 0x62, 0x72, 0x4d,
+  0xce, 0x54, 0x37, 0x70, 0x47, 0x7c, 0xd5, 0x22, 0xa5, 0xa0, 0xd7, 0x92,
+  0xdd, 0x1c, 0x34, 0x82, 0x52, 0x1e, 0x73, 0x18, 0x30, 0xb2, 0xcc, 0x50,
+  0x69, 0x8a, 0x35, 0x64, 0xf1, 0x94, 0x5b, 0x43, 0xfa, 0xbc, 0x5a, 0x44,
+  0xa2, 0x32, 0x25, 0xd5, 0xae, 0x48, 0x48, 0x3f, 0x2e, 0x48, 0x71, 0x04,
+  0xb4, 0x31, 0x52, 0xda, 0x7e, 0x4a, 0xc6, 0x93, 0x08, 0xa3, 0x43, 0xc0,
+  0xfa, 0x21, 0x41, 0x34, 0xae, 0xc9, 0x99, 0xea, 0x06, 0xee, 0x82, 0xaf,
+  0x5a, 0x9e, 0x14, 0xf4, 0x46, 0x70, 0x21, 0x2b, 0x38, 0x9e, 0x40, 0x52,
+  0x6d, 0x24, 0x78, 0xd2, 0x61, 0xcc, 0xc8, 0x32, 0x43, 0xa5, 0x29, 0xd6,
+  0x90, 0xc5, 0x53, 0x7a, 0x0c, 0x43, 0xec, 0x22, 0x12, 0x95, 0x29, 0xa9,
+  0x76, 0x45, 0x42, 0xfa, 0x71, 0x41, 0xa2, 0x23, 0xa0, 0x8d, 0x91, 0xd2,
+  0xf6, 0x5f, 0x57, 0xf2, 0x3c, 0xc2, 0xe8, 0x10, 0xbc, 0x71, 0x54, 0x10,
+  0x99, 0x6b, 0x72, 0xa6, 0xba, 0x81, 0xbb, 0xe3, 0xab, 0x96, 0x2a, 0x05,
+  0xcb, 0x8b, 0x5a, 0x52, 0xa5, 0x3d, 0xe7, 0x70, 0x7d, 0x64, 0x9a, 0xa1,
+  0xd2, 0x14, 0x6b, 0xc8, 0xe2, 0x29, 0x39, 0x86, 0x21, 0x6e, 0x11, 0x89,
+  0xca, 0x94, 0x54, 0xbb, 0x22, 0x21, 0xfd, 0xb8, 0x20, 0xc1, 0x11, 0xd0,
+  0xc6, 0x48, 0x69, 0xfb, 0xb1, 0x8a, 0xe7, 0x10, 0x46, 0x87, 0x60, 0xf9,
+  0x88, 0x20, 0x12, 0xd7, 0xe4, 0x4c, 0x75, 0x03, 0x97, 0xef, 0xab, 0x96,
+  0x26, 0x05, 0x9d, 0x4a, 0x00, 0xdc, 0xb2, 0x3d, 0x88, 0x35, 0xa7, 0xf5,
+  0xe7, 0x1c, 0x6e, 0x81, 0x7b, 0xd6, 0x61, 0xd4, 0xc8, 0x32, 0x43, 0xa5,
+  0x29, 0xd6, 0x90, 0xc5, 0x53, 0x82, 0x0c, 0x43, 0xfc, 0x22, 0x12, 0x95,
+  0x29, 0xa9, 0x76, 0x45, 0x42, 0xfa, 0x71, 0x41, 0xb2, 0x23, 0xa0, 0x8d,
+  0x91, 0xd2, 0xf6, 0xdf, 0xd6, 0xf2, 0x4c, 0xc2, 0xe8, 0x10, 0xc4, 0xe9,
+  0xb8, 0x20, 0x42, 0xd7, 0xe4, 0x4c, 0x75, 0x03, 0x77, 0xcb, 0x57, 0x2d,
+  0x59, 0x0a, 0x3d, 0xee, 0x94, 0x32, 0xf4, 0xc4, 0xc3, 0x90, 0x91, 0x77,
+  0x86, 0x4a, 0x53, 0xac, 0x21, 0x8b, 0xa7, 0x34, 0x9b, 0xa8, 0xe7, 0x2d,
+  0x23, 0x12, 0x95, 0x29, 0xa9, 0x76, 0x45, 0x42, 0xfa, 0x71, 0x41, 0x9a,
+  0x23, 0xa0, 0x8d, 0x91, 0xd2, 0xf6, 0x5f, 0x13, 0xf2, 0x34, 0xc2, 0xe8,
+  0x10, 0xb8, 0x61, 0x50, 0x10, 0x95, 0x6b, 0x72, 0xa6, 0xba, 0x81, 0xbb,
+  0xe2, 0xab, 0x96, 0x29, 0x05, 0xfd, 0x9b, 0x90, 0xec, 0x4f, 0x81, 0x9a,
+  0xf2, 0x8f, 0x70, 0xaf, 0xb4, 0x40, 0xf0, 0xbc, 0xc3, 0xa0, 0x91, 0x6f,
+  0x86, 0x4a, 0x53, 0xac, 0x21, 0x8b, 0xa7, 0x24, 0x1b, 0xe2, 0xe7, 0x1d,
+  0x23, 0x12, 0x95, 0x29, 0xa9, 0x76, 0x45, 0x42, 0xfa, 0x71, 0x41, 0xaa,
+  0x23, 0xa0, 0x8d, 0x91, 0xd2, 0xf6, 0xdf, 0x92, 0xf2, 0x44, 0xc2, 0xe8,
+  0x10, 0xc0, 0xa9, 0xb0, 0x20, 0x3a, 0xd7, 0xe4, 0x4c, 0x75, 0x03, 0x77,
+  0xc9, 0x57, 0x2d, 0x57, 0x0a, 0x3a, 0x17, 0x66, 0x8f, 0xa0, 0x94, 0x27,
+  0x1d, 0xae, 0x8f, 0x6c, 0x33, 0x54, 0x9a, 0x62, 0x0d, 0x59, 0x3c, 0xa5,
+  0xc7, 0x30, 0xc4, 0x2e, 0x22, 0x51, 0x99, 0x92, 0x6a, 0x57, 0x24, 0xa4,
+  0x1f, 0x17, 0x24, 0x38, 0x02, 0xda, 0x1c, 0x28, 0x22, 0xf0, 0x17, 0xa1,
+  0x71, 0x59, 0x67, 0xa2, 0x18, 0x29, 0x6d, 0x9f, 0x0b, 0xb3, 0x47, 0x50,
+  0x6a, 0x0a, 0x49, 0x18, 0x1d, 0xc2, 0xe4, 0x23, 0x82, 0x48, 0x5c, 0x93,
+  0x33, 0xd5, 0x0d, 0x5c, 0xbe, 0xaf, 0x5a, 0x9a, 0x14, 0xf4, 0x95, 0xd1,
+  0xe0, 0xd9, 0x86, 0xab, 0x23, 0xab, 0x0c, 0x95, 0xa6, 0x58, 0x43, 0x16,
+  0x4f, 0x09, 0x31, 0x0c, 0xf1, 0x89, 0x48, 0x54, 0xa6, 0xa4, 0xda, 0x15,
+  0x09, 0xe9, 0xc7, 0x05, 0xc9, 0x8d, 0x80, 0x36, 0x07, 0x8a, 0x08, 0xfc,
+  0x45, 0x68, 0x5c, 0xd6, 0x99, 0x28, 0x46, 0x4a, 0xdb, 0x5f, 0x19, 0x0d,
+  0x53, 0x38, 0xc2, 0xe8, 0x10, 0x9e, 0x87, 0xf5, 0x20, 0x02, 0xd7, 0xe4,
+  0x4c, 0x75, 0x03, 0x97, 0xed, 0xab, 0x96, 0x24, 0x05, 0x5d, 0xc2, 0x7e,
+  0xcb, 0xf6, 0x20, 0xd6, 0x9c, 0xd6, 0x9f, 0x73, 0xb8, 0x6d, 0x44, 0x1f,
+  0x29, 0x87, 0x41, 0x23, 0xb7, 0x0c, 0x95, 0xa6, 0x58, 0x43, 0x16, 0x4f,
+  0xa9, 0x31, 0x0c, 0x31, 0x8b, 0x48, 0x54, 0xa6, 0xa4, 0xda, 0x15, 0x09,
+  0xe9, 0xc7, 0x05, 0xa9, 0x8e, 0x80, 0x36, 0x46, 0x4a, 0xdb, 0x7f, 0x4b,
+  0xca, 0x13, 0x09, 0xa3, 0x43, 0x00, 0xa7, 0xc2, 0x82, 0xe8, 0x5c, 0x93,
+  0x33, 0xd5, 0x0d, 0xdc, 0x25, 0x5f, 0xb5, 0x5c, 0x29, 0x38, 0xe6, 0x94,
+  0x32, 0xf4, 0xb4, 0xc3, 0x88, 0x91, 0x71, 0x86, 0x4a, 0x53, 0xac, 0x21,
+  0x8b, 0xa7, 0x14, 0x9b, 0xa8, 0xe7, 0x0d, 0x23, 0x12, 0x95, 0x29, 0xa9,
+  0x76, 0x45, 0x42, 0xfa, 0x71, 0x41, 0x92, 0x23, 0xa0, 0x8d, 0x91, 0xd2,
+  0xf6, 0xd3, 0x3a, 0x9e, 0x45, 0x18, 0x1d, 0x82, 0xf6, 0x34, 0x26, 0x88,
+  0xc8, 0x35, 0x39, 0x53, 0xdd, 0xc0, 0xdd, 0xf0, 0x55, 0x4b, 0x94, 0x82,
+  0xbe, 0x3e, 0x50, 0x79, 0x42, 0x50, 0xca, 0x43, 0x0e, 0xf7, 0x47, 0x8a,
+  0x19, 0x2a, 0x4d, 0xb1, 0x86, 0x2c, 0x9e, 0x32, 0x6b, 0x40, 0x9f, 0x17,
+  0x8b, 0x48, 0x54, 0xa6, 0xa4, 0xda, 0x15, 0x09, 0xe9, 0xc7, 0x05, 0x19,
+  0x8e, 0x80, 0x36, 0x46, 0x4a, 0xdb, 0x4f, 0xb8, 0x78, 0x10, 0x61, 0x74,
+  0x08, 0x57, 0x2f, 0x23, 0x88, 0xc5, 0x35, 0x39, 0x53, 0xdd, 0xc0, 0x1d,
+  0xf0, 0x55, 0x8b, 0x93, 0x82, 0xde, 0x82, 0xd4, 0xac, 0xa6, 0xfc, 0x23,
+  0xdc, 0x2b, 0x2d, 0x10, 0x3c, 0xe8, 0x30, 0x66, 0xe4, 0x98, 0xa1, 0xd2,
+  0x14, 0x6b, 0xc8, 0xe2, 0x29, 0x3b, 0x86, 0x21, 0x72, 0x11, 0x89, 0xca,
+  0x94, 0x54, 0xbb, 0x22, 0x21, 0xfd, 0xb8, 0x20, 0xd1, 0x11, 0xd0, 0xc6,
+  0x48, 0x69, 0xfb, 0xaf, 0x2b, 0x79, 0x1e, 0x61, 0x74, 0x08, 0xde, 0x38,
+  0x2a, 0x88, 0xcc, 0x35, 0x39, 0x53, 0xdd, 0xc0, 0xdd, 0xf1, 0x55, 0x4b,
+  0x95, 0x82, 0xde, 0x0a, 0x6e, 0x1f, 0x7b, 0xca, 0xe1, 0xf2, 0xc8, 0x33,
+  0x43, 0xa5, 0x29, 0xd6, 0x90, 0xc5, 0x53, 0x6a, 0x0c, 0x43, 0xcc, 0x22,
+  0x12, 0x95, 0x29, 0xa9, 0x76, 0x45, 0x42, 0xfa, 0x71, 0x41, 0x7a, 0x23,
+  0xa0, 0xcd, 0x81, 0x22, 0x02, 0x7f, 0x11, 0x1a, 0x97, 0x75, 0x26, 0x8a,
+  0x91, 0xd2, 0xf6, 0x5b, 0xc1, 0xed, 0x7c, 0x0a, 0x48, 0x18, 0x1d, 0x42,
+  0xf4, 0x18, 0x10, 0x44, 0xe1, 0x9a, 0x9c, 0xa9, 0x6e, 0xe0, 0xd2, 0x7d,
+  0xd5, 0xb2, 0xa4, 0xd0, 0xb1, 0xc5, 0x6b, 0x4f, 0x37, 0x5c, 0x1f, 0x59,
+  0x65, 0xa8, 0x34, 0xc5, 0x1a, 0xb2, 0x78, 0x4a, 0x89, 0x61, 0x88, 0x51,
+  0x44, 0xa2, 0x32, 0x25, 0xd5, 0xae, 0x48, 0x48, 0x3f, 0x2e, 0x48, 0x70,
+  0x04, 0xb4, 0x39, 0x50, 0x44, 0xe0, 0x2f, 0x42, 0xe3, 0xb2, 0xce, 0x44,
+  0x31, 0x52, 0xda, 0x7e, 0x2b, 0xb8, 0x9d, 0x4f, 0x01, 0x09, 0xa3, 0x43,
+  0x88, 0x1e, 0x02, 0xe2, 0x75, 0x20, 0x87, 0x6b, 0x72, 0xa6, 0xba, 0x81,
+  0xcb, 0xf7, 0x55, 0x4b, 0x93, 0x82, 0x7e, 0x0c, 0x2f, 0x29, 0xde, 0xf4,
+  0x20, 0x87, 0x19, 0x23, 0xb9, 0x0c, 0x95, 0xa6, 0x58, 0x43, 0x16, 0x4f,
+  0x99, 0x31, 0x0c, 0x11, 0x8b, 0x48, 0x54, 0xa6, 0xa4, 0xda, 0x15, 0x09,
+  0xe9, 0xc7, 0x05, 0x59, 0x8e, 0x80, 0x36, 0x07, 0x8a, 0x08, 0xfc, 0x45,
+  0x68, 0x5c, 0xd6, 0x79, 0x28, 0x57, 0x0c, 0xb7, 0x94, 0x1b, 0x98, 0x62,
+  0x11, 0x46, 0x87, 0xc0, 0x6c, 0x05, 0xb7, 0x99, 0xf1, 0xfa, 0x6c, 0x04,
+  0x7a, 0xf7, 0x9d, 0x11, 0x5c, 0x93, 0x33, 0xd5, 0x0d, 0x5c, 0xbe, 0xaf,
+  0x5a, 0x9a, 0xe6, 0x45, 0x21, 0x41, 0x81, 0x56, 0x9e, 0x6f, 0xb8, 0x3e,
+  0x52, 0xca, 0x50, 0x69, 0x8a, 0x35, 0x64, 0xf1, 0x94, 0x14, 0xc3, 0x10,
+  0xa7, 0x88, 0x44, 0x65, 0x4a, 0xaa, 0x5d, 0x91, 0x90, 0x7e, 0x5c, 0x90,
+  0xe0, 0x08, 0x68, 0x63, 0xa4, 0xb4, 0xfd, 0x83, 0xc9, 0xef, 0x76, 0xd2,
+  0xa0, 0x4f, 0xb1, 0x09, 0xa3, 0x43, 0xe0, 0x86, 0x41, 0x41, 0x54, 0xae,
+  0x69, 0x76, 0x1e, 0x06, 0xee, 0x8a, 0xaf, 0x5a, 0xa6, 0x6b, 0xd0, 0x57,
+  0x46, 0x83, 0x27, 0x1c, 0xae, 0x8e, 0x0c, 0x33, 0x54, 0x9a, 0x62, 0x0d,
+  0x59, 0x3c, 0xa5, 0xc5, 0x30, 0xc4, 0x2a, 0x22, 0x51, 0x99, 0x92, 0x6a,
+  0x57, 0x24, 0xa4, 0x1f, 0x17, 0x24, 0x37, 0x02, 0xda, 0x1c, 0x28, 0x22,
+  0xf0, 0x17, 0xa1, 0x71, 0x59, 0xe7, 0xa1, 0xc4, 0xa0, 0xec, 0xb5, 0xfd,
+  0x95, 0xd1, 0x70, 0x3e, 0xce, 0xc3, 0x76, 0x10, 0x80, 0x6b, 0x72, 0xa6,
+  0xba, 0x81, 0xcb, 0xf6, 0x55, 0x0b, 0x72, 0x0d, 0x7a, 0x2b, 0xb8, 0x7d,
+  0xec, 0xc1, 0x86, 0xcb, 0x23, 0x9d, 0x0c, 0x95, 0xa6, 0x58, 0x43, 0x16,
+  0x9f, 0x6f, 0x13, 0x91, 0xa8, 0x4c, 0x49, 0xb5, 0x2b, 0x12, 0xd2, 0x8f,
+  0x0b, 0xd2, 0x1b, 0x01, 0x6d, 0x0e, 0x14, 0x11, 0xf8, 0x8b, 0xd0, 0xb8,
+  0xac, 0xf3, 0x50, 0x62, 0x50, 0xf6, 0xda, 0x7e, 0x2b, 0xb8, 0x9d, 0x9f,
+  0x0f, 0xf4, 0xb8, 0x1f, 0x04, 0xe1, 0x9a, 0x9c, 0xa9, 0x6e, 0xe0, 0xd2,
+  0x7d, 0xd5, 0xa2, 0x5c, 0x83, 0x7e, 0x88, 0x8e, 0xd7, 0x1e, 0x6e, 0xb8,
+  0x3e, 0x92, 0xca, 0x50, 0x69, 0x8a, 0x35, 0x64, 0xf1, 0xf9, 0x46, 0x11,
+  0x89, 0xca, 0x94, 0x54, 0xbb, 0x22, 0x21, 0xfd, 0xb8, 0x20, 0xc1, 0x11,
+  0xd0, 0xe6, 0x40, 0x11, 0x81, 0xbf, 0x08, 0x8d, 0xcb, 0x3a, 0x0f, 0x25,
+  0x06, 0x65, 0xaf, 0xed, 0xb7, 0x82, 0xdb, 0xf9, 0xf9, 0x40, 0x0f, 0xfb,
+  0xf1, 0x3a, 0x10, 0xc3, 0x35, 0x39, 0x53, 0xdd, 0xc0, 0xe5, 0x77, 0xe5,
+  0xe3, 0x17, 0x05, 0xf2, 0x96, 0xd5, 0xd0, 0xe6, 0x55, 0x8f, 0x61, 0xaa,
+  0x9f, 0xfe, 0x4a, 0x01, 0xee, 0x93, 0x5b, 0x9b, 0xa6, 0x3e, 0x5c, 0xa0,
+  0xb8, 0x70, 0x6e, 0xa9, 0x04, 0xc0, 0x2d, 0xdb, 0x83, 0x48, 0x69, 0xa3,
+  0xe1, 0xe4, 0xa8, 0xa6, 0xd5, 0xfd, 0x09, 0x56, 0x86, 0x5d, 0x5a, 0xb9,
+  0xc7, 0xce, 0x7e, 0xa1, 0x9c, 0x8b, 0x2f, 0xb0, 0xdf, 0x52, 0x6e, 0xa0,
+  0xa4, 0x78, 0xd3, 0x0e, 0x8f, 0x0c, 0xd9, 0xd1, 0x1c, 0x57, 0xf3, 0xe5,
+  0xec, 0xb1, 0x6c, 0xa6, 0xf4, 0xae, 0x2d, 0x17, 0xf3, 0x66, 0xde, 0x35,
+  0x2d, 0x1a, 0x9c, 0x56, 0x8b, 0xe5, 0xac, 0xfd, 0x6f, 0x75, 0xa6, 0x32,
+  0x67, 0x4f, 0x0c, 0xc2, 0x95, 0xd6, 0x36, 0xa4, 0x35, 0x5a, 0x73, 0x5a,
+  0x7f, 0xce, 0xe1, 0x16, 0xf8, 0x0f, 0xe1, 0xb5, 0x05, 0xa9, 0x59, 0x4d,
+  0xf9, 0x47, 0xb8, 0x57, 0x5a, 0x20, 0x4c, 0x48, 0xfd, 0x25, 0xa7, 0xd7,
+  0x6f, 0x2e, 0xdf, 0xbf, 0xfb, 0x69, 0x52, 0xac, 0xf9, 0xf2, 0xfe, 0x3b,
+  0xaa, 0xa5, 0x12, 0x00, 0xb7, 0x6c, 0x0f, 0x62, 0xcd, 0x69, 0xfd, 0x39,
+  0x87, 0x5b, 0xe0, 0x13, 0x7a, 0xe6, 0x2f, 0xf9, 0xcd, 0x27, 0xd5, 0x16,
+  0xf3, 0xf9, 0x77, 0x14, 0xdb, 0x0a, 0x6e, 0x8e, 0xf0, 0x43, 0xa8, 0xe4,
+  0xc2, 0xec, 0x11, 0x94, 0x9a, 0x90, 0xf9, 0x24, 0x04, 0x07, 0x8a, 0x4f,
+  0x85, 0xce, 0xbd, 0x13, 0x91, 0xa8, 0x4c, 0x49, 0xb5, 0x2b, 0x12, 0x92,
+  0xa1, 0x5d, 0xc1, 0x1a, 0xb2, 0x78, 0xe2, 0xa8, 0x61, 0xff, 0x7e, 0x99,
+  0x83, 0x25, 0xec, 0xb7, 0x6c, 0x0f, 0x22, 0xa5, 0x0c, 0x27, 0xef, 0x5c,
+  0x3e, 0xbd, 0x43, 0x39, 0x17, 0x5f, 0xec, 0x0e, 0xe5, 0x06, 0x4a, 0x8a,
+  0x37, 0xed, 0xf0, 0xc8, 0x90, 0x1d, 0xcd, 0x71, 0x35, 0x5f, 0xce, 0x1e,
+  0xcb, 0x66, 0x4a, 0xef, 0xda, 0x72, 0x31, 0x6f, 0xe6, 0x5d, 0xd3, 0x82,
+  0xc1, 0x69, 0xb5, 0x68, 0x88, 0xed, 0x7f, 0x83, 0x3e, 0x99, 0x79, 0xae,
+  0xd0, 0x46, 0x70, 0x21, 0x2b, 0x38, 0x9e, 0x40, 0x52, 0x6d, 0x24, 0xfc,
+  0x4d, 0x52, 0xef, 0xde, 0xbe, 0x7d, 0xf3, 0xf6, 0x3b, 0x6a, 0x5d, 0x1f,
+  0xa8, 0x3c, 0x21, 0x28, 0xf5, 0x37, 0xf9, 0x2c, 0xe6, 0xf3, 0xef, 0x68,
+  0x13, 0x91, 0xa8, 0x4c, 0x49, 0xb5, 0x2b, 0x12, 0x52, 0x48, 0x50, 0xa0,
+  0x7f, 0xb7, 0xd3, 0x09, 0x33, 0xa5, 0x25, 0xc3, 0x9b, 0xaf, 0xcb, 0xe5,
+  0x4c, 0xe9, 0xe1, 0x6c, 0xf5, 0x2b, 0xad, 0xb5, 0x90, 0xf7, 0x31, 0xfc,
+  0x41, 0x0d, 0xd7, 0xea, 0x29, 0xfa, 0xe8, 0x75, 0x86, 0x16, 0x99, 0x73,
+  0xaa, 0x99, 0xc0, 0xc0, 0x95, 0xad, 0xb5, 0x12, 0xf2, 0xd5, 0x1e, 0xfe,
+  0x60, 0x08, 0xfb, 0xf1, 0xe3, 0xd9, 0x14, 0xe2, 0xcc, 0x9e, 0xd1, 0xb0,
+  0xa5, 0x92, 0xd1, 0x4f, 0xbc, 0x7d, 0xf6, 0x64, 0xf0, 0x4a, 0xd9, 0xd0,
+  0xe4, 0x16, 0x50, 0xab, 0x0f, 0x17, 0x28, 0x2e, 0x9a, 0x07, 0x48, 0x8f,
+  0xb0, 0x2a, 0x6d, 0x0e, 0xdb, 0x83, 0x58, 0x73, 0x5a, 0x7f, 0xce, 0xe1,
+  0x16, 0xf8, 0x72, 0xd6, 0x7e, 0xb0, 0x0f, 0xf6, 0x54, 0xd3, 0xea, 0xfe,
+  0x04, 0x2b, 0xc3, 0x2e, 0x97, 0x33, 0xd7, 0x0d, 0x78, 0x4b, 0x8a, 0x37,
+  0xed, 0xf0, 0xc8, 0x90, 0x1d, 0xcd, 0x71, 0x35, 0x5f, 0xce, 0x1e, 0xcb,
+  0x66, 0x4a, 0xef, 0xda, 0x72, 0x31, 0x6f, 0xe6, 0x5d, 0xd3, 0xe2, 0xc1,
+  0x69, 0xb5, 0x68, 0xb8, 0xed, 0xff, 0xd0, 0xca, 0x65, 0x9e, 0xab, 0xb5,
+  0xb6, 0x21, 0xad, 0x57, 0x4a, 0x19, 0xfe, 0x10, 0x46, 0x57, 0x46, 0xc3,
+  0x84, 0xc8, 0x27, 0x21, 0x38, 0x50, 0x7c, 0x2a, 0xf3, 0x57, 0x6e, 0xdc,
+  0x83, 0xf2, 0x47, 0x72, 0xaa, 0xf4, 0xe6, 0xd0, 0xa0, 0x4e, 0x9c, 0x52,
+  0x5a, 0x32, 0xbc, 0x39, 0xff, 0x52, 0xdf, 0x26, 0x22, 0x51, 0x99, 0x92,
+  0x6a, 0x57, 0x24, 0xa4, 0xb9, 0x87, 0xc0, 0x03, 0x0f, 0x52, 0xce, 0xc5,
+  0x17, 0xd8, 0x6f, 0x29, 0x37, 0x90, 0x33, 0xa5, 0x87, 0xb3, 0xd5, 0x95,
+  0x55, 0x00, 0xb9, 0x9c, 0x3d, 0x19, 0x0e, 0x1f, 0xe5, 0xbf, 0x3e, 0xf3,
+  0xa0, 0x9c, 0x78, 0x30, 0x9b, 0xba, 0x3d, 0x7b, 0xe2, 0xdb, 0x4c, 0x9e,
+  0x0c, 0x5e, 0x29, 0xc0, 0x7d, 0x72, 0x0b, 0xa8, 0xd5, 0x87, 0x0b, 0x14,
+  0x17, 0xcd, 0x83, 0xd6, 0xf3, 0x37, 0x21, 0xd9, 0x9f, 0x02, 0x35, 0xe5,
+  0x1f, 0xe1, 0x5e, 0x69, 0x81, 0xb0, 0x9c, 0xb5, 0x1f, 0xec, 0x03, 0xe7,
+  0xcb, 0x2e, 0x97, 0x33, 0xd7, 0x0c, 0x10, 0x4b, 0x8a, 0x37, 0xed, 0xf0,
+  0xc8, 0x90, 0x1d, 0xcd, 0x71, 0xf5, 0xfa, 0xcd, 0xe5, 0xfb, 0x77, 0x3f,
+  0x2d, 0x67, 0x8f, 0x7d, 0xf3, 0x89, 0xde, 0xb5, 0x65, 0xf3, 0xe5, 0xbd,
+  0xfd, 0xd2, 0xb5, 0x2d, 0x24, 0x9c, 0x56, 0x8b, 0x86, 0xde, 0xfe, 0x0f,
+  0xdd, 0x5c, 0xf4, 0xb9, 0x72, 0x5b, 0xc1, 0xcd, 0x11, 0xe2, 0xf5, 0xff,
+  0xac, 0xb4, 0x78, 0xfb, 0xe6, 0xdd, 0x7c, 0x52, 0x69, 0xfe, 0x44, 0xe7,
+  0x65, 0xf1, 0x0b, 0x09, 0x0a, 0xf4, 0xef, 0xb6, 0xcc, 0x99, 0xd2, 0x13,
+  0x12, 0x4a, 0x4b, 0x86, 0x37, 0x4f, 0x45, 0xce, 0x3d, 0xb6, 0x11, 0xa8,
+  0x25, 0x9d, 0x3c, 0x63, 0xd8, 0xe5, 0xd3, 0x1b, 0x93, 0x96, 0x47, 0x86,
+  0xec, 0x68, 0x8e, 0xab, 0xf9, 0x72, 0xf6, 0x58, 0x36, 0x53, 0x7a, 0xd7,
+  0x96, 0x8b, 0x79, 0x33, 0xef, 0x9a, 0x16, 0x0a, 0x4e, 0xab, 0x45, 0x43,
+  0x6b, 0xff, 0x1b, 0xec, 0xc9, 0xcc, 0x73, 0x65, 0xd6, 0x92, 0xdd, 0x1c,
+  0x34, 0x82, 0x52, 0xff, 0xe7, 0x3a, 0x33, 0x05, 0xf2, 0x96, 0xd5, 0x70,
+  0xdd, 0x7c, 0xa8, 0xfc, 0xb4, 0x3e, 0xed, 0x6d, 0xf1, 0x5f, 0xc1, 0x2a,
+  0xb9, 0x13, 0x05, 0x34, 0x00, 0x00
 };
-unsigned int control_xml_len = 13317;
+const unsigned int control_xml_gz_len = 2454;
+const unsigned int control_xml_len = 13317;
@@ -1,1312 +1,255 @@
-const char transport_xml[] = {
-  0x3c, 0x3f, 0x78, 0x6d, 0x6c, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-  0x6e, 0x3d, 0x22, 0x31, 0x2e, 0x30, 0x22, 0x3f, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x63, 0x70, 0x64, 0x20, 0x78, 0x6d, 0x6c, 0x6e, 0x73, 0x3d, 0x22,
-  0x75, 0x72, 0x6e, 0x3a, 0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x73, 0x2d,
-  0x75, 0x70, 0x6e, 0x70, 0x2d, 0x6f, 0x72, 0x67, 0x3a, 0x73, 0x65, 0x72,
-  0x76, 0x69, 0x63, 0x65, 0x2d, 0x31, 0x2d, 0x30, 0x22, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x70, 0x65, 0x63, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x3e, 0x31, 0x3c,
-  0x2f, 0x6d, 0x61, 0x6a, 0x6f, 0x72, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69,
-  0x6e, 0x6f, 0x72, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x6f, 0x72,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x70, 0x65, 0x63, 0x56, 0x65, 0x72,
-  0x73, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x47, 0x65, 0x74, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54,
-  0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x41, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e,
-  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f,
-  0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
-  0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
-  0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x41, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x47, 0x65, 0x74, 0x44, 0x65, 0x76, 0x69, 0x63, 0x65, 0x43,
-  0x61, 0x70, 0x61, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x69, 0x65, 0x73, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45,
-  0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x50, 0x6c, 0x61, 0x79, 0x4d,
-  0x65, 0x64, 0x69, 0x61, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x50, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x50,
-  0x6c, 0x61, 0x79, 0x62, 0x61, 0x63, 0x6b, 0x53, 0x74, 0x6f, 0x72, 0x61,
-  0x67, 0x65, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x52, 0x65, 0x63, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x50, 0x6f,
-  0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x65, 0x63, 0x6f, 0x72, 0x64,
-  0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x4d, 0x65, 0x64, 0x69, 0x61,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65, 0x63, 0x51,
-  0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x50, 0x6f,
-  0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52, 0x65, 0x63, 0x6f, 0x72, 0x64,
-  0x51, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x4d, 0x6f, 0x64, 0x65, 0x73,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65,
-  0x74, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x49, 0x6e, 0x66, 0x6f, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
-  0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69,
-  0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f,
-  0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4e, 0x72, 0x54, 0x72, 0x61, 0x63,
-  0x6b, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75,
-  0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x4e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x4f, 0x66, 0x54, 0x72, 0x61,
-  0x63, 0x6b, 0x73, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4d,
-  0x65, 0x64, 0x69, 0x61, 0x44, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c,
-  0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43,
-  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x44,
-  0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x55, 0x52,
-  0x49, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74,
-  0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x55,
-  0x52, 0x49, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75,
-  0x72, 0x72, 0x65, 0x6e, 0x74, 0x55, 0x52, 0x49, 0x4d, 0x65, 0x74, 0x61,
-  0x44, 0x61, 0x74, 0x61, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f,
-  0x72, 0x74, 0x55, 0x52, 0x49, 0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74,
-  0x61, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4e, 0x65, 0x78,
-  0x74, 0x55, 0x52, 0x49, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x4e, 0x65, 0x78, 0x74, 0x41, 0x56, 0x54, 0x72, 0x61,
-  0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x55, 0x52, 0x49, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4e, 0x65, 0x78, 0x74, 0x55, 0x52, 0x49,
-  0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74, 0x61, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x4e, 0x65, 0x78, 0x74, 0x41,
-  0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x55, 0x52,
-  0x49, 0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74, 0x61, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x50, 0x6c, 0x61, 0x79, 0x4d, 0x65, 0x64,
-  0x69, 0x75, 0x6d, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f,
-  0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x50, 0x6c, 0x61, 0x79, 0x62, 0x61, 0x63, 0x6b, 0x53, 0x74,
-  0x6f, 0x72, 0x61, 0x67, 0x65, 0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65, 0x63, 0x6f, 0x72,
-  0x64, 0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x52, 0x65, 0x63, 0x6f, 0x72, 0x64,
-  0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x4d, 0x65, 0x64, 0x69, 0x75,
-  0x6d, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x57, 0x72, 0x69,
-  0x74, 0x65, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x52, 0x65, 0x63, 0x6f, 0x72,
-  0x64, 0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x57, 0x72, 0x69, 0x74, 0x65,
-  0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x50, 0x6f, 0x73, 0x69, 0x74,
-  0x69, 0x6f, 0x6e, 0x49, 0x6e, 0x66, 0x6f, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f,
-  0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73,
-  0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65,
-  0x6e, 0x74, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x44, 0x75, 0x72, 0x61,
-  0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x72,
-  0x61, 0x63, 0x6b, 0x44, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x54, 0x72, 0x61, 0x63, 0x6b,
-  0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74, 0x61, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65,
-  0x6e, 0x74, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x4d, 0x65, 0x74, 0x61, 0x44,
-  0x61, 0x74, 0x61, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x54,
-  0x72, 0x61, 0x63, 0x6b, 0x55, 0x52, 0x49, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e,
-  0x74, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x55, 0x52, 0x49, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65, 0x6c, 0x54, 0x69, 0x6d, 0x65,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c,
-  0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x52,
-  0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x50,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x41, 0x62, 0x73, 0x54, 0x69, 0x6d, 0x65, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x62, 0x73,
-  0x6f, 0x6c, 0x75, 0x74, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x50, 0x6f, 0x73,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x52, 0x65, 0x6c, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x52, 0x65, 0x6c, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x50,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x41, 0x62, 0x73, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x62,
-  0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x47, 0x65, 0x74, 0x54, 0x72,
-  0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x49, 0x6e, 0x66, 0x6f, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45,
-  0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65,
-  0x6e, 0x74, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x72, 0x61, 0x6e,
-  0x73, 0x70, 0x6f, 0x72, 0x74, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x54, 0x72,
-  0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x53, 0x74, 0x61, 0x74, 0x75,
-  0x73, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72,
-  0x72, 0x65, 0x6e, 0x74, 0x53, 0x70, 0x65, 0x65, 0x64, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x54, 0x72, 0x61, 0x6e,
-  0x73, 0x70, 0x6f, 0x72, 0x74, 0x50, 0x6c, 0x61, 0x79, 0x53, 0x70, 0x65,
-  0x65, 0x64, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x47, 0x65, 0x74, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74,
-  0x53, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72,
-  0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49,
-  0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c,
-  0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41,
-  0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e,
-  0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x50, 0x6c, 0x61, 0x79, 0x4d, 0x6f, 0x64, 0x65,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c,
-  0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43,
-  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x50, 0x6c, 0x61, 0x79, 0x4d, 0x6f,
-  0x64, 0x65, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65,
-  0x63, 0x51, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x4d, 0x6f, 0x64, 0x65,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x6f, 0x75, 0x74, 0x3c,
-  0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x43,
-  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x52, 0x65, 0x63, 0x6f, 0x72, 0x64,
-  0x51, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x4d, 0x6f, 0x64, 0x65, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c,
-  0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x50, 0x61, 0x75,
-  0x73, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73,
-  0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61,
-  0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54,
-  0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
-  0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x50, 0x6c, 0x61, 0x79, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47,
-  0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x53, 0x70, 0x65, 0x65, 0x64, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74,
-  0x50, 0x6c, 0x61, 0x79, 0x53, 0x70, 0x65, 0x65, 0x64, 0x3c, 0x2f, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73,
-  0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x65, 0x65, 0x6b, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67,
-  0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45,
-  0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x55, 0x6e, 0x69, 0x74, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41,
-  0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x53, 0x65, 0x65, 0x6b,
-  0x4d, 0x6f, 0x64, 0x65, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59,
-  0x50, 0x45, 0x5f, 0x53, 0x65, 0x65, 0x6b, 0x54, 0x61, 0x72, 0x67, 0x65,
-  0x74, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e,
-  0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53,
-  0x65, 0x74, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72,
-  0x74, 0x55, 0x52, 0x49, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65,
-  0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49,
-  0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47,
-  0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e,
-  0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65,
-  0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x55, 0x52, 0x49, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x56, 0x54, 0x72,
-  0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x55, 0x52, 0x49, 0x3c, 0x2f,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e,
-  0x74, 0x55, 0x52, 0x49, 0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74, 0x61,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f,
-  0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x56,
-  0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x55, 0x52, 0x49,
-  0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74, 0x61, 0x3c, 0x2f, 0x72, 0x65,
-  0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61,
-  0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x74, 0x6f, 0x70, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
-  0x65, 0x49, 0x44, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69,
-  0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f,
-  0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x53, 0x65, 0x74, 0x4e,
-  0x65, 0x78, 0x74, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f,
-  0x72, 0x74, 0x55, 0x52, 0x49, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c,
-  0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d,
-  0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69,
-  0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72,
-  0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52,
-  0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61,
-  0x6e, 0x63, 0x65, 0x49, 0x44, 0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74,
-  0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75,
-  0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x4e, 0x65, 0x78, 0x74, 0x55, 0x52, 0x49, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74,
-  0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64, 0x69, 0x72, 0x65,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x72, 0x65, 0x6c,
-  0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x4e, 0x65, 0x78, 0x74, 0x41, 0x56,
-  0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x55, 0x52, 0x49,
-  0x3c, 0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4e, 0x65, 0x78, 0x74,
-  0x55, 0x52, 0x49, 0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74, 0x61, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x69, 0x72,
-  0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x69, 0x6e, 0x3c, 0x2f, 0x64,
-  0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x4e, 0x65, 0x78,
-  0x74, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74,
-  0x55, 0x52, 0x49, 0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74, 0x61, 0x3c,
-  0x2f, 0x72, 0x65, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x2f, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x4c,
-  0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69,
-  0x6f, 0x6e, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x63, 0x74, 0x69, 0x6f,
-  0x6e, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x65, 0x72,
-  0x76, 0x69, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x54, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x54, 0x72, 0x61, 0x6e,
-  0x73, 0x70, 0x6f, 0x72, 0x74, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74,
-  0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
-  0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4f,
-  0x4b, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x45, 0x52, 0x52, 0x4f,
-  0x52, 0x5f, 0x4f, 0x43, 0x43, 0x55, 0x52, 0x52, 0x45, 0x44, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x20, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72,
-  0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4e, 0x65, 0x78, 0x74,
-  0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x55,
-  0x52, 0x49, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d,
-  0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x4e, 0x65, 0x78, 0x74, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73,
-  0x70, 0x6f, 0x72, 0x74, 0x55, 0x52, 0x49, 0x4d, 0x65, 0x74, 0x61, 0x44,
-  0x61, 0x74, 0x61, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x72, 0x61,
-  0x63, 0x6b, 0x4d, 0x65, 0x74, 0x61, 0x44, 0x61, 0x74, 0x61, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c,
-  0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65, 0x6c,
-  0x61, 0x74, 0x69, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x69, 0x34, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
-  0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50,
-  0x45, 0x5f, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x49, 0x44,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61,
-  0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x34, 0x3c, 0x2f,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x5f, 0x41, 0x52,
-  0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f, 0x53, 0x65, 0x65, 0x6b, 0x54,
-  0x61, 0x72, 0x67, 0x65, 0x74, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e,
-  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e,
-  0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x50, 0x6c, 0x61, 0x79, 0x62, 0x61, 0x63, 0x6b,
-  0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x4d, 0x65, 0x64, 0x69, 0x75,
-  0x6d, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64,
-  0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69,
-  0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x55, 0x4e, 0x4b, 0x4e, 0x4f, 0x57, 0x4e, 0x3c, 0x2f, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x44, 0x56, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x4d, 0x49, 0x4e, 0x49, 0x2d, 0x44, 0x56, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x56, 0x48, 0x53, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x57, 0x2d, 0x56, 0x48, 0x53, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x53, 0x2d, 0x56, 0x48, 0x53, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x44, 0x2d, 0x56, 0x48, 0x53, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x56, 0x48, 0x53, 0x43, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x56,
-  0x49, 0x44, 0x45, 0x4f, 0x38, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x48, 0x49, 0x38, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x43, 0x44,
-  0x2d, 0x52, 0x4f, 0x4d, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x43,
-  0x44, 0x2d, 0x44, 0x41, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x43,
-  0x44, 0x2d, 0x52, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x43, 0x44,
-  0x2d, 0x52, 0x57, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x56, 0x49,
-  0x44, 0x45, 0x4f, 0x2d, 0x43, 0x44, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x53, 0x41, 0x43, 0x44, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x4d, 0x44, 0x2d, 0x41, 0x55, 0x44, 0x49, 0x4f, 0x3c, 0x2f, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x4d, 0x44, 0x2d, 0x50, 0x49, 0x43, 0x54, 0x55, 0x52,
-  0x45, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x56, 0x44, 0x2d,
-  0x52, 0x4f, 0x4d, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x56,
-  0x44, 0x2d, 0x56, 0x49, 0x44, 0x45, 0x4f, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x44, 0x56, 0x44, 0x2d, 0x52, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x44, 0x56, 0x44, 0x2b, 0x52, 0x57, 0x3c, 0x2f, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x44, 0x56, 0x44, 0x2d, 0x52, 0x57, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x44, 0x56, 0x44, 0x2d, 0x52, 0x41, 0x4d, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x56, 0x44, 0x2d, 0x41, 0x55,
-  0x44, 0x49, 0x4f, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x41,
-  0x54, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4c, 0x44, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x48, 0x44, 0x44, 0x3c, 0x2f, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x4d, 0x49, 0x43, 0x52, 0x4f, 0x2d, 0x4d, 0x56, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52,
-  0x4b, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f, 0x4e, 0x45,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f, 0x54, 0x5f, 0x49,
-  0x4d, 0x50, 0x4c, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x45, 0x44, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x20, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72,
-  0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65, 0x6c, 0x61,
-  0x74, 0x69, 0x76, 0x65, 0x54, 0x69, 0x6d, 0x65, 0x50, 0x6f, 0x73, 0x69,
-  0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73,
-  0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74,
-  0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74,
-  0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x50, 0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x52,
-  0x65, 0x63, 0x6f, 0x72, 0x64, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65,
-  0x4d, 0x65, 0x64, 0x69, 0x61, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e,
-  0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e,
-  0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x50,
-  0x6c, 0x61, 0x79, 0x4d, 0x6f, 0x64, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70,
-  0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61,
-  0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69,
-  0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f, 0x52, 0x4d, 0x41,
-  0x4c, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x52, 0x45, 0x50, 0x45,
-  0x41, 0x54, 0x5f, 0x41, 0x4c, 0x4c, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x49, 0x4e, 0x54, 0x52, 0x4f, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x65, 0x66,
-  0x61, 0x75, 0x6c, 0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f,
-  0x52, 0x4d, 0x41, 0x4c, 0x3c, 0x2f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
-  0x74, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76,
-  0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70,
-  0x6f, 0x72, 0x74, 0x50, 0x6c, 0x61, 0x79, 0x53, 0x70, 0x65, 0x65, 0x64,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61,
-  0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e,
-  0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x31, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x20, 0x76, 0x65, 0x6e,
-  0x64, 0x6f, 0x72, 0x2d, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73,
-  0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e,
-  0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x50,
-  0x6f, 0x73, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x50, 0x6c, 0x61, 0x79, 0x62,
-  0x61, 0x63, 0x6b, 0x53, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x4d, 0x65,
-  0x64, 0x69, 0x61, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x41, 0x62, 0x73, 0x6f, 0x6c, 0x75, 0x74, 0x65, 0x54, 0x69,
-  0x6d, 0x65, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c,
-  0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72,
-  0x72, 0x65, 0x6e, 0x74, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x34, 0x3c, 0x2f, 0x64, 0x61, 0x74,
-  0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e,
-  0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75,
-  0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d, 0x75, 0x6d,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e,
-  0x34, 0x32, 0x39, 0x34, 0x39, 0x36, 0x37, 0x32, 0x39, 0x35, 0x3c, 0x2f,
-  0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x73,
-  0x74, 0x65, 0x70, 0x3e, 0x31, 0x3c, 0x2f, 0x73, 0x74, 0x65, 0x70, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72,
-  0x72, 0x65, 0x6e, 0x74, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x55, 0x52, 0x49,
-  0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61,
-  0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e,
-  0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73,
-  0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e,
-  0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43,
-  0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70,
-  0x6f, 0x72, 0x74, 0x41, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c,
-  0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4e, 0x75, 0x6d,
-  0x62, 0x65, 0x72, 0x4f, 0x66, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x73, 0x3c,
-  0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74,
-  0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x75, 0x69, 0x34, 0x3c, 0x2f, 0x64,
-  0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x52,
-  0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x69, 0x6e, 0x69,
-  0x6d, 0x75, 0x6d, 0x3e, 0x30, 0x3c, 0x2f, 0x6d, 0x69, 0x6e, 0x69, 0x6d,
-  0x75, 0x6d, 0x3e, 0x0d, 0x0a, 0x3c, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75,
-  0x6d, 0x3e, 0x34, 0x32, 0x39, 0x34, 0x39, 0x36, 0x37, 0x32, 0x39, 0x35,
-  0x3c, 0x2f, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45,
-  0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x56, 0x54, 0x72, 0x61,
-  0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x55, 0x52, 0x49, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x62, 0x73, 0x6f,
-  0x6c, 0x75, 0x74, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x50,
-  0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70,
-  0x65, 0x3e, 0x69, 0x34, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x52, 0x65, 0x63,
-  0x6f, 0x72, 0x64, 0x51, 0x75, 0x61, 0x6c, 0x69, 0x74, 0x79, 0x4d, 0x6f,
-  0x64, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x30, 0x3a, 0x45, 0x50, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x31, 0x3a, 0x4c, 0x50, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x32, 0x3a, 0x53, 0x50, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x30,
-  0x3a, 0x42, 0x41, 0x53, 0x49, 0x43, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x31, 0x3a, 0x4d, 0x45, 0x44, 0x49, 0x55, 0x4d, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x32, 0x3a, 0x48, 0x49, 0x47, 0x48, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f, 0x54, 0x5f, 0x49, 0x4d, 0x50,
-  0x4c, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x45, 0x44, 0x3c, 0x2f, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x20, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x2d, 0x64,
-  0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72,
-  0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76,
-  0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6e,
-  0x74, 0x4d, 0x65, 0x64, 0x69, 0x61, 0x44, 0x75, 0x72, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72,
-  0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73,
-  0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d,
-  0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65,
-  0x3e, 0x41, 0x5f, 0x41, 0x52, 0x47, 0x5f, 0x54, 0x59, 0x50, 0x45, 0x5f,
-  0x53, 0x65, 0x65, 0x6b, 0x4d, 0x6f, 0x64, 0x65, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64,
-  0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c,
-  0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x41, 0x42, 0x53, 0x5f,
-  0x54, 0x49, 0x4d, 0x45, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x52,
-  0x45, 0x4c, 0x5f, 0x54, 0x49, 0x4d, 0x45, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x41, 0x42, 0x53, 0x5f, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x52, 0x45, 0x4c, 0x5f, 0x43, 0x4f,
-  0x55, 0x4e, 0x54, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x54, 0x52,
-  0x41, 0x43, 0x4b, 0x5f, 0x4e, 0x52, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x43, 0x48, 0x41, 0x4e, 0x4e, 0x45, 0x4c, 0x5f, 0x46, 0x52, 0x45,
-  0x51, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x54, 0x41, 0x50, 0x45,
-  0x2d, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x46, 0x52, 0x41, 0x4d, 0x45, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74,
-  0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65,
-  0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x41, 0x56, 0x54, 0x72, 0x61, 0x6e, 0x73,
-  0x70, 0x6f, 0x72, 0x74, 0x55, 0x52, 0x49, 0x4d, 0x65, 0x74, 0x61, 0x44,
-  0x61, 0x74, 0x61, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x52, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x53, 0x74, 0x6f, 0x72,
-  0x61, 0x67, 0x65, 0x4d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x3c, 0x2f, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f,
-  0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x55, 0x4e, 0x4b,
-  0x4e, 0x4f, 0x57, 0x4e, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44,
-  0x56, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4d, 0x49, 0x4e, 0x49,
-  0x2d, 0x44, 0x56, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x56, 0x48,
-  0x53, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x57, 0x2d, 0x56, 0x48,
-  0x53, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x53, 0x2d, 0x56, 0x48,
-  0x53, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x2d, 0x56, 0x48,
-  0x53, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x56, 0x48, 0x53, 0x43,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x56, 0x49, 0x44, 0x45, 0x4f,
-  0x38, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x48, 0x49, 0x38, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x43, 0x44, 0x2d, 0x52, 0x4f, 0x4d,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x43, 0x44, 0x2d, 0x44, 0x41,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x43, 0x44, 0x2d, 0x52, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x43, 0x44, 0x2d, 0x52, 0x57, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x56, 0x49, 0x44, 0x45, 0x4f, 0x2d,
-  0x43, 0x44, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x53, 0x41, 0x43,
-  0x44, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4d, 0x44, 0x2d, 0x41,
-  0x55, 0x44, 0x49, 0x4f, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4d,
-  0x44, 0x2d, 0x50, 0x49, 0x43, 0x54, 0x55, 0x52, 0x45, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x44, 0x56, 0x44, 0x2d, 0x52, 0x4f, 0x4d, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x56, 0x44, 0x2d, 0x56, 0x49,
-  0x44, 0x45, 0x4f, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x56,
-  0x44, 0x2d, 0x52, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x56,
-  0x44, 0x2b, 0x52, 0x57, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44,
-  0x56, 0x44, 0x2d, 0x52, 0x57, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x44, 0x56, 0x44, 0x2d, 0x52, 0x41, 0x4d, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x44, 0x56, 0x44, 0x2d, 0x41, 0x55, 0x44, 0x49, 0x4f, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x44, 0x41, 0x54, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x4c, 0x44, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x48, 0x44, 0x44, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4d,
-  0x49, 0x43, 0x52, 0x4f, 0x2d, 0x4d, 0x56, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x4e, 0x45, 0x54, 0x57, 0x4f, 0x52, 0x4b, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f, 0x4e, 0x45, 0x3c, 0x2f, 0x61, 0x6c,
-  0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x4e, 0x4f, 0x54, 0x5f, 0x49, 0x4d, 0x50, 0x4c, 0x45,
-  0x4d, 0x45, 0x4e, 0x54, 0x45, 0x44, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x20, 0x76, 0x65, 0x6e, 0x64, 0x6f, 0x72, 0x2d, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61,
-  0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e,
-  0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e,
-  0x61, 0x6d, 0x65, 0x3e, 0x52, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x4d, 0x65,
-  0x64, 0x69, 0x75, 0x6d, 0x57, 0x72, 0x69, 0x74, 0x65, 0x53, 0x74, 0x61,
-  0x74, 0x75, 0x73, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x57, 0x52, 0x49, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x50, 0x52, 0x4f, 0x54, 0x45, 0x43,
-  0x54, 0x45, 0x44, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f,
-  0x54, 0x5f, 0x57, 0x52, 0x49, 0x54, 0x41, 0x42, 0x4c, 0x45, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x55, 0x4e, 0x4b, 0x4e, 0x4f, 0x57, 0x4e,
-  0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65,
-  0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f, 0x54, 0x5f, 0x49,
-  0x4d, 0x50, 0x4c, 0x45, 0x4d, 0x45, 0x4e, 0x54, 0x45, 0x44, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e,
-  0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x79, 0x65, 0x73,
-  0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x4c, 0x61,
-  0x73, 0x74, 0x43, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x3c, 0x2f, 0x6e, 0x61,
-  0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64,
-  0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61,
-  0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45,
-  0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x43, 0x75, 0x72, 0x72, 0x65,
-  0x6e, 0x74, 0x54, 0x72, 0x61, 0x63, 0x6b, 0x44, 0x75, 0x72, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74,
-  0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79,
-  0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65,
-  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x20, 0x73, 0x65, 0x6e, 0x64, 0x45, 0x76, 0x65, 0x6e, 0x74, 0x73,
-  0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e, 0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d,
-  0x65, 0x3e, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x72, 0x74, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x3c, 0x2f, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d,
-  0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x73,
-  0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c, 0x2f, 0x64, 0x61, 0x74, 0x61, 0x54,
-  0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x53, 0x54, 0x4f, 0x50, 0x50, 0x45, 0x44, 0x3c,
-  0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x50, 0x4c, 0x41, 0x59, 0x49, 0x4e,
-  0x47, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77,
-  0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x54, 0x52, 0x41, 0x4e,
-  0x53, 0x49, 0x54, 0x49, 0x4f, 0x4e, 0x49, 0x4e, 0x47, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x3e, 0x50, 0x41, 0x55, 0x53, 0x45, 0x44, 0x5f, 0x50,
-  0x4c, 0x41, 0x59, 0x42, 0x41, 0x43, 0x4b, 0x3c, 0x2f, 0x61, 0x6c, 0x6c,
-  0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75,
-  0x65, 0x3e, 0x50, 0x41, 0x55, 0x53, 0x45, 0x44, 0x5f, 0x52, 0x45, 0x43,
-  0x4f, 0x52, 0x44, 0x49, 0x4e, 0x47, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f,
-  0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x52, 0x45, 0x43, 0x4f, 0x52, 0x44, 0x49, 0x4e, 0x47, 0x3c, 0x2f,
-  0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65,
-  0x3e, 0x0d, 0x0a, 0x3c, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x3e, 0x4e, 0x4f, 0x5f, 0x4d, 0x45, 0x44, 0x49,
-  0x41, 0x5f, 0x50, 0x52, 0x45, 0x53, 0x45, 0x4e, 0x54, 0x3c, 0x2f, 0x61,
-  0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x2f, 0x61, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x4c, 0x69, 0x73, 0x74, 0x3e, 0x0d, 0x0a, 0x3c,
-  0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62,
-  0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56,
-  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x6e, 0x64,
-  0x45, 0x76, 0x65, 0x6e, 0x74, 0x73, 0x3d, 0x22, 0x6e, 0x6f, 0x22, 0x3e,
-  0x0d, 0x0a, 0x3c, 0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x50, 0x6f, 0x73, 0x73,
-  0x69, 0x62, 0x6c, 0x65, 0x52, 0x65, 0x63, 0x6f, 0x72, 0x64, 0x51, 0x75,
-  0x61, 0x6c, 0x69, 0x74, 0x79, 0x4d, 0x6f, 0x64, 0x65, 0x73, 0x3c, 0x2f,
-  0x6e, 0x61, 0x6d, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x64, 0x61, 0x74, 0x61,
-  0x54, 0x79, 0x70, 0x65, 0x3e, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x3c,
-  0x2f, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3e, 0x0d, 0x0a,
-  0x3c, 0x2f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x56, 0x61, 0x72, 0x69, 0x61,
-  0x62, 0x6c, 0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x65, 0x72, 0x76,
-  0x69, 0x63, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x54, 0x61, 0x62, 0x6c,
-  0x65, 0x3e, 0x0d, 0x0a, 0x3c, 0x2f, 0x73, 0x63, 0x70, 0x64, 0x3e, 0x0d,
-  0x0a, 0x00,
+// transport_xml compressed with gzip (window size 512 bytes)
+const uint8_t transport_xml_gz[] = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xd5, 0x8f,
+  0x5f, 0x8f, 0xa2, 0x4c, 0x1a, 0xc5, 0xef, 0x37, 0xd9, 0xef, 0x60, 0xbc,
+  0xdd, 0xb8, 0xcc, 0x4c, 0x66, 0xff, 0xcc, 0xc4, 0x76, 0xc3, 0x0b, 0xac,
+  0x4d, 0x06, 0x90, 0x41, 0xa4, 0xb7, 0xaf, 0xc8, 0x23, 0x3c, 0xed, 0xd6,
+  0x36, 0x56, 0x91, 0xaa, 0x07, 0x67, 0xfc, 0xf6, 0x5b, 0xd0, 0xb6, 0x8a,
+  0x9a, 0xc0, 0xab, 0xce, 0x26, 0x7b, 0xa3, 0x55, 0x87, 0x53, 0xe7, 0xfc,
+  0xce, 0xf8, 0x1f, 0x3f, 0xd7, 0xc5, 0x60, 0x83, 0x52, 0x31, 0xc1, 0x1f,
+  0x86, 0x1f, 0xff, 0xfc, 0x61, 0xf8, 0x8f, 0xc9, 0x1f, 0xff, 0x30, 0x56,
+  0x59, 0x99, 0x0f, 0xf4, 0x27, 0xae, 0x1e, 0x86, 0x95, 0xe4, 0x5f, 0x55,
+  0xf6, 0x6f, 0x5c, 0x83, 0x1a, 0x55, 0x25, 0x2f, 0x47, 0x42, 0xae, 0xbe,
+  0x2a, 0x94, 0x1b, 0x96, 0xe1, 0xe8, 0xe3, 0xe8, 0xc3, 0xb0, 0x79, 0x50,
+  0x62, 0x96, 0xbc, 0xc5, 0xd4, 0xd7, 0x35, 0xfc, 0x47, 0xc8, 0xc9, 0xc7,
+  0xb1, 0xf1, 0x76, 0xa8, 0x15, 0xc6, 0xf5, 0xe1, 0x83, 0x56, 0x9a, 0x83,
+  0x56, 0x8c, 0x93, 0x37, 0x90, 0x91, 0x3e, 0x79, 0x4c, 0xd1, 0xe1, 0x56,
+  0x9f, 0x38, 0xac, 0x71, 0x32, 0x45, 0xb2, 0x2a, 0x29, 0x91, 0x53, 0x2c,
+  0x81, 0xab, 0x52, 0x48, 0x32, 0x1b, 0x87, 0x1a, 0x1b, 0x8d, 0xa1, 0x7e,
+  0x22, 0x57, 0xd5, 0x5a, 0x3b, 0xf6, 0x11, 0xbb, 0xfb, 0x3e, 0xc4, 0xe5,
+  0x8a, 0x80, 0x67, 0xe8, 0xda, 0x87, 0x47, 0x39, 0x93, 0xf8, 0x56, 0xc5,
+  0xf8, 0xd8, 0x38, 0xdc, 0xf4, 0x27, 0x89, 0x05, 0x10, 0xe6, 0x73, 0xd2,
+  0xbf, 0x09, 0x48, 0x06, 0xcb, 0x02, 0x27, 0x66, 0x6a, 0x46, 0xd3, 0x34,
+  0x7e, 0x0e, 0x9d, 0xf4, 0x38, 0xee, 0xa2, 0xb7, 0x1e, 0x79, 0x0c, 0x71,
+  0x06, 0x74, 0x36, 0xe1, 0xd0, 0x2f, 0x2a, 0xea, 0x83, 0x63, 0x55, 0x52,
+  0xea, 0xc4, 0x58, 0x02, 0x57, 0xa5, 0x90, 0xb4, 0x4f, 0xec, 0x05, 0xb4,
+  0xbf, 0x78, 0x4c, 0xed, 0x84, 0x7d, 0xdd, 0xe1, 0xd4, 0xc0, 0x4d, 0x91,
+  0x6c, 0xdc, 0xb0, 0x0c, 0x2d, 0x28, 0x61, 0xc9, 0x0a, 0x46, 0x0c, 0x8f,
+  0xc0, 0x4f, 0x83, 0xce, 0xa6, 0xba, 0x5c, 0x11, 0xf0, 0x0c, 0x5d, 0xfb,
+  0xd2, 0x5a, 0xc6, 0xfb, 0x8c, 0x35, 0x53, 0x33, 0x9a, 0xa6, 0xf1, 0x73,
+  0xe8, 0xa4, 0xc7, 0x71, 0xbd, 0xa6, 0x9e, 0x01, 0x85, 0x05, 0x6c, 0x7d,
+  0xcc, 0x19, 0x5c, 0xe2, 0x11, 0x15, 0xf5, 0x01, 0x0a, 0x85, 0x52, 0x4c,
+  0x1f, 0xea, 0xac, 0x25, 0x64, 0xaf, 0x73, 0x12, 0x12, 0x56, 0xb8, 0x8b,
+  0xbd, 0x8e, 0x2b, 0xc2, 0xec, 0x5e, 0x58, 0x3a, 0x4a, 0xc8, 0xfc, 0x4e,
+  0x50, 0xdf, 0x2b, 0x28, 0x18, 0x6d, 0x7d, 0x91, 0xa3, 0xba, 0x1b, 0x5b,
+  0x3b, 0xb4, 0x17, 0xdb, 0xfe, 0xe2, 0x31, 0xb5, 0x13, 0xf6, 0x8d, 0x87,
+  0x53, 0xc3, 0x37, 0x45, 0x6a, 0x56, 0xbb, 0xfc, 0x45, 0x1c, 0x90, 0x4f,
+  0xdf, 0x9f, 0x8d, 0x75, 0xb9, 0x22, 0xe0, 0x19, 0xba, 0xf6, 0xa5, 0x9d,
+  0x8c, 0xf7, 0x99, 0x69, 0xa6, 0x66, 0x34, 0x4d, 0xe3, 0xe7, 0xd0, 0x49,
+  0x8f, 0xe3, 0x7a, 0x2d, 0x3c, 0x03, 0x0a, 0x64, 0x2c, 0x21, 0x7b, 0x55,
+  0x97, 0x70, 0x44, 0x45, 0x7d, 0x78, 0x82, 0x6a, 0xbd, 0x44, 0x39, 0x7b,
+  0x79, 0x0f, 0xba, 0x0e, 0xc4, 0xc7, 0x9c, 0x81, 0x5d, 0x49, 0xa8, 0xbb,
+  0x6e, 0xa0, 0xb1, 0x2a, 0x29, 0x75, 0xee, 0x49, 0xdc, 0x75, 0x4c, 0xbb,
+  0xac, 0x45, 0xe4, 0xde, 0x00, 0x64, 0x26, 0xb1, 0x04, 0xae, 0x4a, 0x21,
+  0xdf, 0x82, 0x6e, 0x45, 0xf1, 0x91, 0xc0, 0x06, 0x82, 0xbb, 0x21, 0x1d,
+  0x02, 0xaf, 0x43, 0x0b, 0xf0, 0xe7, 0xdb, 0xb2, 0xab, 0x79, 0xea, 0x84,
+  0x36, 0xd3, 0x8d, 0x2c, 0x87, 0x49, 0x77, 0x64, 0x3a, 0x84, 0x5e, 0xc7,
+  0x16, 0x16, 0xb0, 0xf5, 0x31, 0x67, 0xd5, 0xfa, 0x06, 0xac, 0x3a, 0x64,
+  0x09, 0xd9, 0xeb, 0x9c, 0x84, 0x84, 0x15, 0xbe, 0xe7, 0x5d, 0x47, 0x14,
+  0x61, 0x26, 0x64, 0x7e, 0x33, 0xd3, 0x5b, 0xcc, 0x5d, 0x88, 0x9e, 0x24,
+  0x23, 0xac, 0xdf, 0x54, 0xea, 0x66, 0xa0, 0x37, 0x92, 0x56, 0x62, 0x2f,
+  0xa8, 0xfd, 0xc5, 0x63, 0x6a, 0x27, 0xec, 0xeb, 0x0e, 0xa7, 0x06, 0x6e,
+  0x8a, 0x14, 0x0a, 0xc5, 0x6a, 0xcd, 0xe5, 0x2f, 0xe2, 0x80, 0x7c, 0x1a,
+  0x71, 0x36, 0xd4, 0xe5, 0x8a, 0x80, 0x67, 0xe8, 0xda, 0x97, 0x76, 0x32,
+  0xde, 0x67, 0xa6, 0x99, 0x9a, 0xd1, 0x34, 0x8d, 0x9f, 0x43, 0x27, 0x3d,
+  0x8e, 0xeb, 0x35, 0xf2, 0x0c, 0x28, 0x96, 0x90, 0xbd, 0x5e, 0x62, 0x11,
+  0x15, 0xf5, 0x81, 0xb1, 0x2a, 0x29, 0x75, 0xde, 0x2e, 0xe6, 0x06, 0x06,
+  0xbb, 0x92, 0x50, 0x37, 0xdd, 0x89, 0xe5, 0x10, 0x77, 0x03, 0x93, 0x8f,
+  0x04, 0x36, 0x10, 0xdc, 0x89, 0xe9, 0x10, 0x77, 0x03, 0xd3, 0x22, 0x72,
+  0xef, 0x84, 0xd3, 0x24, 0x5d, 0x47, 0x12, 0x61, 0x11, 0xb3, 0x35, 0xde,
+  0x00, 0x12, 0xd5, 0x22, 0xdb, 0x60, 0x1d, 0x13, 0x0a, 0xc5, 0x6a, 0xf3,
+  0xb5, 0x34, 0xe6, 0x52, 0xdd, 0x48, 0xa3, 0x13, 0x44, 0x51, 0xd1, 0x5d,
+  0x68, 0xf4, 0x32, 0x4b, 0x54, 0x9c, 0x6e, 0xc0, 0x89, 0x6a, 0x91, 0x6d,
+  0xb0, 0xc9, 0x41, 0x79, 0x2b, 0x91, 0x5e, 0x77, 0x2b, 0x91, 0x8e, 0x10,
+  0x45, 0x45, 0x57, 0x12, 0xed, 0x2f, 0x1e, 0x53, 0x3b, 0x61, 0x5f, 0x77,
+  0x38, 0x35, 0x70, 0x53, 0xa4, 0x58, 0x02, 0x57, 0xa5, 0x90, 0xe4, 0xf2,
+  0x17, 0x71, 0x60, 0x3e, 0xcd, 0x38, 0x9b, 0xe9, 0x72, 0x45, 0xc0, 0x33,
+  0x74, 0xed, 0x4b, 0x43, 0x19, 0xef, 0xb5, 0x33, 0x35, 0xa3, 0x69, 0x1a,
+  0x3f, 0x87, 0x4e, 0x7a, 0x1c, 0xd7, 0x6b, 0xe5, 0x19, 0x90, 0x55, 0x49,
+  0xa9, 0xef, 0xfb, 0x3d, 0xcd, 0xf3, 0x4b, 0x6c, 0xa2, 0xa2, 0x3e, 0x70,
+  0xa7, 0x41, 0xf7, 0xa3, 0xaa, 0xd4, 0xbd, 0xb0, 0xea, 0xa4, 0x9b, 0xb8,
+  0xe6, 0x25, 0x62, 0x7e, 0x0f, 0x9a, 0xb0, 0x80, 0xed, 0x2e, 0xac, 0x17,
+  0xd0, 0xfe, 0xe2, 0x31, 0xb5, 0x13, 0xf6, 0x4d, 0x87, 0x53, 0xc3, 0x35,
+  0x45, 0x3a, 0x8c, 0x46, 0x22, 0xc6, 0x57, 0xea, 0x80, 0x7c, 0x9a, 0x73,
+  0xb6, 0xd4, 0xe5, 0x8a, 0x80, 0x67, 0xe8, 0xda, 0x97, 0x76, 0x32, 0xde,
+  0x67, 0xa6, 0x99, 0x9a, 0xd1, 0x34, 0x8d, 0x9f, 0x43, 0x27, 0x3d, 0x8e,
+  0xeb, 0xb5, 0xf4, 0x0c, 0x28, 0x2c, 0x60, 0xeb, 0x8b, 0x1c, 0x2f, 0xe1,
+  0x88, 0x8a, 0xfa, 0xf0, 0x58, 0x95, 0x94, 0x3a, 0xf2, 0x90, 0x74, 0x1d,
+  0x49, 0x84, 0xd9, 0xf7, 0x0a, 0x0a, 0x46, 0x77, 0xe2, 0xd1, 0x79, 0x42,
+  0xe6, 0xad, 0xc8, 0x5e, 0x60, 0xfb, 0x8b, 0xc7, 0xd4, 0x4e, 0xd8, 0xf7,
+  0x1d, 0x4e, 0x0d, 0x5d, 0x08, 0x95, 0x3a, 0x22, 0x3d, 0x7d, 0x78, 0x36,
+  0xd1, 0xe5, 0x8a, 0x80, 0x67, 0xe8, 0xda, 0x97, 0xe6, 0x31, 0xde, 0x67,
+  0x9d, 0x99, 0x9a, 0xd1, 0x34, 0x8d, 0x9f, 0x43, 0x27, 0x3d, 0x8e, 0xbb,
+  0xfb, 0xb4, 0x02, 0xb6, 0xff, 0x47, 0xcb, 0xce, 0x80, 0xe6, 0x25, 0x62,
+  0x7e, 0x3d, 0x4b, 0x2c, 0x81, 0xab, 0x52, 0x48, 0x0a, 0x0b, 0xd8, 0xee,
+  0xb2, 0x7a, 0x81, 0xec, 0x2f, 0x1e, 0x53, 0x3b, 0x61, 0xdf, 0x74, 0x38,
+  0xbd, 0x21, 0x22, 0xbe, 0x1e, 0x08, 0x4f, 0xdf, 0x9d, 0x2d, 0x72, 0xb9,
+  0x22, 0xe0, 0x19, 0xba, 0xf6, 0xf5, 0xb3, 0xcc, 0xd4, 0x8c, 0xa6, 0x69,
+  0xfc, 0x1c, 0x3a, 0xe9, 0x71, 0x5c, 0xaf, 0x65, 0x67, 0x40, 0x0b, 0xce,
+  0xe8, 0x2e, 0x28, 0x73, 0xc4, 0x57, 0x5f, 0xe4, 0x78, 0x2d, 0x48, 0xac,
+  0x15, 0xbc, 0x1f, 0xca, 0x7b, 0x5c, 0x2f, 0x98, 0xfd, 0xc5, 0x63, 0x6a,
+  0x27, 0xec, 0xcb, 0x0e, 0xa7, 0x86, 0x6c, 0x8e, 0x64, 0x26, 0xb1, 0x04,
+  0xae, 0x4a, 0x21, 0x69, 0x11, 0xb9, 0x07, 0xe2, 0xd3, 0x90, 0xb3, 0x89,
+  0x2e, 0x57, 0x04, 0x3c, 0x43, 0xd7, 0xbe, 0xcb, 0xcc, 0xe3, 0xb8, 0x5e,
+  0x33, 0xcf, 0x80, 0xac, 0x4a, 0x4a, 0x7d, 0x6f, 0xad, 0xf8, 0xdd, 0x40,
+  0x49, 0x2c, 0x81, 0xab, 0x52, 0xc8, 0xb7, 0x9c, 0x5b, 0x49, 0x7c, 0x24,
+  0xb0, 0x81, 0xe0, 0x5e, 0x44, 0x87, 0xbc, 0x5e, 0x64, 0xfb, 0x8b, 0xc7,
+  0xd4, 0x4e, 0xd8, 0xb7, 0x1d, 0x4e, 0x0d, 0xda, 0x9c, 0x44, 0x79, 0xa0,
+  0x3c, 0x7d, 0x77, 0x36, 0xd1, 0xe5, 0x8a, 0x80, 0x67, 0xe8, 0xda, 0x37,
+  0x4c, 0x4b, 0xcd, 0x68, 0x9a, 0xc6, 0xcf, 0xa1, 0x93, 0x1e, 0xc7, 0xdd,
+  0x7d, 0x19, 0x52, 0x80, 0x3f, 0xc9, 0x4c, 0x62, 0x09, 0x5c, 0x95, 0x42,
+  0xd2, 0x22, 0x72, 0xff, 0x8f, 0xa6, 0x9e, 0x01, 0xd5, 0x6b, 0x5a, 0x13,
+  0x7e, 0x2f, 0x4d, 0x1d, 0x60, 0x26, 0xb1, 0x04, 0xae, 0x4a, 0x21, 0xdf,
+  0xb2, 0x6e, 0x42, 0xf1, 0x91, 0xc0, 0x06, 0x82, 0x7b, 0x22, 0x1d, 0x32,
+  0x7b, 0xa1, 0xed, 0x2f, 0x1e, 0x53, 0x3b, 0x61, 0xdf, 0xb8, 0x3b, 0xbe,
+  0x7f, 0x51, 0x28, 0x37, 0x2c, 0xc3, 0x26, 0x2f, 0x7e, 0x0f, 0x53, 0xc7,
+  0xe9, 0x03, 0x85, 0x3c, 0x77, 0x36, 0x3a, 0x4d, 0x3d, 0x0c, 0xb9, 0x18,
+  0xee, 0xf7, 0xee, 0x01, 0xeb, 0xc7, 0x95, 0x3a, 0xda, 0xab, 0x49, 0xe3,
+  0x6d, 0x89, 0x13, 0x45, 0x92, 0xf1, 0x95, 0x9e, 0xfc, 0x2e, 0xe8, 0x8f,
+  0x50, 0x14, 0xe2, 0x07, 0xe6, 0x09, 0x14, 0x15, 0xbe, 0x43, 0x1c, 0x6b,
+  0x93, 0xd9, 0x37, 0xcd, 0x78, 0x2c, 0x9c, 0x1a, 0x9c, 0x28, 0x9a, 0x45,
+  0xe9, 0xcc, 0xb2, 0x16, 0x51, 0xe4, 0xd8, 0x1d, 0xe6, 0x81, 0x06, 0xcf,
+  0x85, 0x1c, 0xe5, 0xf8, 0xc2, 0x38, 0xe6, 0x83, 0x73, 0xbb, 0x71, 0x89,
+  0xc8, 0x50, 0x7a, 0x13, 0x26, 0x20, 0x19, 0x2c, 0x8b, 0xc6, 0xd6, 0x12,
+  0x06, 0x4a, 0xa7, 0x3a, 0x3a, 0x9a, 0xd4, 0xc3, 0x90, 0x8b, 0x61, 0x6d,
+  0xe0, 0xb0, 0xc6, 0x49, 0x80, 0x3f, 0xc9, 0x4c, 0x62, 0x09, 0x5c, 0x95,
+  0x42, 0xd2, 0x22, 0x72, 0xc7, 0x46, 0xf3, 0x41, 0x1b, 0x72, 0x20, 0x88,
+  0xb7, 0x25, 0x4e, 0x14, 0x49, 0xc6, 0x57, 0x63, 0x63, 0x2f, 0xdc, 0xb5,
+  0xd0, 0x47, 0x02, 0x5b, 0x27, 0xff, 0xe2, 0x62, 0xab, 0x92, 0x52, 0xab,
+  0xba, 0x39, 0x7b, 0xfd, 0x1f, 0x55, 0x46, 0x58, 0x00, 0xb1, 0x0d, 0x5a,
+  0xa2, 0xe2, 0x84, 0x32, 0x14, 0x8a, 0x11, 0x13, 0xfc, 0x42, 0x2b, 0xfb,
+  0x7c, 0x9f, 0x46, 0x33, 0x35, 0xa3, 0x69, 0x1a, 0x3f, 0x87, 0x4e, 0xea,
+  0x72, 0xfd, 0x84, 0x67, 0xe8, 0xda, 0x17, 0xfa, 0xaa, 0x5f, 0x50, 0x38,
+  0x47, 0x7c, 0x8d, 0x41, 0xae, 0x90, 0x2e, 0x14, 0x2a, 0x92, 0x8c, 0xaf,
+  0xee, 0xd3, 0x19, 0x16, 0xb0, 0x5d, 0x42, 0xf6, 0x3a, 0x27, 0x21, 0x61,
+  0x85, 0x3e, 0xe6, 0xac, 0x5a, 0xf7, 0xec, 0x84, 0xa2, 0x10, 0x3f, 0x30,
+  0x4f, 0xa0, 0xa8, 0xd0, 0x63, 0x8a, 0x4e, 0xb5, 0xc9, 0x22, 0xf8, 0x16,
+  0xcc, 0x9e, 0x82, 0xb1, 0xd1, 0x52, 0x4f, 0x5d, 0x76, 0xd2, 0x61, 0xf0,
+  0xdd, 0xc0, 0x1d, 0x75, 0xba, 0x92, 0xc7, 0x79, 0x87, 0xe3, 0x69, 0xd4,
+  0xed, 0x99, 0xf7, 0xf0, 0xd8, 0x3d, 0x3c, 0xda, 0x61, 0x75, 0x59, 0x5c,
+  0xdb, 0x99, 0xfd, 0xbd, 0xc3, 0xf4, 0xe8, 0x76, 0x39, 0x2c, 0x7b, 0x14,
+  0xcd, 0xfc, 0x6e, 0x93, 0x6d, 0xf6, 0x08, 0xea, 0x61, 0x79, 0xea, 0x33,
+  0x6b, 0x64, 0xd9, 0x1d, 0xb6, 0xb9, 0xd9, 0x69, 0xf1, 0xed, 0x91, 0xb9,
+  0xb0, 0xdd, 0x59, 0xb7, 0x2d, 0x74, 0xad, 0x78, 0x11, 0x39, 0x1d, 0x46,
+  0x3b, 0xd1, 0xf8, 0x33, 0xbf, 0x87, 0xab, 0xd9, 0xd0, 0x27, 0xad, 0xdb,
+  0xf3, 0xa7, 0xe8, 0xa9, 0x4f, 0x50, 0x2f, 0x93, 0xd9, 0x87, 0xdd, 0x5c,
+  0xd8, 0x6e, 0x27, 0xbb, 0x19, 0x77, 0x38, 0x3c, 0xbb, 0xc3, 0xf0, 0x68,
+  0x77, 0x39, 0x7c, 0xd7, 0x8a, 0x66, 0x23, 0x3f, 0xe9, 0xb0, 0x05, 0x4e,
+  0xfc, 0x34, 0x8b, 0xbe, 0x75, 0xb9, 0x66, 0x81, 0xd3, 0x69, 0x89, 0x53,
+  0xd7, 0x0f, 0x3d, 0xc7, 0x77, 0x82, 0xd8, 0xe9, 0xa2, 0x1b, 0x6c, 0x90,
+  0xe7, 0x42, 0x8e, 0x72, 0x7c, 0x61, 0x1c, 0xf3, 0xc1, 0xb9, 0xbd, 0x25,
+  0x78, 0x4c, 0x51, 0x23, 0x2a, 0x02, 0xc2, 0x04, 0x24, 0x83, 0x65, 0xd1,
+  0xd8, 0x5a, 0xc2, 0x40, 0xe9, 0x54, 0x47, 0x47, 0x93, 0x7a, 0x18, 0x72,
+  0x31, 0xac, 0x0d, 0x1c, 0xd6, 0x38, 0x89, 0xb0, 0x00, 0x62, 0x1b, 0x8c,
+  0xd9, 0x1a, 0x43, 0xa1, 0x18, 0x31, 0xc1, 0xc7, 0x46, 0xf3, 0x49, 0x5b,
+  0x72, 0x20, 0x88, 0xb7, 0x25, 0x4e, 0x14, 0x49, 0xc6, 0x57, 0x63, 0x63,
+  0x2f, 0xdc, 0x50, 0xa9, 0x6b, 0x14, 0xd3, 0x86, 0x08, 0x33, 0x21, 0xf3,
+  0x39, 0x09, 0x09, 0x2b, 0xf4, 0x31, 0x67, 0xf0, 0x8b, 0x8b, 0xad, 0x4a,
+  0x4a, 0xad, 0x86, 0x05, 0x6c, 0x7d, 0x91, 0x63, 0xcf, 0x36, 0x28, 0x0a,
+  0xf1, 0x03, 0xf3, 0x04, 0x8a, 0x0a, 0x3d, 0xa6, 0xe8, 0x54, 0x9b, 0x04,
+  0xb3, 0xc8, 0x37, 0xbd, 0xb1, 0xd1, 0x12, 0x4f, 0x4d, 0x91, 0x13, 0x3a,
+  0x66, 0x9c, 0x9a, 0x5e, 0x97, 0xd1, 0x0d, 0xe2, 0x68, 0x76, 0xee, 0x31,
+  0x2e, 0x61, 0xe4, 0xf8, 0x02, 0x55, 0x41, 0x6d, 0x8c, 0x96, 0x58, 0xbf,
+  0x54, 0x04, 0x84, 0x09, 0x48, 0x06, 0xcb, 0xa2, 0x51, 0x5a, 0xc2, 0x40,
+  0x21, 0xcf, 0x9d, 0x0d, 0x72, 0x52, 0x0f, 0x43, 0x2e, 0x86, 0xb5, 0x81,
+  0xc3, 0x1a, 0x27, 0xb1, 0x04, 0xae, 0x4a, 0x21, 0x29, 0x2c, 0x60, 0x3b,
+  0x2f, 0x11, 0xf3, 0xb1, 0xd1, 0x7c, 0xa8, 0x8b, 0x81, 0x20, 0xde, 0x96,
+  0x38, 0x51, 0x24, 0x19, 0x5f, 0xe9, 0xd2, 0x77, 0xe1, 0x64, 0xce, 0x3b,
+  0x69, 0x6b, 0xce, 0xc7, 0xf3, 0x79, 0xad, 0xfb, 0x40, 0xd3, 0xe4, 0x42,
+  0x8e, 0xf4, 0x12, 0xc6, 0x31, 0x1f, 0x9c, 0xdb, 0x8d, 0x4b, 0x1d, 0xd7,
+  0x0e, 0x0d, 0x85, 0x52, 0x4c, 0x1b, 0xea, 0x9d, 0x4b, 0xc8, 0x5e, 0xe7,
+  0x24, 0x24, 0xac, 0xd0, 0xc7, 0x9c, 0x41, 0xcf, 0xc9, 0xd7, 0x56, 0x9b,
+  0x4b, 0x25, 0x8a, 0x8a, 0x30, 0x66, 0x6b, 0xd4, 0x18, 0x8c, 0x98, 0xe0,
+  0xbf, 0xb8, 0xd2, 0xaa, 0xa4, 0xd4, 0x6a, 0x2c, 0xf5, 0xd2, 0x0b, 0x55,
+  0x15, 0xfb, 0xdc, 0xee, 0x81, 0xa2, 0x10, 0x3f, 0x30, 0x4f, 0xa0, 0xa8,
+  0x30, 0x02, 0xbe, 0x6a, 0xc4, 0x35, 0xe3, 0x6c, 0x5d, 0xad, 0x27, 0x1f,
+  0xc6, 0xc6, 0xfb, 0xb1, 0x56, 0xe1, 0x67, 0x73, 0xfc, 0xfc, 0xe9, 0xcb,
+  0xe7, 0x2f, 0x7f, 0xfd, 0xdb, 0xa7, 0x2f, 0x7f, 0xd1, 0x9f, 0x77, 0x5a,
+  0xc3, 0x87, 0xe5, 0xe4, 0x63, 0x0d, 0xae, 0xff, 0xeb, 0x05, 0x17, 0xa3,
+  0xef, 0xb1, 0x6b, 0x11, 0xb9, 0x17, 0xa6, 0x29, 0x92, 0x8c, 0xaf, 0xda,
+  0xeb, 0x6e, 0x6f, 0xe3, 0xaa, 0x14, 0x92, 0xcc, 0x8c, 0x98, 0xe0, 0xea,
+  0x17, 0xb7, 0x06, 0xd5, 0x7a, 0x89, 0x72, 0xf6, 0xd2, 0x8c, 0xbc, 0x54,
+  0x56, 0xb1, 0xcf, 0xed, 0x26, 0x28, 0x0a, 0xf1, 0x03, 0xf3, 0x04, 0x8a,
+  0x0a, 0x23, 0xe0, 0xab, 0x46, 0x5c, 0x33, 0xce, 0xd6, 0xd5, 0x7a, 0xf2,
+  0x61, 0x6c, 0xbc, 0x1f, 0x6b, 0x15, 0x7e, 0x36, 0xc7, 0xcf, 0x9f, 0xbe,
+  0x7c, 0xfe, 0xf2, 0xd7, 0xbf, 0x7d, 0xfa, 0xf2, 0x17, 0xfd, 0x79, 0xa7,
+  0xd5, 0xcc, 0x17, 0xa3, 0xae, 0x5d, 0x62, 0x26, 0x7a, 0x03, 0x57, 0xa5,
+  0x90, 0xb4, 0x88, 0xdc, 0x0b, 0x4b, 0x14, 0x49, 0xc6, 0x57, 0xed, 0x31,
+  0x57, 0x97, 0x2d, 0x95, 0x28, 0x2a, 0x42, 0x4b, 0x54, 0x9c, 0x50, 0x86,
+  0x42, 0x31, 0x62, 0x82, 0x5f, 0x68, 0x65, 0x9f, 0xef, 0xd3, 0x68, 0x55,
+  0x52, 0x6a, 0x35, 0xc2, 0x4c, 0xc8, 0xfc, 0x7b, 0x05, 0x05, 0xa3, 0xad,
+  0x2f, 0x72, 0xec, 0x39, 0x14, 0x8a, 0x42, 0xfc, 0xc0, 0x3c, 0x81, 0xa2,
+  0x42, 0x8f, 0x29, 0x3a, 0xd5, 0x26, 0x1f, 0xbe, 0x3a, 0xe1, 0xd8, 0x68,
+  0x49, 0xa7, 0x96, 0x8f, 0x5f, 0xbd, 0x2e, 0xcb, 0xa7, 0xaf, 0xf3, 0x2e,
+  0xcb, 0x87, 0xaf, 0xbf, 0x99, 0x73, 0xd7, 0xea, 0xec, 0xf2, 0x1d, 0xdb,
+  0x5d, 0xf8, 0x9d, 0x7d, 0x8f, 0xee, 0xf4, 0xb1, 0xc3, 0x14, 0xcc, 0xe2,
+  0xd4, 0xf5, 0x43, 0xcf, 0xf1, 0x9d, 0x20, 0x76, 0xec, 0x0e, 0xf7, 0x60,
+  0x83, 0x3c, 0x17, 0x72, 0x94, 0xe3, 0x0b, 0xe3, 0x98, 0x0f, 0xce, 0xed,
+  0x2d, 0xc1, 0x63, 0x8a, 0x1a, 0x51, 0x11, 0x10, 0x26, 0x20, 0x19, 0x2c,
+  0x8b, 0xc6, 0xd6, 0x12, 0x06, 0x4a, 0xa7, 0x3a, 0x3a, 0x9a, 0xd4, 0xc3,
+  0x90, 0x8b, 0x61, 0x6d, 0xe0, 0xb0, 0xc6, 0x89, 0x55, 0x49, 0xa9, 0x55,
+  0x1f, 0x73, 0x06, 0x76, 0x25, 0x81, 0x98, 0xe0, 0x63, 0xa3, 0xf9, 0xa4,
+  0x2d, 0x39, 0x10, 0xc4, 0xdb, 0x12, 0x27, 0x8a, 0x24, 0xe3, 0xab, 0xb1,
+  0xb1, 0x17, 0x6e, 0xa8, 0x34, 0x53, 0x33, 0x9a, 0xa6, 0xf1, 0x73, 0xe8,
+  0xa4, 0x73, 0xc4, 0x57, 0x5f, 0xe4, 0xd8, 0xb3, 0xf1, 0xd2, 0xf0, 0x63,
+  0x6d, 0x62, 0xfe, 0x36, 0x4f, 0x63, 0xd7, 0x77, 0xc6, 0x46, 0x4b, 0x3e,
+  0xb5, 0x45, 0x8e, 0xd7, 0xc7, 0x56, 0xa7, 0x59, 0xb3, 0x45, 0x10, 0xf7,
+  0x88, 0xeb, 0xe3, 0x8b, 0x23, 0xd3, 0xfa, 0x96, 0x06, 0x51, 0x87, 0xcd,
+  0x7a, 0x34, 0x83, 0x40, 0x47, 0xfe, 0x33, 0x72, 0xbe, 0x77, 0x25, 0x9a,
+  0xa1, 0x33, 0x72, 0x03, 0xdb, 0xf9, 0x57, 0x87, 0xf1, 0x9f, 0x91, 0x79,
+  0x69, 0x6e, 0x4b, 0xf0, 0x98, 0xa2, 0x46, 0x54, 0x04, 0x84, 0x09, 0x48,
+  0x06, 0xcb, 0xa2, 0xb1, 0xb5, 0x84, 0x81, 0x42, 0x9e, 0x3b, 0x1b, 0xe4,
+  0xa4, 0x1e, 0x86, 0x5c, 0x0c, 0x6b, 0x03, 0x87, 0x35, 0x4e, 0xcc, 0x24,
+  0x96, 0xc0, 0x55, 0x29, 0x24, 0x2d, 0x22, 0xd7, 0x47, 0x02, 0x1b, 0x08,
+  0xc6, 0x46, 0xf3, 0x51, 0x9b, 0x72, 0x7d, 0x8b, 0xb7, 0x25, 0x4e, 0x14,
+  0x49, 0xc6, 0x57, 0x63, 0x63, 0x2f, 0xdc, 0x50, 0x1a, 0x61, 0x26, 0x64,
+  0x3e, 0x27, 0x21, 0x61, 0x85, 0x3e, 0xe6, 0xac, 0x5a, 0xf7, 0x6c, 0x84,
+  0xa2, 0x10, 0x3f, 0x30, 0x4f, 0xa0, 0xa8, 0xd0, 0x63, 0x8a, 0x4e, 0xb5,
+  0xc9, 0x22, 0xf8, 0x16, 0xcc, 0x9e, 0x82, 0xb1, 0xd1, 0x52, 0x4f, 0x5d,
+  0x76, 0xd2, 0x61, 0xf0, 0xdd, 0xc0, 0x1d, 0x75, 0xba, 0x92, 0xc7, 0x79,
+  0x87, 0xe3, 0x69, 0xd4, 0xed, 0x99, 0xf7, 0xf0, 0xd8, 0x3d, 0x3c, 0xda,
+  0x61, 0x75, 0x59, 0x5c, 0xdb, 0x99, 0xfd, 0xbd, 0xc3, 0xf4, 0xe8, 0x76,
+  0x39, 0x2c, 0x7b, 0x14, 0xcd, 0xfc, 0x6e, 0x93, 0x6d, 0xf6, 0x08, 0xea,
+  0x61, 0x79, 0xea, 0x33, 0x6b, 0x64, 0xd9, 0x1d, 0xb6, 0xb9, 0xd9, 0x69,
+  0xf1, 0xed, 0x91, 0xb9, 0xb0, 0xdd, 0x59, 0xb7, 0x2d, 0x74, 0xad, 0x78,
+  0x11, 0x39, 0x1d, 0x46, 0x3b, 0xd1, 0xf8, 0x33, 0xbf, 0x87, 0xab, 0xd9,
+  0xd0, 0x27, 0xad, 0xdb, 0xf3, 0xa7, 0xe8, 0xa9, 0x4f, 0x50, 0x2f, 0x93,
+  0xd9, 0x87, 0xdd, 0x5c, 0xd8, 0x6e, 0x27, 0xbb, 0x19, 0x77, 0x38, 0x3c,
+  0xbb, 0xc3, 0xf0, 0x68, 0x77, 0x39, 0x7c, 0xd7, 0x8a, 0x66, 0x23, 0x3f,
+  0xe9, 0xb0, 0x05, 0x4e, 0xfc, 0x34, 0x8b, 0xbe, 0x75, 0xb9, 0x66, 0x81,
+  0xd3, 0x69, 0x89, 0x53, 0xd7, 0x0f, 0x3d, 0xc7, 0x77, 0x82, 0xd8, 0xe9,
+  0xa2, 0x1b, 0x6c, 0x90, 0xe7, 0x42, 0x8e, 0x72, 0x7c, 0x61, 0x1c, 0xf3,
+  0xc1, 0xb9, 0xbd, 0x25, 0x78, 0x4c, 0x51, 0x23, 0x2a, 0x02, 0xc2, 0x04,
+  0x24, 0x83, 0x65, 0xd1, 0xd8, 0x5a, 0xc2, 0x40, 0xe9, 0x54, 0x47, 0x47,
+  0x93, 0x7a, 0x18, 0x72, 0x31, 0xac, 0x0d, 0x1c, 0xd6, 0x38, 0x89, 0x30,
+  0x13, 0x32, 0xf7, 0x31, 0x67, 0xd5, 0xfa, 0x49, 0x32, 0xc2, 0xb9, 0x7e,
+  0x56, 0xa9, 0xb1, 0xd1, 0x7c, 0xd5, 0xae, 0x1c, 0x08, 0xe2, 0x6d, 0x89,
+  0x13, 0x45, 0x92, 0xf1, 0xd5, 0xd8, 0xd8, 0x0b, 0x27, 0xe4, 0xef, 0x24,
+  0x2d, 0xdc, 0xa7, 0xc8, 0x8d, 0xcd, 0xdf, 0x3c, 0xa7, 0x63, 0x74, 0x18,
+  0xcd, 0x62, 0xc7, 0x8a, 0x1d, 0xbb, 0xc3, 0x17, 0xcc, 0xe2, 0xb4, 0x67,
+  0xe4, 0x22, 0xf8, 0x16, 0xcc, 0x9e, 0x82, 0x1e, 0x81, 0xae, 0x1f, 0x7a,
+  0x8e, 0xef, 0x04, 0x17, 0xeb, 0x8d, 0x4b, 0x13, 0x0d, 0x45, 0x40, 0x98,
+  0x80, 0x64, 0xb0, 0x2c, 0x1a, 0x5b, 0x4b, 0x18, 0x28, 0xe4, 0xb9, 0xb3,
+  0x41, 0x4e, 0xea, 0x61, 0xb8, 0x45, 0x35, 0xac, 0x1d, 0x1c, 0xd6, 0x38,
+  0xf1, 0x40, 0x91, 0xf5, 0x6f, 0xe0, 0x2b, 0x1c, 0x1b, 0x8d, 0xa0, 0x3f,
+  0xe4, 0x40, 0x10, 0x6f, 0x4b, 0x9c, 0x28, 0x92, 0x8c, 0xaf, 0xc6, 0xc6,
+  0x5e, 0xf8, 0x9d, 0x4d, 0x5c, 0x1c, 0x8a, 0xac, 0x4a, 0x4a, 0xad, 0xc6,
+  0x12, 0xb2, 0x57, 0xbb, 0x92, 0x40, 0x4c, 0xf0, 0x5f, 0x5c, 0xa9, 0xbb,
+  0xb8, 0x2a, 0x85, 0xa4, 0x79, 0x6d, 0xef, 0x59, 0x06, 0x45, 0x21, 0x7e,
+  0x60, 0x9e, 0x40, 0x51, 0xa1, 0xc7, 0x14, 0x9d, 0x6a, 0x93, 0x79, 0x3c,
+  0x0b, 0x43, 0xc7, 0x1e, 0x1b, 0x2d, 0xf5, 0xd4, 0x15, 0x7a, 0xe6, 0xb3,
+  0x1b, 0x4c, 0x3b, 0x5c, 0x71, 0x64, 0x06, 0x73, 0x37, 0x76, 0x67, 0x41,
+  0xb7, 0x37, 0x34, 0x17, 0x73, 0xc7, 0x4e, 0xeb, 0xe0, 0xdf, 0x4c, 0xeb,
+  0x5b, 0x3f, 0x77, 0xe4, 0x58, 0xb3, 0xc8, 0xee, 0x0e, 0xef, 0xeb, 0x0b,
+  0x66, 0xa9, 0xef, 0xd8, 0xae, 0x99, 0x86, 0x91, 0x33, 0x77, 0x82, 0xf8,
+  0xdc, 0xde, 0x12, 0x3c, 0xa6, 0xa8, 0x11, 0x15, 0x01, 0x61, 0x02, 0x92,
+  0xc1, 0xb2, 0x68, 0x6c, 0x2d, 0x61, 0xa0, 0x90, 0xe7, 0xce, 0x06, 0x39,
+  0xa9, 0x87, 0x21, 0x17, 0xc3, 0xda, 0xc0, 0x61, 0xad, 0x57, 0x08, 0xa5,
+  0x98, 0x36, 0x44, 0x98, 0x09, 0x99, 0x7f, 0xaf, 0xa0, 0x60, 0xb4, 0xf5,
+  0x45, 0x8e, 0x6a, 0x6c, 0x34, 0x06, 0x6d, 0xcc, 0x81, 0x20, 0xde, 0x96,
+  0x38, 0x51, 0x24, 0x19, 0x5f, 0x8d, 0x8d, 0xbd, 0x70, 0xb1, 0xd8, 0x50,
+  0x28, 0x37, 0x2c, 0xc3, 0x79, 0xfd, 0x21, 0x3e, 0xa8, 0x59, 0x99, 0xeb,
+  0xc3, 0x7f, 0x01, 0x18, 0xa5, 0x21, 0x42, 0x51, 0x3d, 0x00, 0x00
 };
-unsigned int transport_xml_len = 15697;
+const unsigned int transport_xml_gz_len = 2999;
+const unsigned int transport_xml_len = 15697;
@@ -7,6 +7,15 @@
 #include "dlna/IUDPService.h"
 #include "assert.h"
 
+#ifndef DLNA_UDP_QUEUE_SIZE
+#define DLNA_UDP_QUEUE_SIZE 50
+#endif
+
+// max size of a packet when we use preallocated slots
+#ifndef DLNA_UDP_MAX_PACKET_SIZE
+#define DLNA_UDP_MAX_PACKET_SIZE 1024
+#endif
+
 namespace tiny_dlna {
 
 /**
@@ -17,38 +26,43 @@ namespace tiny_dlna {
 
 class UDPAsyncService : public IUDPService {
  public:
+  /// Receive the packets into a ring of preallocated slots, so that no memory
+  /// is allocated in the AsyncUDP task. Call this method before begin().
+  void setPreallocatedSlots(int count,
+                            uint16_t slotSize = DLNA_UDP_MAX_PACKET_SIZE) {
+    slot_size = slotSize;
+    slots.resize(count);
+    for (auto& slot : slots) slot.data.setCapacity(slotSize);
+    free_slots.resize(count);
+    ready_slots.resize(count);
+    for (int j = 0; j < count; j++) free_slots.enqueue(j);
+  }
+
+  /// Binds the multicast socket to a network interface (e.g.
+  /// TCPIP_ADAPTER_IF_ETH): needed if the device is announced on several
+  /// interfaces. Call this method before begin().
+  void setNetworkInterface(tcpip_adapter_if_t adapter) {
+    network_if = adapter;
+  }
+
+  bool begin(int port) {
+    DLNA_LOG(DlnaInfo, "begin: %d", port);
+    if (!udp.listen(port)) return false;
+    udp.onPacket([&](AsyncUDPPacket packet) { receivePacket(packet); });
+    return true;
+  }
+
   bool begin(IPAddressAndPort addr) {
     peer = addr;
-    DlnaLogger.log(DlnaInfo, "beginMulticast: %s", addr.toString());
-
-    if (udp.listen(addr.port)){
-       udp.onPacket([&](AsyncUDPPacket packet) {
-        RequestData result;
-        result.peer.address = packet.remoteIP();
-        result.peer.port = packet.remotePort();
-        assert(!(result.peer.address == IPAddress()));
-        // save data
-        result.data.copyFrom((const char*)packet.data(), packet.length());
-
-        //queue.push_back(result);
-        queue.enqueue(result);
-      });     
+    DLNA_LOG(DlnaInfo, "beginMulticast: %s", addr.toString());
+
+    if (udp.listen(addr.port)) {
+      udp.onPacket([&](AsyncUDPPacket packet) { receivePacket(packet); });
     }
 
-    if (udp.listenMulticast(addr.address,
-                            addr.port)) {  // Start listening for UDP Multicast
-                                           // on AP interface only
-      udp.onPacket([&](AsyncUDPPacket packet) {
-        RequestData result;
-        result.peer.address = packet.remoteIP();
-        result.peer.port = packet.remotePort();
-        assert(!(result.peer.address == IPAddress()));
-        // save data
-        result.data.copyFrom((const char*)packet.data(), packet.length());
-
-        //queue.push_back(result);
-        queue.enqueue(result);
-      });
+    // Start listening for UDP Multicast on the selected interface (or all)
+    if (udp.listenMulticast(addr.address, addr.port, 1, network_if)) {
+      udp.onPacket([&](AsyncUDPPacket packet) { receivePacket(packet); });
     }
     return true;
   }
@@ -56,10 +70,10 @@ class UDPAsyncService : public IUDPService {
   bool send(uint8_t* data, int len) { return send(peer, data, len); }
 
   bool send(IPAddressAndPort addr, uint8_t* data, int len) {
-    DlnaLogger.log(DlnaDebug, "sending %d bytes", len);
-    int sent = udp.writeTo(data, len, addr.address, addr.port);
+    DLNA_LOG(DlnaDebug, "sending %d bytes", len);
+    int sent = udp.writeTo(data, len, addr.address, addr.port, network_if);
     if(sent != len){
-      DlnaLogger.log(DlnaError, "sending %d bytes -> %d", len, sent);
+      DLNA_LOG(DlnaError, "sending %d bytes -> %d", len, sent);
     }
     return sent == len;
   }
@@ -70,15 +84,82 @@ class UDPAsyncService : public IUDPService {
     //   result = queue.back();
     //   queue.pop_back();
     // }
-    queue.dequeue(result);
+    receive(result);
     return result;
   }
 
+  int receive(RequestData* result, int maxCount) {
+    int count = 0;
+    while (count < maxCount && receive(result[count])) count++;
+    return count;
+  }
+
  protected:
   AsyncUDP udp;
   IPAddressAndPort peer;
+  tcpip_adapter_if_t network_if = TCPIP_ADAPTER_IF_MAX;
 //  Vector<RequestData> queue{50};
-  QueueLockFree<RequestData> queue{50};
+  QueueLockFree<RequestData> queue{DLNA_UDP_QUEUE_SIZE};
+  // preallocated slots
+  struct PacketSlot {
+    IPAddressAndPort peer;
+    Str data;
+  };
+  uint16_t slot_size = 0;
+  Vector<PacketSlot> slots;
+  QueueLockFree<int> free_slots{1};
+  QueueLockFree<int> ready_slots{1};
+
+  /// Provides the next received packet: the buffer of the slot is swapped
+  /// with the buffer of the result, so that the data is not copied
+  bool receive(RequestData& result) {
+    if (slot_size == 0) return queue.dequeue(result);
+    int idx;
+    if (!ready_slots.dequeue(idx)) return false;
+    PacketSlot& slot = slots[idx];
+    result.peer = slot.peer;
+    result.data.swap(slot.data);
+    // the slot gets the old buffer of the result: this only allocates if it
+    // was smaller than a slot (e.g. for the first packets of a batch)
+    slot.data.setCapacity(slot_size);
+    // hand back the slot to the AsyncUDP task
+    free_slots.enqueue(idx);
+    return true;
+  }
+
+  /// Copies the packet into a free slot
+  void receivePacketToSlot(AsyncUDPPacket& packet) {
+    int idx;
+    if (packet.length() > slot_size || !free_slots.dequeue(idx)) {
+      addDropped();
+      return;
+    }
+    PacketSlot& slot = slots[idx];
+    slot.peer.address = packet.remoteIP();
+    slot.peer.port = packet.remotePort();
+    // the capacity of the slot is sufficient: so we do not allocate
+    slot.data.copyFrom((const char*)packet.data(), packet.length());
+    ready_slots.enqueue(idx);
+  }
+
+  /// Called by the AsyncUDP task for each received packet
+  void receivePacket(AsyncUDPPacket& packet) {
+    // discard irrelevant packets before we allocate any memory
+    if (!isAccepted((const char*)packet.data(), packet.length())) return;
+    if (slot_size > 0) {
+      receivePacketToSlot(packet);
+      return;
+    }
+    RequestData result;
+    result.peer.address = packet.remoteIP();
+    result.peer.port = packet.remotePort();
+    assert(!(result.peer.address == IPAddress()));
+    // save data
+    result.data.copyFrom((const char*)packet.data(), packet.length());
+
+    //queue.push_back(result);
+    if (!queue.enqueue(std::move(result))) addDropped();
+  }
 };
 
 }  // namespace tiny_dlna
\ No newline at end of file
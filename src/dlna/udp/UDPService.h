@@ -18,7 +18,7 @@ class UDPService : public IUDPService {
   UDPService() = default;
 
   bool begin(int port) override {
-    DlnaLogger.log(DlnaInfo, "begin: %d", port);
+    DLNA_LOG(DlnaInfo, "begin: %d", port);
     is_multicast = false;
     return udp.begin(port);
   }
@@ -26,44 +26,71 @@ class UDPService : public IUDPService {
   bool begin(IPAddressAndPort addr) override {
     peer = addr;
     is_multicast = true;
-    DlnaLogger.log(DlnaInfo, "beginMulticast: %s", addr.toString());
+    DLNA_LOG(DlnaInfo, "beginMulticast: %s", addr.toString());
     return udp.beginMulticast(addr.address, addr.port);
   }
 
   bool send(uint8_t *data, int len) override { return send(peer, data, len); }
 
   bool send(IPAddressAndPort addr, uint8_t *data, int len) override {
-    DlnaLogger.log(DlnaDebug, "sending %d bytes", len);
+    DLNA_LOG(DlnaDebug, "sending %d bytes", len);
     udp.beginPacket(addr.address, addr.port);
     int sent = udp.write(data, len);
     assert(sent == len);
     bool result = udp.endPacket();
     if (!result) {
-      DlnaLogger.log(DlnaError, "Sending failed");
+      DLNA_LOG(DlnaError, "Sending failed");
     }
     return result;
   }
 
+  using IUDPService::receive;
+
   RequestData receive() override {
     RequestData result;
-    // udp.flush();
-    int packetSize = udp.parsePacket();
-    if (packetSize > 0) {
-      result.peer.address = udp.remoteIP();
-      result.peer.port = udp.remotePort();
-      char tmp[packetSize + 1] = {0};
-      int len = udp.readBytes(tmp, len);
-      result.data = tmp;
-      DlnaLogger.log(DlnaDebug, "(%s [%d])->: %s", result.peer.toString(),
-                     packetSize, tmp);
-    }
+    int packets = max_packets;
+    receive(result, packets);
     return result;
   }
 
+  /// Receives up to maxCount packets: the buffers of the provided entries are
+  /// reused, so that we do not need to allocate memory for each packet
+  int receive(RequestData *result, int maxCount) override {
+    int count = 0;
+    int packets = max_packets;
+    while (count < maxCount && receive(result[count], packets)) count++;
+    return count;
+  }
+
  protected:
   WiFiUDP udp;
   IPAddressAndPort peer;
   bool is_multicast = false;
+
+  /// Reads the next relevant packet into the result: returns false if there
+  /// is none. The number of read packets is deducted from packets.
+  bool receive(RequestData &result, int &packets) {
+    int packet_size;
+    while (packets > 0 && (packet_size = udp.parsePacket()) > 0) {
+      packets--;
+      result.peer.address = udp.remoteIP();
+      result.peer.port = udp.remotePort();
+      result.data.resize(packet_size);
+      char *data = (char *)result.data.c_str();
+      int len = udp.readBytes(data, packet_size);
+      if (len < 0) len = 0;
+      data[len] = 0;
+      result.data.resize(len);
+      // discard irrelevant packets
+      if (isAccepted(data, len)) {
+        DLNA_LOG(DlnaDebug, "(%s [%d])->: %s", result.peer.toString(),
+                 packet_size, data);
+        return true;
+      }
+    }
+    result.data.resize(0);
+    return false;
+  }
 };
 
 }  // namespace tiny_dlna
\ No newline at end of file
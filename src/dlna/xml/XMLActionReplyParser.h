@@ -0,0 +1,61 @@
+#pragma once
+
+#include "XMLStreamParser.h"
+#include "basic/StrView.h"
+#include "dlna/StringRegistry.h"
+#include "dlna/service/Action.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief Parses the SOAP reply of an action while it is received: the child
+ * nodes of the <u:xxxResponse> node are added as arguments to the
+ * ActionReply. The argument names are stored in the StringRegistry.
+ * @author Phil Schatzmann
+ */
+class XMLActionReplyParser : public XMLStreamParser {
+ public:
+  XMLActionReplyParser() = default;
+  XMLActionReplyParser(ActionReply& reply, StringRegistry& strings) {
+    begin(reply, strings);
+  }
+
+  /// Starts the parsing of a new reply
+  void begin(ActionReply& reply, StringRegistry& strings) {
+    p_reply = &reply;
+    p_strings = &strings;
+    begin();
+  }
+
+  void begin() override {
+    XMLStreamParser::begin();
+    response_depth = -1;
+  }
+
+ protected:
+  ActionReply* p_reply = nullptr;
+  StringRegistry* p_strings = nullptr;
+  // depth of the <u:xxxResponse> node
+  int response_depth = -1;
+
+  void onNodeBegin(const char* name) override {
+    if (response_depth < 0 && StrView(name).endsWith("Response")) {
+      response_depth = depth;
+    }
+  }
+
+  void onNodeEnd(const char* name, const char* value) override {
+    if (depth == response_depth) {
+      response_depth = -1;
+      return;
+    }
+    if (response_depth < 0 || depth != response_depth + 1) return;
+    if (p_reply == nullptr || p_strings == nullptr) return;
+    Argument arg;
+    arg.name = p_strings->add((char*)name);
+    arg.value = value;
+    p_reply->arguments.push_back(arg);
+  }
+};
+
+}  // namespace tiny_dlna
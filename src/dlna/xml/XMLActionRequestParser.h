@@ -0,0 +1,66 @@
+#pragma once
+
+#include "XMLStreamParser.h"
+#include "basic/Vector.h"
+#include "dlna/service/State.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief Parses the SOAP request of an action while it is received: the name
+ * of the action node (w/o namespace prefix) is provided by getAction() and
+ * its child nodes are added as arguments. Arguments which are longer than
+ * DLNA_XML_VALUE_MAX_SIZE are reported by isArgumentCut().
+ * @author Phil Schatzmann
+ */
+class XMLActionRequestParser : public XMLStreamParser {
+ public:
+  XMLActionRequestParser() = default;
+
+  /// Starts the parsing of a new request
+  void begin(Vector<StateValue>& arguments) {
+    p_arguments = &arguments;
+    begin();
+  }
+
+  void begin() override {
+    XMLStreamParser::begin();
+    action[0] = 0;
+    is_argument_cut = false;
+  }
+
+  /// Name of the action: e.g. Play
+  const char* getAction() { return action; }
+
+  /// Returns true if an argument was too long and has been cut off
+  bool isArgumentCut() { return is_argument_cut; }
+
+ protected:
+  Vector<StateValue>* p_arguments = nullptr;
+  char action[DLNA_XML_TAG_SIZE] = {0};
+  bool is_argument_cut = false;
+
+  static const char* localName(const char* name) {
+    const char* colon = strchr(name, ':');
+    return colon == nullptr ? name : colon + 1;
+  }
+
+  void onNodeBegin(const char* name) override {
+    // <s:Envelope><s:Body><u:Play>
+    if (depth == 3) {
+      strncpy(action, localName(name), DLNA_XML_TAG_SIZE - 1);
+      action[DLNA_XML_TAG_SIZE - 1] = 0;
+    }
+  }
+
+  void onNodeEnd(const char* name, const char* value) override {
+    if (depth != 4 || p_arguments == nullptr) return;
+    if (is_value_cut) is_argument_cut = true;
+    StateValue arg;
+    arg.name = localName(name);
+    arg.value = value;
+    p_arguments->push_back(arg);
+  }
+};
+
+}  // namespace tiny_dlna
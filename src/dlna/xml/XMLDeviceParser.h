@@ -1,149 +1,231 @@
 #pragma once
 
+#include <stdlib.h>
+
 #include "Print.h"
-#include "assert.h"
+#include "XMLStreamParser.h"
 #include "basic/Icon.h"
 #include "basic/StrView.h"
 #include "dlna/DLNADevice.h"
 
 namespace tiny_dlna {
 
+/// Nodes of the device xml which are relevant for the DLNADevice
+enum XMLDeviceField : uint8_t {
+  XD_BASE_URL,
+  XD_VERSION_MAJOR,
+  XD_VERSION_MINOR,
+  XD_DEVICE_TYPE,
+  XD_FRIENDLY_NAME,
+  XD_MANUFACTURER,
+  XD_MANUFACTURER_URL,
+  XD_MODEL_DESCRIPTION,
+  XD_MODEL_NAME,
+  XD_MODEL_NUMBER,
+  XD_MODEL_URL,
+  XD_SERIAL_NUMBER,
+  XD_UDN,
+  XD_ICON,
+  XD_ICON_MIME,
+  XD_ICON_WIDTH,
+  XD_ICON_HEIGHT,
+  XD_ICON_DEPTH,
+  XD_ICON_URL,
+  XD_SERVICE,
+  XD_SERVICE_TYPE,
+  XD_SERVICE_ID,
+  XD_SERVICE_SCPD_URL,
+  XD_SERVICE_CONTROL_URL,
+  XD_SERVICE_EVENT_SUB_URL
+};
+
+/// Path suffix of a device xml node with the required depth (0 = any)
+struct XMLDeviceTag {
+  const char* path;
+  uint8_t depth;
+  XMLDeviceField field;
+};
+
+/// The fields of the root device are only taken from the root device, the
+/// icons and services from all (embedded) devices
+const XMLDeviceTag xml_device_tags[] = {
+    {"root/URLBase", 2, XD_BASE_URL},
+    {"specVersion/major", 3, XD_VERSION_MAJOR},
+    {"specVersion/minor", 3, XD_VERSION_MINOR},
+    {"device/deviceType", 3, XD_DEVICE_TYPE},
+    {"device/friendlyName", 3, XD_FRIENDLY_NAME},
+    {"device/manufacturer", 3, XD_MANUFACTURER},
+    {"device/manufacturerURL", 3, XD_MANUFACTURER_URL},
+    {"device/modelDescription", 3, XD_MODEL_DESCRIPTION},
+    {"device/modelName", 3, XD_MODEL_NAME},
+    {"device/modelNumber", 3, XD_MODEL_NUMBER},
+    {"device/modelURL", 3, XD_MODEL_URL},
+    {"device/serialNumber", 3, XD_SERIAL_NUMBER},
+    {"device/UDN", 3, XD_UDN},
+    {"iconList/icon", 0, XD_ICON},
+    {"icon/mimetype", 0, XD_ICON_MIME},
+    {"icon/width", 0, XD_ICON_WIDTH},
+    {"icon/height", 0, XD_ICON_HEIGHT},
+    {"icon/depth", 0, XD_ICON_DEPTH},
+    {"icon/url", 0, XD_ICON_URL},
+    {"serviceList/service", 0, XD_SERVICE},
+    {"service/serviceType", 0, XD_SERVICE_TYPE},
+    {"service/serviceId", 0, XD_SERVICE_ID},
+    {"service/SCPDURL", 0, XD_SERVICE_SCPD_URL},
+    {"service/controlURL", 0, XD_SERVICE_CONTROL_URL},
+    {"service/eventSubURL", 0, XD_SERVICE_EVENT_SUB_URL},
+};
+
 /**
- * @brief Parses an DLNA device xml string to fill the DLNADevice data
- * structure
+ * @brief Parses an DLNA device xml to fill the DLNADevice data structure.
+ * The xml is processed incrementally: after begin() the data can be written
+ * in any number of pieces (e.g. directly with HttpRequest::readReply()), so
+ * that the document does not need to be kept in memory.
  * @author Phil Schatzmann
  */
 
-class XMLDeviceParser {
+class XMLDeviceParser : public XMLStreamParser {
  public:
-  void parse(DLNADevice& result, StringRegistry& strings, const char* xmlStr) {
+  /// Starts the incremental parsing: provide the xml with write()
+  void begin(DLNADevice& result, StringRegistry& strings) {
     p_strings = &strings;
-    StrView tmp(xmlStr);
-    str.swap(tmp);
+    p_device = &result;
     Url empty_url;
-    result.base_url = nullptr;
     result.device_url = empty_url;
-    p_device = &result;
-    parseVersion(result);
-    parseIcons(result);
-    parseDevice(result);
+    result.base_url = nullptr;
+    result.device_type = nullptr;
+    result.friendly_name = nullptr;
+    result.manufacturer = nullptr;
+    result.manufacturer_url = nullptr;
+    result.model_description = nullptr;
+    result.model_name = nullptr;
+    result.model_number = nullptr;
+    result.model_url = nullptr;
+    XMLStreamParser::begin();
+  }
+
+  /// Parses the complete xml string
+  void parse(DLNADevice& result, StringRegistry& strings, const char* xmlStr) {
+    begin(result, strings);
+    if (xmlStr != nullptr) write((const uint8_t*)xmlStr, strlen(xmlStr));
   }
 
  protected:
-  StrView str;
   DLNADevice* p_device = nullptr;
   StringRegistry* p_strings = nullptr;
-
-  /// extract string, add to string repository and return repository string
-  const char* substring(char* in, int pos, int end) {
-    const int len = end - pos + 1;
-    char tmp[len];
-    StrView tmp_str(tmp, len);
-    tmp_str.substring(in, pos, end);
-    return p_strings->add((char*)tmp_str.c_str());
-  }
-
-  void parseVersion(DLNADevice& result) {
-    parseInt(0, "<major>", result.version_major);
-    parseInt(0, "<minor>", result.version_minor);
-  }
-
-  void parseDevice(DLNADevice& result) {
-    parseStr("<deviceType>", result.device_type);
-    parseStr("<friendlyName>", result.friendly_name);
-    parseStr("<manufacturer>", result.manufacturer);
-    parseStr("<manufacturerURL>", result.manufacturer_url);
-    parseStr("<modelDescription>", result.model_description);
-    parseStr("<modelName>", result.model_name);
-    parseStr("<modelNumber>", result.model_number);
-    parseStr("<modelURL>", result.model_url);
-    parseStr("<URLBase>", result.base_url);
-    parseServices();
-  };
-
-  int parseStr(const char* name, const char*& result) {
-    return parseStr(0, name, result);
-  }
-
-  int parseInt(int pos, const char* name, int& result) {
-    char temp[50] = {0};
-    StrView temp_view(temp, 50);
-    int start_pos = str.indexOf(name, pos);
-    int end_pos = -1;
-    if (start_pos > 0) {
-      StrView tag(name);
-      start_pos += tag.length();
-      end_pos = str.indexOf("</", start_pos);
-      temp_view.substring((char*)str.c_str(), start_pos, end_pos);
-      result = temp_view.toInt();
-      DlnaLogger.log(DlnaDebug, "device xml %s : %s / %d", name, temp_view.c_str(), result);
-
-      end_pos = str.indexOf(">", end_pos);
+  Icon icon;
+  DLNAServiceInfo service;
+
+  /// add string to string repository and return repository string
+  const char* add(const char* value) { return p_strings->add((char*)value); }
+
+  /// finds the entry of the actual node in the xml_device_tags table
+  const XMLDeviceTag* findTag() {
+    int depth = getDepth();
+    for (auto& tag : xml_device_tags) {
+      if ((tag.depth == 0 || tag.depth == depth) && isPath(tag.path)) {
+        return &tag;
+      }
     }
-    return end_pos;
+    return nullptr;
   }
 
-  int parseStr(int pos, const char* name, const char*& result) {
-    int start_pos = str.indexOf(name, pos);
-    int end = -1;
-    if (start_pos > 0) {
-      StrView tag(name);
-      start_pos += tag.length();
-      int end_str = str.indexOf("</", start_pos);
-      result = substring((char*)str.c_str(), start_pos, end_str);
-      DlnaLogger.log(DlnaDebug, "device xml %s : %s", name, result);
-      end = str.indexOf(">", end_str);
-    } else {
-      result = nullptr;
+  void onNodeBegin(const char* name) override {
+    const XMLDeviceTag* tag = findTag();
+    if (tag == nullptr) return;
+    if (tag->field == XD_ICON) {
+      Icon new_icon;
+      icon = new_icon;
+    } else if (tag->field == XD_SERVICE) {
+      DLNAServiceInfo new_service;
+      service = new_service;
     }
-    return end;
-  }
-
-  void parseIcons(DLNADevice& device) {
-    int pos = 0;
-    do {
-      pos = parseIcon(device, pos);
-    } while (pos > 0);
-  }
-
-  int parseIcon(DLNADevice& device, int pos) {
-    Icon icon;
-    int result = -1;
-    int iconPos = str.indexOf("<icon>", pos);
-    if (iconPos > 0) {
-      parseStr(iconPos, "<mimetype>", icon.mime);
-      parseInt(iconPos, "<width>", icon.width);
-      parseInt(iconPos, "<height>", icon.height);
-      parseInt(iconPos, "<depth>", icon.depth);
-      parseStr(iconPos, "<url>", icon.icon_url);
-      device.addIcon(icon);
-      result = str.indexOf("</icon>", pos) + 7;
-    }
-    return result;
-  }
-
-  void parseServices() {
-    int pos = 0;
-    do {
-      pos = parseService(pos);
-    } while (pos > 0);
   }
 
-  int parseService(int pos) {
-    DLNAServiceInfo service;
-    int result = -1;
-    int servicePos = str.indexOf("<service>", pos);
-    if (servicePos > 0) {
-      parseStr(servicePos, "<serviceType>", service.service_type);
-      parseStr(servicePos, "<serviceId>", service.service_id);
-      parseStr(servicePos, "<SCPDURL>", service.scpd_url);
-      parseStr(servicePos, "<controlURL>", service.control_url);
-      parseStr(servicePos, "<eventSubURL>", service.event_sub_url);
-      p_device->addService(service);
-      result = str.indexOf("</service>", pos) + 10;
+  void onNodeEnd(const char* name, const char* value) override {
+    const XMLDeviceTag* tag = findTag();
+    if (tag == nullptr || p_device == nullptr) return;
+    DLNADevice& device = *p_device;
+    DLNA_LOG(DlnaDebug, "device xml %s : %s", getPath(), value);
+
+    switch (tag->field) {
+      case XD_BASE_URL:
+        device.base_url = add(value);
+        break;
+      case XD_VERSION_MAJOR:
+        device.version_major = atoi(value);
+        break;
+      case XD_VERSION_MINOR:
+        device.version_minor = atoi(value);
+        break;
+      case XD_DEVICE_TYPE:
+        device.device_type = add(value);
+        break;
+      case XD_FRIENDLY_NAME:
+        device.friendly_name = add(value);
+        break;
+      case XD_MANUFACTURER:
+        device.manufacturer = add(value);
+        break;
+      case XD_MANUFACTURER_URL:
+        device.manufacturer_url = add(value);
+        break;
+      case XD_MODEL_DESCRIPTION:
+        device.model_description = add(value);
+        break;
+      case XD_MODEL_NAME:
+        device.model_name = add(value);
+        break;
+      case XD_MODEL_NUMBER:
+        device.model_number = add(value);
+        break;
+      case XD_MODEL_URL:
+        device.model_url = add(value);
+        break;
+      case XD_SERIAL_NUMBER:
+        device.serial_number = add(value);
+        break;
+      case XD_UDN:
+        device.udn = add(value);
+        break;
+      case XD_ICON:
+        device.addIcon(icon);
+        break;
+      case XD_ICON_MIME:
+        icon.mime = add(value);
+        break;
+      case XD_ICON_WIDTH:
+        icon.width = atoi(value);
+        break;
+      case XD_ICON_HEIGHT:
+        icon.height = atoi(value);
+        break;
+      case XD_ICON_DEPTH:
+        icon.depth = atoi(value);
+        break;
+      case XD_ICON_URL:
+        icon.icon_url = add(value);
+        break;
+      case XD_SERVICE:
+        device.addService(service);
+        break;
+      case XD_SERVICE_TYPE:
+        service.service_type = add(value);
+        break;
+      case XD_SERVICE_ID:
+        service.service_id = add(value);
+        break;
+      case XD_SERVICE_SCPD_URL:
+        service.scpd_url = add(value);
+        break;
+      case XD_SERVICE_CONTROL_URL:
+        service.control_url = add(value);
+        break;
+      case XD_SERVICE_EVENT_SUB_URL:
+        service.event_sub_url = add(value);
+        break;
     }
-    return result;
   }
 };
 
-}  // namespace tiny_dlna
\ No newline at end of file
+}  // namespace tiny_dlna
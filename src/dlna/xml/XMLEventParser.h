@@ -0,0 +1,77 @@
+#pragma once
+
+#include "XMLStreamParser.h"
+#include "basic/StrView.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief Parses the body of a GENA NOTIFY message while it is received: each
+ * <e:property> value is reported with the callback. The (escaped) xml of a
+ * LastChange property is forwarded to a nested parser which reports the val
+ * attribute of each state variable of the InstanceID.
+ * @author Phil Schatzmann
+ */
+class XMLEventParser : public XMLStreamParser {
+ public:
+  /// Callback which is called for each received state variable
+  typedef void (*EventValueCallback)(const char* name, const char* value,
+                                     void* ref);
+
+  XMLEventParser() = default;
+  XMLEventParser(EventValueCallback cb, void* ref) { begin(cb, ref); }
+
+  /// Starts the parsing of a new event
+  void begin(EventValueCallback cb, void* ref) {
+    callback = cb;
+    p_ref = ref;
+    last_change.p_parent = this;
+    begin();
+  }
+
+  void begin() override {
+    XMLStreamParser::begin();
+    p_value_out = nullptr;
+  }
+
+ protected:
+  /// Parser for the content of the LastChange property
+  class LastChangeParser : public XMLStreamParser {
+   public:
+    XMLEventParser* p_parent = nullptr;
+
+   protected:
+    void onAttribute(const char* node, const char* name,
+                     const char* value) override {
+      // <Event><InstanceID val="0"><TransportState val="PLAYING"/>
+      if (depth < 2 || strcmp(name, "val") != 0) return;
+      p_parent->report(node, value);
+    }
+  };
+  LastChangeParser last_change;
+  EventValueCallback callback = nullptr;
+  void* p_ref = nullptr;
+
+  void report(const char* name, const char* value) {
+    if (callback != nullptr) callback(name, value, p_ref);
+  }
+
+  void onNodeBegin(const char* name) override {
+    // <e:propertyset><e:property><LastChange>
+    if (depth == 3 && StrView(name).equals("LastChange")) {
+      last_change.begin();
+      p_value_out = &last_change;
+    }
+  }
+
+  void onNodeEnd(const char* name, const char* value) override {
+    if (depth != 3) return;
+    if (p_value_out != nullptr) {
+      p_value_out = nullptr;
+      return;
+    }
+    report(name, value);
+  }
+};
+
+}  // namespace tiny_dlna
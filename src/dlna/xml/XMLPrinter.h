@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+
 #include "Print.h"
 #include "assert.h"
 #include "basic/StrView.h"
@@ -35,6 +37,46 @@ struct XMLPrinter {
   /// Defines the output
   void setOutput(Print& output) { p_out = &output; }
 
+  /// Prints the text w/o any formatting
+  size_t print(const char* txt) {
+    assert(p_out != nullptr);
+    return p_out->print(txt);
+  }
+
+  /// Prints the text with the xml special characters replaced by entities
+  size_t printEscaped(const char* txt) {
+    assert(p_out != nullptr);
+    return printEscaped(*p_out, txt);
+  }
+
+  /// Prints the text with the xml special characters replaced by entities
+  static size_t printEscaped(Print& out, const char* txt) {
+    if (txt == nullptr) return 0;
+    size_t result = 0;
+    for (const char* p = txt; *p != 0; p++) {
+      switch (*p) {
+        case '<':
+          result += out.print("&lt;");
+          break;
+        case '>':
+          result += out.print("&gt;");
+          break;
+        case '&':
+          result += out.print("&amp;");
+          break;
+        case '"':
+          result += out.print("&quot;");
+          break;
+        case '\'':
+          result += out.print("&apos;");
+          break;
+        default:
+          result += out.write(*p);
+      }
+    }
+    return result;
+  }
+
   size_t printXMLHeader() {
     assert(p_out != nullptr);
     return p_out->println("<?xml version=\"1.0\"?>");
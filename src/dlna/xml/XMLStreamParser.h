@@ -0,0 +1,422 @@
+#pragma once
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Print.h"
+#include "basic/Logger.h"
+#include "basic/Vector.h"
+
+// max length of the path of the actual node (e.g. /root/device/deviceType)
+#ifndef DLNA_XML_PATH_SIZE
+#define DLNA_XML_PATH_SIZE 256
+#endif
+
+// initial size of the buffer for a node value: it grows on demand
+#ifndef DLNA_XML_VALUE_SIZE
+#define DLNA_XML_VALUE_SIZE 512
+#endif
+
+// max length of a node value: longer values are cut off
+#ifndef DLNA_XML_VALUE_MAX_SIZE
+#define DLNA_XML_VALUE_MAX_SIZE 8192
+#endif
+
+// max length of the element name and of an entity
+#ifndef DLNA_XML_TAG_SIZE
+#define DLNA_XML_TAG_SIZE 64
+#endif
+
+namespace tiny_dlna {
+
+/**
+ * @brief Incremental (SAX like) XML parser: the data is provided in any
+ * number of pieces via the Print interface (e.g. directly with
+ * HttpRequest::readReply()), so that the document never needs to be kept in
+ * memory. We only use fixed buffers for the path of the actual node and a
+ * value buffer which grows up to DLNA_XML_VALUE_MAX_SIZE. Subclasses are
+ * informed about the attributes and the begin and end of each node: entities
+ * and CDATA are resolved in the values.
+ * @author Phil Schatzmann
+ */
+class XMLStreamParser : public Print {
+ public:
+  XMLStreamParser() {
+    value.resize(DLNA_XML_VALUE_SIZE);
+    value[0] = 0;
+  }
+
+  /// Resets the parser for a new document
+  virtual void begin() {
+    state = XML_TEXT;
+    attr_len = 0;
+    is_attr_value = false;
+    path_len = 0;
+    path[0] = 0;
+    depth = 0;
+    overflow_depth = 0;
+    clearValue();
+  }
+
+  size_t write(uint8_t ch) override {
+    parse((char)ch);
+    return 1;
+  }
+
+  size_t write(const uint8_t* data, size_t len) override {
+    for (size_t j = 0; j < len; j++) parse((char)data[j]);
+    return len;
+  }
+
+  /// Path of the actual node, e.g. /root/device/deviceType
+  const char* getPath() { return path; }
+
+  /// Nesting level of the actual node (1 for the root node)
+  int getDepth() { return depth; }
+
+  /// Checks if the path of the actual node ends with the indicated nodes
+  /// (e.g. "service/serviceType")
+  bool isPath(const char* suffix) {
+    int len = strlen(suffix);
+    if (len > path_len) return false;
+    if (len < path_len && path[path_len - len - 1] != '/') return false;
+    return strcmp(path + path_len - len, suffix) == 0;
+  }
+
+ protected:
+  enum XMLState {
+    XML_TEXT,
+    XML_ENTITY,
+    XML_TAG_START,
+    XML_TAG_NAME,
+    XML_TAG_ATTR,
+    XML_SPECIAL,
+    XML_COMMENT,
+    XML_CDATA
+  };
+  XMLState state = XML_TEXT;
+  // state to continue with after an entity
+  XMLState entity_return = XML_TEXT;
+  char path[DLNA_XML_PATH_SIZE] = {0};
+  int path_len = 0;
+  int depth = 0;
+  // number of nodes which did not fit into the path
+  int overflow_depth = 0;
+  Vector<char> value;
+  int value_len = 0;
+  bool is_value_cut = false;
+  char tag[DLNA_XML_TAG_SIZE] = {0};
+  int tag_len = 0;
+  char entity[12] = {0};
+  int entity_len = 0;
+  // name of the actual attribute: the value is collected in the value buffer
+  char attr[DLNA_XML_TAG_SIZE] = {0};
+  int attr_len = 0;
+  bool is_attr_eq = false;
+  // the attribute name has been terminated by a space
+  bool is_attr_name_end = false;
+  // we are in the quoted value of an attribute
+  bool is_attr_value = false;
+  // if defined the text of the actual node is forwarded to this output
+  // instead of being collected in the value buffer
+  Print* p_value_out = nullptr;
+  bool is_end_tag = false;
+  bool is_empty_tag = false;
+  char quote = 0;
+  // last characters of a comment or CDATA section
+  char last[2] = {0};
+
+  /// Called for each attribute before the begin of the node
+  virtual void onAttribute(const char* node, const char* name,
+                           const char* value) {}
+
+  /// Called at the begin of a node
+  virtual void onNodeBegin(const char* name) {}
+
+  /// Called at the end of a node with the text since the last begin or end
+  /// of a node: for elements w/o children this is the value
+  virtual void onNodeEnd(const char* name, const char* value) {}
+
+  /// processes a single character
+  void parse(char ch) {
+    switch (state) {
+      case XML_TEXT:
+        if (ch == '<') {
+          state = XML_TAG_START;
+          tag_len = 0;
+          is_end_tag = false;
+          is_empty_tag = false;
+        } else if (ch == '&') {
+          startEntity();
+        } else {
+          addValue(ch);
+        }
+        break;
+
+      case XML_ENTITY:
+        if (ch == ';') {
+          entity[entity_len] = 0;
+          addEntity();
+          state = entity_return;
+        } else if (entity_len < (int)sizeof(entity) - 1) {
+          entity[entity_len++] = ch;
+        }
+        break;
+
+      case XML_TAG_START:
+        if (ch == '/') {
+          is_end_tag = true;
+          state = XML_TAG_NAME;
+        } else if (ch == '?' || ch == '!') {
+          tag[tag_len++] = ch;
+          state = XML_SPECIAL;
+        } else {
+          state = XML_TAG_NAME;
+          parse(ch);
+        }
+        break;
+
+      case XML_TAG_NAME:
+        if (ch == '>') {
+          tagEnd();
+        } else if (ch == '/') {
+          is_empty_tag = true;
+          startAttributes();
+        } else if (isspace((unsigned char)ch)) {
+          startAttributes();
+        } else if (tag_len < DLNA_XML_TAG_SIZE - 1) {
+          tag[tag_len++] = ch;
+        }
+        break;
+
+      case XML_TAG_ATTR:
+        if (quote != 0) {
+          if (ch == quote) {
+            quote = 0;
+            attributeEnd();
+          } else if (ch == '&') {
+            startEntity();
+          } else {
+            addValue(ch, true);
+          }
+        } else if (ch == '"' || ch == '\'') {
+          quote = ch;
+          is_attr_value = true;
+          clearValue();
+        } else if (ch == '>') {
+          tagEnd();
+        } else if (ch == '=') {
+          is_attr_eq = true;
+          is_attr_name_end = false;
+        } else if (isspace((unsigned char)ch)) {
+          // the name is complete: but there might be spaces before the =
+          if (attr_len > 0) is_attr_name_end = true;
+        } else {
+          is_empty_tag = ch == '/';
+          if (!is_empty_tag && attr_len < DLNA_XML_TAG_SIZE - 1) {
+            // a new name starts
+            if (is_attr_eq || is_attr_name_end) attr_len = 0;
+            is_attr_eq = false;
+            is_attr_name_end = false;
+            attr[attr_len++] = ch;
+          }
+        }
+        break;
+
+      case XML_SPECIAL:
+        // <?xml ... ?>, <!DOCTYPE ...>, <!-- ... --> or <![CDATA[ ... ]]>
+        if (tag_len < DLNA_XML_TAG_SIZE - 1) tag[tag_len++] = ch;
+        tag[tag_len] = 0;
+        if (strcmp(tag, "!--") == 0) {
+          startSection(XML_COMMENT);
+        } else if (strcmp(tag, "![CDATA[") == 0) {
+          startSection(XML_CDATA);
+        } else if (ch == '>') {
+          state = XML_TEXT;
+        }
+        break;
+
+      case XML_COMMENT:
+        if (ch == '>' && last[0] == '-' && last[1] == '-') {
+          state = XML_TEXT;
+        }
+        addLast(ch);
+        break;
+
+      case XML_CDATA:
+        if (ch == '>' && last[0] == ']' && last[1] == ']') {
+          // remove the ]] which have already been added
+          value_len = value_len >= 2 ? value_len - 2 : 0;
+          value[value_len] = 0;
+          state = XML_TEXT;
+        } else {
+          addValue(ch, true);
+        }
+        addLast(ch);
+        break;
+    }
+  }
+
+  void startEntity() {
+    entity_return = state;
+    state = XML_ENTITY;
+    entity_len = 0;
+  }
+
+  void startAttributes() {
+    state = XML_TAG_ATTR;
+    tag[tag_len] = 0;
+    attr_len = 0;
+    is_attr_eq = false;
+    is_attr_name_end = false;
+  }
+
+  /// the quoted value of an attribute is complete
+  void attributeEnd() {
+    if (is_attr_eq && attr_len > 0) {
+      attr[attr_len] = 0;
+      onAttribute(tag, attr, value.data());
+    }
+    is_attr_value = false;
+    is_attr_eq = false;
+    is_attr_name_end = false;
+    attr_len = 0;
+    clearValue();
+  }
+
+  void startSection(XMLState newState) {
+    state = newState;
+    last[0] = last[1] = 0;
+  }
+
+  void addLast(char ch) {
+    last[0] = last[1];
+    last[1] = ch;
+  }
+
+  /// the element name is complete
+  void tagEnd() {
+    state = XML_TEXT;
+    quote = 0;
+    tag[tag_len] = 0;
+    if (is_end_tag) {
+      nodeEnd();
+    } else {
+      nodeBegin();
+      if (is_empty_tag) nodeEnd();
+    }
+  }
+
+  void nodeBegin() {
+    depth++;
+    if (overflow_depth > 0 || path_len + tag_len + 2 > DLNA_XML_PATH_SIZE) {
+      if (overflow_depth == 0) {
+        DLNA_LOG(DlnaWarning, "XML path too long: %s", tag);
+      }
+      overflow_depth++;
+    } else {
+      path[path_len++] = '/';
+      memcpy(path + path_len, tag, tag_len + 1);
+      path_len += tag_len;
+    }
+    clearValue();
+    onNodeBegin(tag);
+  }
+
+  void nodeEnd() {
+    if (depth == 0) return;
+    // remove trailing spaces
+    while (value_len > 0 && isspace((unsigned char)value[value_len - 1])) {
+      value[--value_len] = 0;
+    }
+    if (is_value_cut) {
+      DLNA_LOG(DlnaWarning, "XML value cut off: %s", path);
+    }
+    if (overflow_depth > 0) {
+      onNodeEnd("", value.data());
+      overflow_depth--;
+    } else {
+      int pos = path_len;
+      while (pos > 0 && path[pos] != '/') pos--;
+      onNodeEnd(path + pos + 1, value.data());
+      path_len = pos;
+      path[path_len] = 0;
+    }
+    depth--;
+    clearValue();
+  }
+
+  void clearValue() {
+    value_len = 0;
+    value[0] = 0;
+    is_value_cut = false;
+  }
+
+  void addValue(char ch, bool keepSpaces = false) {
+    if (p_value_out != nullptr && !is_attr_value) {
+      p_value_out->write(ch);
+      return;
+    }
+    // we skip the leading spaces
+    if (value_len == 0 && !keepSpaces && isspace((unsigned char)ch)) return;
+    if (value_len >= value.size() - 1 && !growValue()) {
+      is_value_cut = true;
+      return;
+    }
+    value[value_len++] = ch;
+    value[value_len] = 0;
+  }
+
+  /// doubles the size of the value buffer: returns false if the max size
+  /// has been reached or the memory is not available
+  bool growValue() {
+    int size = value.size();
+    if (size >= DLNA_XML_VALUE_MAX_SIZE) return false;
+    int new_size = size * 2;
+    if (new_size > DLNA_XML_VALUE_MAX_SIZE) new_size = DLNA_XML_VALUE_MAX_SIZE;
+    return value.resize(new_size);
+  }
+
+  /// resolves the entity in the tag buffer
+  void addEntity() {
+    if (strcmp(entity, "lt") == 0) {
+      addValue('<');
+    } else if (strcmp(entity, "gt") == 0) {
+      addValue('>');
+    } else if (strcmp(entity, "amp") == 0) {
+      addValue('&');
+    } else if (strcmp(entity, "quot") == 0) {
+      addValue('"');
+    } else if (strcmp(entity, "apos") == 0) {
+      addValue('\'');
+    } else if (entity[0] == '#') {
+      long code = entity[1] == 'x' ? strtol(entity + 2, nullptr, 16)
+                                   : strtol(entity + 1, nullptr, 10);
+      addCodePoint(code);
+    } else {
+      DLNA_LOG(DlnaWarning, "XML entity not supported: %s", entity);
+    }
+  }
+
+  /// adds the character as UTF-8
+  void addCodePoint(long code) {
+    if (code < 0x80) {
+      addValue((char)code, true);
+    } else if (code < 0x800) {
+      addValue((char)(0xC0 | (code >> 6)), true);
+      addValue((char)(0x80 | (code & 0x3F)), true);
+    } else if (code < 0x10000) {
+      addValue((char)(0xE0 | (code >> 12)), true);
+      addValue((char)(0x80 | ((code >> 6) & 0x3F)), true);
+      addValue((char)(0x80 | (code & 0x3F)), true);
+    } else {
+      addValue((char)(0xF0 | (code >> 18)), true);
+      addValue((char)(0x80 | ((code >> 12) & 0x3F)), true);
+      addValue((char)(0x80 | ((code >> 6) & 0x3F)), true);
+      addValue((char)(0x80 | (code & 0x3F)), true);
+    }
+  }
+};
+
+}  // namespace tiny_dlna
@@ -26,19 +26,19 @@ class HttpChunkReader : public HttpLineReader {
   }
 
   void open(Client &client) {
-    DlnaLogger.log(DlnaDebug, "HttpChunkReader %s", "open");
+    DLNA_LOG(DlnaDebug, "HttpChunkReader %s", "open");
     has_ended = false;
     readChunkLen(client);
   }
 
   // reads a block of data from the chunks
   virtual int read(Client &client, uint8_t *str, int len) {
-    DlnaLogger.log(DlnaDebug, "HttpChunkReader %s", "read");
+    DLNA_LOG(DlnaDebug, "HttpChunkReader %s", "read");
     if (has_ended && open_chunk_len == 0) return 0;
 
     // read the chunk data - but not more then available
     int read_max = len < open_chunk_len ? len : open_chunk_len;
-    int len_processed = client.read(str, read_max);
+    int len_processed = readBytes(client, str, read_max);
     // update current unprocessed chunk
     open_chunk_len -= len_processed;
 
@@ -54,7 +54,7 @@ class HttpChunkReader : public HttpLineReader {
   // reads a single line from the chunks
   virtual int readln(Client &client, uint8_t *str, int len,
                      bool incl_nl = true) {
-    DlnaLogger.log(DlnaDebug, "HttpChunkReader %s", "readln");
+    DLNA_LOG(DlnaDebug, "HttpChunkReader %s", "readln");
     if (has_ended && open_chunk_len == 0) return 0;
 
     int read_max = len < open_chunk_len ? len : open_chunk_len;
@@ -70,9 +70,12 @@ class HttpChunkReader : public HttpLineReader {
     return len_processed;
   }
 
+  /// Returns true if the final chunk has been received
+  bool isEnded() { return has_ended && open_chunk_len == 0; }
+
   int available() {
     int result = has_ended ? 0 : open_chunk_len;
-    DlnaLogger.log(DlnaDebug, "HttpChunkReader available=>%d", result);
+    DLNA_LOG(DlnaDebug, "HttpChunkReader available=>%d", result);
 
     return result;
   }
@@ -80,39 +83,39 @@ class HttpChunkReader : public HttpLineReader {
  protected:
   int open_chunk_len;
   bool has_ended = false;
-  HttpReplyHeader *http_heaer_ptr;
+  HttpReplyHeader *http_heaer_ptr = nullptr;
 
   void removeCRLF(Client &client) {
-    DlnaLogger.log(DlnaDebug, "HttpChunkReader %s", "removeCRLF");
+    DLNA_LOG(DlnaDebug, "HttpChunkReader %s", "removeCRLF");
     // remove traling CR LF from data
-    if (client.peek() == '\r') {
-      DlnaLogger.log(DlnaDebug, "HttpChunkReader %s", "removeCR");
-      client.read();
+    if (peekByte(client) == '\r') {
+      DLNA_LOG(DlnaDebug, "HttpChunkReader %s", "removeCR");
+      readByte(client);
     }
-    if (client.peek() == '\n') {
-      DlnaLogger.log(DlnaDebug, "HttpChunkReader %s", "removeLF");
-      client.read();
+    if (peekByte(client) == '\n') {
+      DLNA_LOG(DlnaDebug, "HttpChunkReader %s", "removeLF");
+      readByte(client);
     }
   }
 
   // we read the chunk length which is indicated as hex value
   virtual void readChunkLen(Client &client) {
-    DlnaLogger.log(DlnaDebug, "HttpChunkReader::readChunkLen");
-    uint8_t len_str[51];
-    readlnInternal(client, len_str, 50, false);
-    DlnaLogger.log(DlnaDebug, "HttpChunkReader::readChunkLen %s",
-                   (const char *)len_str);
-    DlnaLogger.log(DlnaDebug, "\n");
-    open_chunk_len = strtol((char *)len_str, nullptr, 16);
+    DLNA_LOG(DlnaDebug, "HttpChunkReader::readChunkLen");
+    const char *len_str = readLine(client);
+    // skip the CR LF of the last chunk if it was not available yet
+    while (len_str != nullptr && *len_str == 0) len_str = readLine(client);
+    if (len_str == nullptr) len_str = "0";
+    DLNA_LOG(DlnaDebug, "HttpChunkReader::readChunkLen %s", len_str);
+    open_chunk_len = strtol(len_str, nullptr, 16);
 
     char msg[40];
     sprintf(msg, "chunk_len: %d", open_chunk_len);
-    DlnaLogger.log(DlnaDebug, "HttpChunkReader::readChunkLen->%s", msg);
+    DLNA_LOG(DlnaDebug, "HttpChunkReader::readChunkLen->%s", msg);
 
     if (open_chunk_len == 0) {
       has_ended = true;
-      DlnaLogger.log(DlnaDebug, "HttpChunkReader::readChunkLen %s",
-                     "last chunk received");
+      DLNA_LOG(DlnaDebug, "HttpChunkReader::readChunkLen %s",
+               "last chunk received");
       // processing of additinal final headers after the chunk end
       if (http_heaer_ptr != nullptr) {
         http_heaer_ptr->readExt(client);
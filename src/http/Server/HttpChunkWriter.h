@@ -13,11 +13,11 @@ class HttpChunkWriter {
  public:
   int writeChunk(Client& client, const char* str, int len,
                  const char* str1 = nullptr, int len1 = 0) {
-    DlnaLogger.log(DlnaDebug, "HttpChunkWriter", "writeChunk");
+    DLNA_LOG(DlnaDebug, "HttpChunkWriter", "writeChunk");
     client.println(len + len1, HEX);
-    int result = client.write((uint8_t*)str, len);
+    int result = writeAll(client, str, len);
     if (str1 != nullptr) {
-      result += client.write((uint8_t*)str1, len1);
+      result += writeAll(client, str1, len1);
     }
     client.println();
     return result;
@@ -29,6 +29,27 @@ class HttpChunkWriter {
   }
 
   void writeEnd(Client& client) { writeChunk(client, "", 0); }
+
+ protected:
+  /// the chunk must be complete: so we retry short writes until there is no
+  /// progress for the timeout of the client
+  int writeAll(Client& client, const char* str, int len) {
+    int result = 0;
+    uint32_t last_progress = millis();
+    while (result < len && client.connected()) {
+      int n = client.write((uint8_t*)str + result, len - result);
+      if (n > 0) {
+        result += n;
+        last_progress = millis();
+      } else if (millis() - last_progress > client.getTimeout()) {
+        DLNA_LOG(DlnaError, "HttpChunkWriter: write timeout");
+        break;
+      } else {
+        delay(1);
+      }
+    }
+    return result;
+  }
 };
 
 }  // namespace tiny_dlna
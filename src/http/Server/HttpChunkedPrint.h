@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Client.h"
+#include "HttpChunkWriter.h"
+#include "Print.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief Print which writes each write() as a separate chunk with the
+ * HttpChunkWriter to the client, so use a BufferedPrint in front of it.
+ * end() writes the final empty chunk.
+ * @author Phil Schatzmann
+ */
+class HttpChunkedPrint : public Print {
+ public:
+  /// Defines the client
+  void setClient(Client& client) { p_client = &client; }
+
+  size_t write(uint8_t ch) override { return write(&ch, 1); }
+
+  size_t write(const uint8_t* data, size_t len) override {
+    if (p_client == nullptr || len == 0) return 0;
+    return chunk_writer.writeChunk(*p_client, (const char*)data, len);
+  }
+
+  /// Writes the final chunk and releases the client
+  void end() {
+    if (p_client == nullptr) return;
+    chunk_writer.writeEnd(*p_client);
+    p_client = nullptr;
+  }
+
+  /// Returns true if the final chunk is still pending
+  bool isActive() { return p_client != nullptr; }
+
+ protected:
+  Client* p_client = nullptr;
+  HttpChunkWriter chunk_writer;
+};
+
+}  // namespace tiny_dlna
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <WiFi.h>
+
+#include "basic/Logger.h"
+#include "basic/Vector.h"
+#include "http/Server/HttpLineReader.h"
+
+// max size of a request header
+#ifndef DLNA_HTTP_MAX_HEADER_SIZE
+#define DLNA_HTTP_MAX_HEADER_SIZE 2048
+#endif
+
+namespace tiny_dlna {
+
+/**
+ * @brief An open client connection of the HttpServer: the request header is
+ * collected without blocking until it is complete, so that the server can
+ * serve multiple connections in parallel. The data is received in blocks with
+ * a HttpLineReader: so the request data must be read with readBytes().
+ * @author Phil Schatzmann
+ */
+class HttpConnection {
+ public:
+  /// Starts to use the connection for the indicated client
+  void begin(WiFiClient& client) {
+    this->client = client;
+    is_open = true;
+    request_count = 0;
+    last_activity = millis();
+    header.clear();
+    reader.clear();
+  }
+
+  /// Reads the available data: returns true if the header is complete
+  bool readHeader() {
+    if (!is_open) return false;
+    if (client.available() > 0) last_activity = millis();
+    // the lines are only taken when the header is complete (or the buffer is
+    // full), so that we never wait for the rest of a line
+    while (reader.isHeaderAvailable(client)) {
+      const char* line = reader.readLine(client);
+      if (line == nullptr) break;
+      if (*line == 0) {
+        // ignore the line breaks between pipelined requests
+        if (header.size() == 0) continue;
+        header.push_back('\r');
+        header.push_back('\n');
+        header.push_back(0);
+        return true;
+      }
+      int len = strlen(line);
+      int size = header.size();
+      if (reader.isTruncated() ||
+          size + len + 2 >= DLNA_HTTP_MAX_HEADER_SIZE) {
+        return headerTooBig();
+      }
+      header.resize(size + len + 2);
+      memcpy(header.data() + size, line, len);
+      header[size + len] = '\r';
+      header[size + len + 1] = '\n';
+    }
+    // the buffered rest of the incomplete header is counted as well
+    if (header.size() + reader.buffered() >= DLNA_HTTP_MAX_HEADER_SIZE) {
+      return headerTooBig();
+    }
+    return false;
+  }
+
+  /// Reads the request data: the data which was received together with the
+  /// header is provided first
+  int readBytes(uint8_t* data, int len) {
+    int result = reader.readBytes(client, data, len);
+    if (result == 0 && len > 0) result = client.readBytes(data, len);
+    return result;
+  }
+
+  /// Provides the complete null terminated header
+  char* headerData() { return header.data(); }
+
+  /// Call after the header has been processed
+  void nextRequest() {
+    header.clear();
+    request_count++;
+    last_activity = millis();
+  }
+
+  /// Closes the connection
+  void close() {
+    if (is_open) client.stop();
+    is_open = false;
+    header.clear();
+    reader.clear();
+  }
+
+  bool isOpen() { return is_open; }
+
+  /// Returns true if the connection was closed by the client or if there was
+  /// no activity for the indicated time
+  bool isIdle(uint32_t timeoutMs) {
+    return !client.connected() || millis() - last_activity > timeoutMs;
+  }
+
+  /// Number of processed requests
+  int requestCount() { return request_count; }
+
+  /// Time of the last activity
+  uint32_t lastActivity() { return last_activity; }
+
+  WiFiClient& getClient() { return client; }
+
+ protected:
+  WiFiClient client;
+  Vector<char> header;
+  HttpLineReader reader{DLNA_HTTP_MAX_HEADER_SIZE};
+  bool is_open = false;
+  int request_count = 0;
+  uint32_t last_activity = 0;
+
+  bool headerTooBig() {
+    DLNA_LOG(DlnaWarning, "Request header too big");
+    close();
+    return false;
+  }
+};
+
+}  // namespace tiny_dlna
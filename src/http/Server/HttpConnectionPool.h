@@ -0,0 +1,157 @@
+#pragma once
+
+#include <WiFi.h>
+
+#include "basic/Logger.h"
+#include "basic/Str.h"
+#include "basic/Url.h"
+
+// max number of kept alive connections to the servers
+#ifndef DLNA_HTTP_POOL_SIZE
+#define DLNA_HTTP_POOL_SIZE 2
+#endif
+
+// time in ms after which an unused connection is closed
+#ifndef DLNA_HTTP_POOL_IDLE_TIMEOUT
+#define DLNA_HTTP_POOL_IDLE_TIMEOUT 10000
+#endif
+
+namespace tiny_dlna {
+
+/**
+ * @brief A connection of the HttpConnectionPool
+ */
+struct HttpPoolEntry {
+  WiFiClient client;
+  Str host;
+  uint16_t port = 0;
+  uint32_t last_used = 0;
+  bool in_use = false;
+};
+
+/**
+ * @brief Keep-alive connections to servers, so that subsequent requests to the
+ * same host and port do not need to open a new TCP connection. A connection
+ * is only reused if it is still connected, has not been idle for too long and
+ * does not have any unexpected data.
+ * @author Phil Schatzmann
+ */
+class HttpConnectionPool {
+ public:
+  /// Provides a connected client for the host: a healthy kept-alive
+  /// connection is reused, otherwise a new connection is opened. Returns
+  /// nullptr if this failed.
+  HttpPoolEntry* acquire(Url& url) {
+    return acquire(url.host(), url.port(),
+                   url.hasAddress() ? &url.address() : nullptr);
+  }
+
+  /// Provides a connected client for the host: if the address is defined we
+  /// connect w/o DNS lookup
+  HttpPoolEntry* acquire(const char* host, uint16_t port,
+                         IPAddress* p_address = nullptr) {
+    closeIdle();
+    for (auto& entry : entries) {
+      if (!entry.in_use && entry.port == port && entry.host.equals(host) &&
+          isHealthy(entry)) {
+        DLNA_LOG(DlnaDebug, "HttpConnectionPool: reusing %s:%d", host,
+                 port);
+        entry.in_use = true;
+        reuse_count++;
+        return &entry;
+      }
+    }
+
+    // use a free or the oldest unused connection
+    HttpPoolEntry* result = nullptr;
+    for (auto& entry : entries) {
+      if (entry.in_use) continue;
+      if (!entry.client.connected()) {
+        result = &entry;
+        break;
+      }
+      if (result == nullptr || entry.last_used < result->last_used) {
+        result = &entry;
+      }
+    }
+    if (result == nullptr) {
+      DLNA_LOG(DlnaError, "HttpConnectionPool: no free connection");
+      return nullptr;
+    }
+    result->client.stop();
+    DLNA_LOG(DlnaInfo, "HttpConnectionPool: connecting to %s:%d", host,
+             port);
+    int rc = p_address != nullptr ? result->client.connect(*p_address, port)
+                                  : result->client.connect(host, port);
+    if (!rc) {
+      DLNA_LOG(DlnaError, "HttpConnectionPool: connect failed");
+      result->port = 0;
+      return nullptr;
+    }
+    result->host = host;
+    result->port = port;
+    result->in_use = true;
+    connect_count++;
+    return result;
+  }
+
+  /// Gives the connection back: it is closed unless we keep it alive
+  void release(HttpPoolEntry* entry, bool keepAlive) {
+    if (entry == nullptr) return;
+    if (!keepAlive) {
+      entry->client.stop();
+      entry->port = 0;
+    }
+    entry->in_use = false;
+    entry->last_used = millis();
+  }
+
+  /// Closes the unused connections which have been idle for too long
+  void closeIdle() {
+    for (auto& entry : entries) {
+      if (!entry.in_use && entry.port != 0 &&
+          millis() - entry.last_used > idle_timeout) {
+        entry.client.stop();
+        entry.port = 0;
+      }
+    }
+  }
+
+  /// Closes all connections
+  void end() {
+    for (auto& entry : entries) {
+      entry.client.stop();
+      entry.in_use = false;
+      entry.port = 0;
+    }
+  }
+
+  /// Defines the time in ms after which an unused connection is closed
+  void setIdleTimeout(uint32_t ms) { idle_timeout = ms; }
+
+  /// Defines the timeout of the clients: this is also used for the connect
+  /// if the client supports it (e.g. the WiFiClient of the ESP32)
+  void setTimeout(int ms) {
+    for (auto& entry : entries) entry.client.setTimeout(ms);
+  }
+
+  /// Number of opened connections
+  uint32_t connectCount() { return connect_count; }
+
+  /// Number of requests which reused a connection
+  uint32_t reuseCount() { return reuse_count; }
+
+ protected:
+  HttpPoolEntry entries[DLNA_HTTP_POOL_SIZE];
+  uint32_t idle_timeout = DLNA_HTTP_POOL_IDLE_TIMEOUT;
+  uint32_t connect_count = 0;
+  uint32_t reuse_count = 0;
+
+  /// unexpected data (e.g. an error message) means that we can not reuse it
+  bool isHealthy(HttpPoolEntry& entry) {
+    return entry.client.connected() && entry.client.available() == 0 &&
+           millis() - entry.last_used <= idle_timeout;
+  }
+};
+
+}  // namespace tiny_dlna
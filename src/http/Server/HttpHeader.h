@@ -3,10 +3,19 @@
 // #include "Platform/AltClient.h"
 #include "HttpLineReader.h"
 #include "basic/Url.h"
-#include "basic/List.h"
 #include "basic/Logger.h"
 #include "basic/Str.h"
 
+// max number of header lines which can be stored
+#ifndef DLNA_HTTP_MAX_HEADER_LINES
+#define DLNA_HTTP_MAX_HEADER_LINES 24
+#endif
+
+// size of the buffer for the header keys and values
+#ifndef DLNA_HTTP_HEADER_ARENA_SIZE
+#define DLNA_HTTP_HEADER_ARENA_SIZE 1024
+#endif
+
 namespace tiny_dlna {
 
 // Class Configuration
@@ -29,7 +38,19 @@ const char* DEFAULT_AGENT =
 const char* HOST_C = "Host";
 const char* ACCEPT_ENCODING = "Accept-Encoding";
 const char* IDENTITY = "identity";
+const char* CONTENT_ENCODING = "Content-Encoding";
+const char* GZIP = "gzip";
 const char* LOCATION = "Location";
+const char* RANGE = "Range";
+const char* CONTENT_RANGE = "Content-Range";
+const char* ACCEPT_RANGES = "Accept-Ranges";
+const char* BYTES = "bytes";
+const char* PARTIAL_CONTENT = "Partial Content";
+const char* ETAG = "ETag";
+const char* IF_NONE_MATCH = "If-None-Match";
+const char* CACHE_CONTROL = "Cache-Control";
+const char* VARY = "Vary";
+const char* NOT_MODIFIED = "Not Modified";
 
 // Http methods
 enum TinyMethodID {
@@ -43,60 +64,78 @@ enum TinyMethodID {
   T_OPTIONS,
   T_CONNECT,
   T_PATCH,
-  T_SUBSCRIBE
+  T_SUBSCRIBE,
+  T_UNSUBSCRIBE,
+  T_NOTIFY
+};
+const char* methods[] = {"?",         "GET",         "HEAD",   "POST",
+                         "PUT",       "DELETE",      "TRACE",  "OPTIONS",
+                         "CONNECT",   "PATCH",       "SUBSCRIBE",
+                         "UNSUBSCRIBE", "NOTIFY",    nullptr};
+
+// Well known header keys: they are stored as id and not as string
+enum HttpHeaderID {
+  H_CUSTOM,
+  H_CONTENT_TYPE,
+  H_CONTENT_LENGTH,
+  H_CONNECTION,
+  H_TRANSFER_ENCODING,
+  H_ACCEPT,
+  H_USER_AGENT,
+  H_HOST,
+  H_ACCEPT_ENCODING,
+  H_CONTENT_ENCODING,
+  H_LOCATION,
+  H_RANGE,
+  H_CONTENT_RANGE
 };
-const char* methods[] = {"?",       "GET",    "HEAD",  "POST",
-                         "PUT",     "DELETE", "TRACE", "OPTIONS",
-                         "CONNECT", "PATCH", "SUBSCRIBE",  nullptr};
+const char* header_keys[] = {nullptr,          CONTENT_TYPE,     CONTENT_LENGTH,
+                             CONNECTION,       TRANSFER_ENCODING, ACCEPT,
+                             USER_AGENT,       HOST_C,           ACCEPT_ENCODING,
+                             CONTENT_ENCODING, LOCATION,         RANGE,
+                             CONTENT_RANGE,    nullptr};
 
 /**
- * @brief A individual key - value header line
- *
+ * @brief A individual key - value header line: the key (for custom headers)
+ * and the value are stored as offsets into the arena of the HttpHeader
  */
 struct HttpHeaderLine {
-  Str key;
-  Str value;
-  bool active;
+  uint8_t id = H_CUSTOM;
+  bool active = false;
+  uint16_t key = 0;
+  uint16_t value = 0;
 };
 
 /**
  * @brief In a http request and reply we need to process header information.
  * With this API we can define and query the header information. The individual
- * header lines are stored in a list. This is the common functionality for the
- * HttpRequest and HttpReplyHeader subclasses
+ * header lines are stored in a fixed table and the strings in a fixed arena,
+ * so that no memory is allocated and clear() just resets the fill levels.
+ * This is the common functionality for the HttpRequest and HttpReplyHeader
+ * subclasses
  *
  */
 class HttpHeader {
  public:
   HttpHeader() {
-    DlnaLogger.log(DlnaDebug, "HttpHeader");
+    DLNA_LOG(DlnaDebug, "HttpHeader");
     // set default values
     protocol_str = "HTTP/1.1";
     url_path = "/";
     status_msg = "";
   }
-  ~HttpHeader() {
-    DlnaLogger.log(DlnaDebug, "~HttpHeader");
-    clear(false);
-  }
+  ~HttpHeader() { DLNA_LOG(DlnaDebug, "~HttpHeader"); }
 
-  /// clears the data - usually we do not delete but we just set the active flag
+  /// clears the data: the flag is only kept for compatibility since there is
+  /// nothing to be released
   HttpHeader& clear(bool activeFlag = true) {
     is_written = false;
     is_chunked = false;
     url_path = "/";
-    for (auto it = lines.begin(); it != lines.end(); ++it) {
-      if (it != nullptr) {
-        if (activeFlag) {
-          (*it)->active = false;
-        } else {
-          delete *it;
-        }
-      }
-    }
-    if (!activeFlag) {
-      lines.clear();
-    }
+    line_count = 0;
+    // offset 0 is used for the empty string
+    arena[0] = 0;
+    arena_used = 1;
     return *this;
   }
 
@@ -104,23 +143,28 @@ class HttpHeader {
     if (value != nullptr) {
       HttpHeaderLine* hl = headerLine(key);
       if (hl == nullptr) {
-        DlnaLogger.log(DlnaError,
-                       "HttpHeader::put - did not add HttpHeaderLine for %s",
-                       key);
+        DLNA_LOG(DlnaError,
+                 "HttpHeader::put - did not add HttpHeaderLine for %s",
+                 key);
         return *this;
       }
 
       // log entry
-      DlnaLogger.log(DlnaDebug, "HttpHeader::put '%s' : %s", key, value);
-      hl->value = value;
+      DLNA_LOG(DlnaDebug, "HttpHeader::put '%s' : %s", key, value);
+      int offset = storeValue(*hl, value);
+      if (offset < 0) {
+        DLNA_LOG(DlnaError, "HttpHeader::put - arena full for %s", key);
+        return *this;
+      }
+      hl->value = offset;
       hl->active = true;
 
-      if (StrView(key) == TRANSFER_ENCODING && StrView(value) == CHUNKED) {
-        DlnaLogger.log(DlnaInfo, "HttpHeader::put -> is_chunked!!!");
+      if (hl->id == H_TRANSFER_ENCODING && StrView(value) == CHUNKED) {
+        DLNA_LOG(DlnaInfo, "HttpHeader::put -> is_chunked!!!");
         this->is_chunked = true;
       }
     } else {
-      DlnaLogger.log(
+      DLNA_LOG(
           DlnaInfo, "HttpHeader::put - value ignored because it is null for %s",
           key);
     }
@@ -129,25 +173,18 @@ class HttpHeader {
 
   /// adds a new line to the header - e.g. for content size
   HttpHeader& put(const char* key, int value) {
-    DlnaLogger.log(DlnaDebug, "HttpHeader::put %s %d", key, value);
-    HttpHeaderLine* hl = headerLine(key);
-
-    if (value > 1024) {
-      DlnaLogger.log(DlnaWarning, "value %d is > 1024 for %s", value, key);
-    }
-
-    // add value
-    hl->value = value;
-    hl->active = true;
-    DlnaLogger.log(DlnaInfo, "%s: %s", key, hl->value.c_str());
-    return *this;
+    DLNA_LOG(DlnaDebug, "HttpHeader::put %s %d", key, value);
+    char value_str[12];
+    snprintf(value_str, sizeof(value_str), "%d", value);
+    return put(key, (const char*)value_str);
   }
 
   /// adds a  received new line to the header
   HttpHeader& put(const char* line) {
-    DlnaLogger.log(DlnaDebug, "HttpHeader::put -> %s", (const char*)line);
+    DLNA_LOG(DlnaDebug, "HttpHeader::put -> %s", (const char*)line);
     StrView keyStr(line);
     int pos = keyStr.indexOf(":");
+    if (pos < 0) return *this;
     char* key = (char*)line;
     key[pos] = 0;
 
@@ -156,17 +193,29 @@ class HttpHeader {
     if (value[0] == ' ') {
       value = line + pos + 2;
     }
+    // remove trailing spaces from the key
+    while (pos > 0 && key[pos - 1] == ' ') key[--pos] = 0;
     return put((const char*)key, value);
   }
 
   // determines a header value with the key
   const char* get(const char* key) {
-    for (auto it = lines.begin(); it != lines.end(); ++it) {
-      HttpHeaderLine* line = *it;
-      line->key.trim();
-      if (line->key.equalsIgnoreCase(key)) {
-        const char* result = line->value.c_str();
-        return line->active ? result : nullptr;
+    HttpHeaderLine* line = find(key);
+    return line != nullptr && line->active ? arena + line->value : nullptr;
+  }
+
+  /// removes the header line with the key: it is not written any more
+  void remove(const char* key) {
+    HttpHeaderLine* line = find(key);
+    if (line != nullptr) line->active = false;
+  }
+
+  // determines a header value with the id of a well known key
+  const char* get(HttpHeaderID id) {
+    for (int j = 0; j < line_count; j++) {
+      HttpHeaderLine& line = lines[j];
+      if (line.id == id && id != H_CUSTOM) {
+        return line.active ? arena + line.value : nullptr;
       }
     }
     return nullptr;
@@ -174,44 +223,38 @@ class HttpHeader {
 
   // reads a single header line
   void readLine(Client& in, char* str, int len) {
-    reader.readlnInternal(in, (uint8_t*)str, len, false);
-    DlnaLogger.log(DlnaInfo, "HttpHeader::readLine -> %s", str);
+    p_reader->readlnInternal(in, (uint8_t*)str, len, false);
+    DLNA_LOG(DlnaInfo, "HttpHeader::readLine -> %s", str);
   }
 
   // writes a lingle header line
   void writeHeaderLine(Client& out, HttpHeaderLine* header) {
     if (header == nullptr) {
-      DlnaLogger.log(DlnaInfo, "HttpHeader::writeHeaderLine",
-                     "the value must not be null");
+      DLNA_LOG(DlnaInfo, "HttpHeader::writeHeaderLine",
+               "the value must not be null");
       return;
     }
     if (!header->active) {
-      DlnaLogger.log(DlnaInfo, "HttpHeader::writeHeaderLine %s - not active",
-                     header->key.c_str());
-      return;
-    }
-    if (header->value.c_str() == nullptr) {
-      DlnaLogger.log(
-          DlnaInfo,
-          "HttpHeader::writeHeaderLine - ignored because value is null");
+      DLNA_LOG(DlnaInfo, "HttpHeader::writeHeaderLine %s - not active",
+               key(*header));
       return;
     }
 
     char msg[400];
     StrView msg_str(msg, 400);
-    msg_str = header->key.c_str();
+    msg_str = key(*header);
     msg_str += ": ";
-    msg_str += header->value.c_str();
+    msg_str += arena + header->value;
     msg_str += CRLF;
     out.print(msg);
 
     // remove crlf from log
     int len = strnlen(msg, 200);
     msg[len - 2] = 0;
-    DlnaLogger.log(DlnaInfo, "writeHeaderLine -> %s", msg);
+    DLNA_LOG(DlnaInfo, "writeHeaderLine -> %s", msg);
 
     // marke as processed
-    header->active = false;
+    if (is_write_once) header->active = false;
   }
 
   const char* urlPath() { return url_path.c_str(); }
@@ -233,43 +276,82 @@ class HttpHeader {
 
   // reads the full header from the request (stream)
   void read(Client& in) {
-    DlnaLogger.log(DlnaInfo, "HttpHeader::read");
+    DLNA_LOG(DlnaInfo, "HttpHeader::read");
     // remove all existing value
     clear();
+    status_code = T_UNDEFINED;
 
-    char line[MaxHeaderLineLength];
-    if (in.connected()) {
-      delay(200);
-      if (in.available() == 0) {
-        DlnaLogger.log(DlnaWarning, "Waiting for data...");
-        uint64_t end = millis() + in.getTimeout();
-        while (in.available() == 0) {
-          delay(100);
-          if (millis()>end) break;
-        }
+    if (in.connected() || p_reader->buffered() > 0) {
+      if (in.available() == 0 && p_reader->buffered() == 0) {
+        DLNA_LOG(DlnaWarning, "Waiting for data...");
+        waitForData(in);
       }
-      readLine(in, line, MaxHeaderLineLength);
+      const char* line = p_reader->readLine(in);
+      if (line == nullptr) return;
       parse1stLine(line);
-      while (in.available()) {
-        readLine(in, line, MaxHeaderLineLength);
-        StrView lineStr(line);
-        if (lineStr.isEmpty() || lineStr.isNewLine()) {
+      // the header might arrive in multiple segments
+      while (p_reader->buffered() > 0 || waitForData(in)) {
+        line = p_reader->readLine(in);
+        if (line == nullptr || *line == 0) {
           break;
         }
-        if (isValidStatus() || isRedirectStatus()) {
-          lineStr.ltrim();
+        // requests have no status
+        if (status_code == T_UNDEFINED || isValidStatus() ||
+            isRedirectStatus()) {
+          // skip leading spaces: the line is modified by put()
+          while (*line == ' ') line++;
           put(line);
         }
       }
     }
   }
 
+  /// parses the full header from the indicated null terminated data (e.g.
+  /// collected by a HttpConnection): the data is modified
+  void parse(char* data) {
+    DLNA_LOG(DlnaInfo, "HttpHeader::parse");
+    clear();
+    bool is_first = true;
+    char* line = data;
+    while (line != nullptr && *line != 0) {
+      char* next = strchr(line, '\n');
+      if (next != nullptr) {
+        *next = 0;
+        if (next > line && next[-1] == '\r') next[-1] = 0;
+        next++;
+      }
+      StrView lineStr(line);
+      if (is_first) {
+        parse1stLine(line);
+        is_first = false;
+      } else if (lineStr.isEmpty()) {
+        break;
+      } else if ((status_code == T_UNDEFINED || isValidStatus() ||
+                  isRedirectStatus()) &&
+                 lineStr.contains(":")) {
+        lineStr.ltrim();
+        put(line);
+      }
+      line = next;
+    }
+  }
+
+  /// waits until data is available or the timeout of the client has expired
+  bool waitForData(Client& in) {
+    uint64_t end = millis() + in.getTimeout();
+    while (in.available() == 0) {
+      if (!in.connected() || millis() > end) return false;
+      delay(10);
+    }
+    return true;
+  }
+
   // writes the full header to the indicated HttpStreamedMultiOutput stream
   void write(Client& out) {
-    DlnaLogger.log(DlnaInfo, "HttpHeader::write");
+    DLNA_LOG(DlnaInfo, "HttpHeader::write");
     write1stLine(out);
-    for (auto it = lines.begin(); it != lines.end(); ++it) {
-      writeHeaderLine(out, *it);
+    for (int j = 0; j < line_count; j++) {
+      writeHeaderLine(out, &lines[j]);
     }
     // print empty line
     crlf(out);
@@ -277,6 +359,17 @@ class HttpHeader {
     is_written = true;
   }
 
+  /// Defines the reader which buffers the received data: use the same reader
+  /// for the header and the content
+  void setLineReader(HttpLineReader& reader) { p_reader = &reader; }
+
+  /// Provides the reader which buffers the received data
+  HttpLineReader& lineReader() { return *p_reader; }
+
+  /// By default the lines are only written once: deactivate this if the
+  /// same header needs to be written again (e.g. to repeat a request)
+  void setWriteOnce(bool flag) { is_write_once = flag; }
+
   // automatically create new lines
   void setAutoCreateLines(bool is_auto_line) {
     create_new_lines = is_auto_line;
@@ -291,6 +384,7 @@ class HttpHeader {
   bool is_written = false;
   bool is_chunked = false;
   bool create_new_lines = true;
+  bool is_write_once = true;
   TinyMethodID method_id;
   // we store the values on the heap. this is acceptable because we just have
   // one instance for the requests and one for the replys: which needs about
@@ -298,40 +392,142 @@ class HttpHeader {
   Str protocol_str = Str(10);
   Str url_path = Str(70);
   Str status_msg = Str(20);
-  List<HttpHeaderLine*> lines;
+  HttpHeaderLine lines[DLNA_HTTP_MAX_HEADER_LINES];
+  int line_count = 0;
+  char arena[DLNA_HTTP_HEADER_ARENA_SIZE] = {0};
+  int arena_used = 1;
   HttpLineReader reader;
+  HttpLineReader* p_reader = &reader;
   const char* CRLF = "\r\n";
 
   // the headers need to delimited with CR LF
   void crlf(Client& out) {
     out.print(CRLF);
-    DlnaLogger.log(DlnaInfo, " -> %s", "<CR LF>");
+    DLNA_LOG(DlnaInfo, " -> %s", "<CR LF>");
+  }
+
+  /// copies the string into the arena: returns the offset or -1 if it is full
+  int store(const char* str) {
+    int len = strlen(str) + 1;
+    if (arena_used + len > DLNA_HTTP_HEADER_ARENA_SIZE) return -1;
+    int result = arena_used;
+    memmove(arena + result, str, len);
+    arena_used += len;
+    return result;
+  }
+
+  /// stores the value of a line: the memory of the old value is reused if the
+  /// new value fits or if it is the last entry in the arena. If the arena is
+  /// full we compact it (unless the value itself is stored in the arena).
+  int storeValue(HttpHeaderLine& line, const char* value) {
+    int len = strlen(value);
+    if (line.value > 0 && len <= (int)strlen(arena + line.value)) {
+      memmove(arena + line.value, value, len + 1);
+      return line.value;
+    }
+    bool is_arena_value =
+        value >= arena && value < arena + DLNA_HTTP_HEADER_ARENA_SIZE;
+    if (arena_used + len + 1 > DLNA_HTTP_HEADER_ARENA_SIZE && !is_arena_value) {
+      compactArena();
+    }
+    // replace the old value at the end of the arena if the new one fits
+    if (line.value > 0 &&
+        line.value + (int)strlen(arena + line.value) + 1 == arena_used &&
+        line.value + len + 1 <= DLNA_HTTP_HEADER_ARENA_SIZE) {
+      arena_used = line.value;
+    }
+    return store(value);
+  }
+
+  /// removes the unused memory between the strings of the arena: this moves
+  /// the strings, so the pointers provided by get() are not valid any more
+  void compactArena() {
+    uint16_t* refs[DLNA_HTTP_MAX_HEADER_LINES * 2];
+    int count = 0;
+    for (int j = 0; j < line_count; j++) {
+      HttpHeaderLine& line = lines[j];
+      if (line.id == H_CUSTOM && line.key > 0) refs[count++] = &line.key;
+      if (line.value > 0) refs[count++] = &line.value;
+    }
+    // sort by offset: the strings are only moved down
+    for (int j = 1; j < count; j++) {
+      uint16_t* ref = refs[j];
+      int k = j - 1;
+      while (k >= 0 && *refs[k] > *ref) {
+        refs[k + 1] = refs[k];
+        k--;
+      }
+      refs[k + 1] = ref;
+    }
+    int pos = 1;
+    for (int j = 0; j < count; j++) {
+      int len = strlen(arena + *refs[j]) + 1;
+      if (*refs[j] != pos) memmove(arena + pos, arena + *refs[j], len);
+      *refs[j] = pos;
+      pos += len;
+    }
+    DLNA_LOG(DlnaDebug, "HttpHeader::compactArena %d -> %d", arena_used, pos);
+    arena_used = pos;
+  }
+
+  /// determines the id of a well known key
+  HttpHeaderID headerID(const char* key) {
+    for (int j = 1; header_keys[j] != nullptr; j++) {
+      if (strcasecmp(header_keys[j], key) == 0) return (HttpHeaderID)j;
+    }
+    return H_CUSTOM;
+  }
+
+  /// provides the key of the line
+  const char* key(HttpHeaderLine& line) {
+    return line.id == H_CUSTOM ? arena + line.key : header_keys[line.id];
+  }
+
+  /// finds the line with the indicated key
+  HttpHeaderLine* find(const char* key) {
+    if (key == nullptr) return nullptr;
+    HttpHeaderID id = headerID(key);
+    for (int j = 0; j < line_count; j++) {
+      HttpHeaderLine& line = lines[j];
+      if (line.id != id) continue;
+      if (id != H_CUSTOM || strcasecmp(arena + line.key, key) == 0) {
+        return &line;
+      }
+    }
+    return nullptr;
   }
 
   // gets or creates a header line by key
   HttpHeaderLine* headerLine(const char* key) {
     if (key != nullptr) {
-      for (auto it = lines.begin(); it != lines.end(); ++it) {
-        HttpHeaderLine* pt = (*it);
-        if (pt != nullptr && pt->key.c_str() != nullptr) {
-          if (pt->key.equalsIgnoreCase(key)) {
-            pt->active = true;
-            return pt;
+      HttpHeaderLine* pt = find(key);
+      if (pt != nullptr) {
+        pt->active = true;
+        return pt;
+      }
+      if (create_new_lines && line_count < DLNA_HTTP_MAX_HEADER_LINES) {
+        HttpHeaderLine& newLine = lines[line_count];
+        newLine.id = headerID(key);
+        newLine.key = 0;
+        newLine.value = 0;
+        if (newLine.id == H_CUSTOM) {
+          int offset = store(key);
+          if (offset < 0) {
+            compactArena();
+            offset = store(key);
           }
+          if (offset < 0) return nullptr;
+          newLine.key = offset;
         }
-      }
-      if (create_new_lines) {
-        HttpHeaderLine* newLine = new HttpHeaderLine();
-        DlnaLogger.log(DlnaDebug,
-                       "HttpHeader::headerLine - new line created for %s", key);
-        newLine->active = true;
-        newLine->key = key;
-        lines.push_back(newLine);
-        return newLine;
+        DLNA_LOG(DlnaDebug,
+                 "HttpHeader::headerLine - new line created for %s", key);
+        newLine.active = true;
+        line_count++;
+        return &newLine;
       }
     } else {
-      DlnaLogger.log(DlnaError, "HttpHeader::headerLine",
-                     "The key must not be null");
+      DLNA_LOG(DlnaError, "HttpHeader::headerLine",
+               "The key must not be null");
     }
     return nullptr;
   }
@@ -358,20 +554,69 @@ class HttpHeader {
  */
 class HttpRequestHeader : public HttpHeader {
  public:
+  /// Returns true if the method can be repeated w/o any additional effect
+  /// (RFC 9110 9.2.2): e.g. a POST might already have been executed.
+  static bool isIdempotent(TinyMethodID id) {
+    switch (id) {
+      case T_GET:
+      case T_HEAD:
+      case T_PUT:
+      case T_DELETE:
+      case T_OPTIONS:
+      case T_TRACE:
+      case T_UNSUBSCRIBE:
+        return true;
+      default:
+        return false;
+    }
+  }
+
   // Defines the action id, url path and http version for an request
   HttpHeader& setValues(TinyMethodID id, const char* urlPath,
                         const char* protocol = nullptr) {
     this->method_id = id;
     this->url_path = urlPath;
 
-    DlnaLogger.log(DlnaInfo, "HttpRequestHeader::setValues - path: %s",
-                   this->url_path.c_str());
+    DLNA_LOG(DlnaInfo, "HttpRequestHeader::setValues - path: %s",
+             this->url_path.c_str());
     if (protocol != nullptr) {
       this->protocol_str = protocol;
     }
     return *this;
   }
 
+  /// Determines the requested byte range (Range: bytes=start-end) for content
+  /// of the indicated size: returns 0 if there is no supported range, 1 if the
+  /// range is valid and -1 if it can not be satisfied. Multiple ranges are not
+  /// supported, so we provide the full content for them. A syntactically
+  /// invalid range (e.g. bytes=5-3) is ignored as required by RFC 9110.
+  int range(int size, int& start, int& end) {
+    const char* value = get(H_RANGE);
+    if (value == nullptr || strncasecmp(value, "bytes=", 6) != 0) return 0;
+    value += 6;
+    const char* dash = strchr(value, '-');
+    if (dash == nullptr || strchr(value, ',') != nullptr) return 0;
+    bool has_end = dash[1] != 0;
+    if (has_end && !isdigit(dash[1])) return 0;
+    if (dash == value) {
+      // suffix range: the last n bytes
+      if (!has_end) return 0;
+      int suffix = atoi(dash + 1);
+      if (suffix <= 0) return -1;
+      start = size > suffix ? size - suffix : 0;
+      end = size - 1;
+      return 1;
+    }
+    if (!isdigit(value[0])) return 0;
+    int first = atoi(value);
+    int last = has_end ? atoi(dash + 1) : size - 1;
+    if (has_end && last < first) return 0;
+    if (first >= size) return -1;
+    start = first;
+    end = last >= size ? size - 1 : last;
+    return 1;
+  }
+
   // action path protocol
   void write1stLine(Client& out) {
     char msg[201] = {0};
@@ -384,13 +629,13 @@ class HttpRequestHeader : public HttpHeader {
     strncat(msg, this->protocol_str.c_str(), 200);
     strncat(msg, CRLF, 200);
     out.print(msg);
-    DlnaLogger.log(DlnaInfo, "HttpRequestHeader::write1stLine:  %s", msg);
+    DLNA_LOG(DlnaInfo, "HttpRequestHeader::write1stLine:  %s", msg);
   }
 
   // parses the requestline
   // Request-Line = Method SP Request-URI SP HTTP-Version CRLF
   void parse1stLine(const char* line) {
-    DlnaLogger.log(DlnaInfo, "HttpRequestHeader::parse1stLine %s", line);
+    DLNA_LOG(DlnaInfo, "HttpRequestHeader::parse1stLine %s", line);
     StrView line_str(line);
     int space1 = line_str.indexOf(" ");
     int space2 = line_str.indexOf(" ", space1 + 1);
@@ -400,9 +645,9 @@ class HttpRequestHeader : public HttpHeader {
     this->url_path.substring(line_str, space1 + 1, space2);
     this->url_path.trim();
 
-    DlnaLogger.log(DlnaInfo, "->method: %s", methods[this->method_id]);
-    DlnaLogger.log(DlnaInfo, "->protocol: %s", protocol_str.c_str());
-    DlnaLogger.log(DlnaInfo, "->url_path: %s", url_path.c_str());
+    DLNA_LOG(DlnaInfo, "->method: %s", methods[this->method_id]);
+    DLNA_LOG(DlnaInfo, "->protocol: %s", protocol_str.c_str());
+    DLNA_LOG(DlnaInfo, "->url_path: %s", url_path.c_str());
   }
 };
 
@@ -415,7 +660,7 @@ class HttpReplyHeader : public HttpHeader {
   // defines the values for the rely
   void setValues(int statusCode, const char* msg = "",
                  const char* protocol = nullptr) {
-    DlnaLogger.log(DlnaInfo, "HttpReplyHeader::setValues %d", statusCode);
+    DLNA_LOG(DlnaInfo, "HttpReplyHeader::setValues %d", statusCode);
     status_msg = msg;
     status_code = statusCode;
     if (protocol != nullptr) {
@@ -425,7 +670,7 @@ class HttpReplyHeader : public HttpHeader {
 
   // reads the final chunked reply headers
   void readExt(Client& in) {
-    DlnaLogger.log(DlnaInfo, "HttpReplyHeader::readExt");
+    DLNA_LOG(DlnaInfo, "HttpReplyHeader::readExt");
     char line[MaxHeaderLineLength];
     readLine(in, line, MaxHeaderLineLength);
     while (strlen(line) != 0) {
@@ -443,7 +688,7 @@ class HttpReplyHeader : public HttpHeader {
     msg_str += this->status_code;
     msg_str += " ";
     msg_str += this->status_msg.c_str();
-    DlnaLogger.log(DlnaInfo, "HttpReplyHeader::write1stLine: %s", msg);
+    DLNA_LOG(DlnaInfo, "HttpReplyHeader::write1stLine: %s", msg);
     out.print(msg);
     crlf(out);
   }
@@ -452,7 +697,7 @@ class HttpReplyHeader : public HttpHeader {
   // we just update the pointers to point to the correct position in the
   // http_status_line
   void parse1stLine(const char* line) {
-    DlnaLogger.log(DlnaInfo, "HttpReplyHeader::parse1stLine %s", line);
+    DLNA_LOG(DlnaInfo, "HttpReplyHeader::parse1stLine %s", line);
     StrView line_str(line);
     int space1 = line_str.indexOf(' ', 0);
     int space2 = line_str.indexOf(' ', space1 + 1);
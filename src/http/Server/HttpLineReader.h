@@ -1,82 +1,221 @@
 #pragma once
 
 #include "basic/Logger.h"
+#include "basic/RingBuffer.h"
+#include "basic/Vector.h"
+
+// size of the buffer for the received data: this is also the max line length
+#ifndef DLNA_HTTP_LINE_BUFFER_SIZE
+#define DLNA_HTTP_LINE_BUFFER_SIZE 512
+#endif
+
+// max time in ms to wait for the (rest of a) line
+#ifndef DLNA_HTTP_LINE_TIMEOUT
+#define DLNA_HTTP_LINE_TIMEOUT 60
+#endif
 
 namespace tiny_dlna {
 
 /**
  * @brief We read a single line. A terminating 0 is added to the string to make
  * it compliant for c string functions.
+ * The data is read in blocks into a ring buffer, so that we do not need to
+ * call client.read() for each character. Because the data after the line
+ * might already be buffered, any further data must be read with readBytes(),
+ * readByte() or peekByte() and not directly from the client.
  *
  */
 
 class HttpLineReader {
  public:
-  HttpLineReader() {}
+  HttpLineReader(int size = DLNA_HTTP_LINE_BUFFER_SIZE) : ring(0) {
+    buffer_size = size;
+  }
+
+  /// Provides the next line w/o CR LF or nullptr if there is no data: the
+  /// result is valid until the next call. Optionally provides the number of
+  /// characters that were consumed including the CR LF. A line which does not
+  /// fit into the buffer is cut off: the rest up to the CR LF is discarded
+  /// and isTruncated() is true.
+  const char* readLine(Stream& client, int* consumed = nullptr) {
+    int pos = fill(client);
+    int len = pos >= 0 ? pos + 1 : ring.available();
+    is_truncated = pos < 0 && ring.availableToWrite() == 0;
+    if (consumed != nullptr) *consumed = len;
+    if (len == 0) return nullptr;
+    if (is_truncated) {
+      DLNA_LOG(DlnaError, "Line cut off after %d chars", len);
+    }
+
+    int linear = 0;
+    char* result = ring.readPtr(linear);
+    if (pos >= 0 && len <= linear) {
+      // we can provide the line directly from the buffer
+      result[pos] = 0;
+    } else {
+      // the line is wrapped or not terminated: we need to copy it
+      line.resize(len + 1);
+      ring.read((uint8_t*)line.data(), len);
+      line[len] = 0;
+      if (pos >= 0) line[pos] = 0;
+      result = line.data();
+      len = 0;
+    }
+    ring.advanceRead(len);
+    // remove cr
+    if (pos > 0 && result[pos - 1] == '\r') result[pos - 1] = 0;
+    if (is_truncated) {
+      int discarded = discardLine(client);
+      if (consumed != nullptr) *consumed += discarded;
+    }
+    return result;
+  }
+
+  /// Returns true if the last line of readLine() was longer than the buffer
+  bool isTruncated() { return is_truncated; }
+
   // reads up the the next CR LF - but never more then the indicated len.
   // returns the number of characters read including crlf
   virtual int readlnInternal(Stream& client, uint8_t* str, int len,
                              bool incl_nl = true) {
+    DLNA_LOG(DlnaDebug, "HttpLineReader", "readlnInternal");
     int result = 0;
-    DlnaLogger.log(DlnaDebug, "HttpLineReader", "readlnInternal");
-    int count = 0;
-    // wait for first character
-    for (int w = 0; w < 20 && client.available() == 0; w++) {
-      delay(10);
-      if (count++ > 5) break;
-    }
+    const char* line = readLine(client, &result);
     // if we do not have any data we stop
-    if (client.available() == 0) {
-      DlnaLogger.log(DlnaWarning, "HttpLineReader", "readlnInternal->no Data");
-      str[0] = 0;
+    if (line == nullptr || len <= 0) {
+      DLNA_LOG(DlnaWarning, "HttpLineReader", "readlnInternal->no Data");
+      if (len > 0) str[0] = 0;
       return 0;
     }
+    int max = incl_nl ? len - 2 : len - 1;
+    int line_len = strlen(line);
+    if (line_len > max) {
+      DLNA_LOG(DlnaError, "Line cut off:", line);
+      line_len = max < 0 ? 0 : max;
+    }
+    memcpy(str, line, line_len);
+    if (incl_nl && max >= 0) str[line_len++] = '\n';
+    str[line_len] = 0;
+    return result;
+  }
+
+  /// Reads the buffered data and then the data that is available from the
+  /// client
+  int readBytes(Stream& client, uint8_t* data, int len) {
+    int result = ring.read(data, len);
+    if (result < len) {
+      int available = client.available();
+      int n = len - result < available ? len - result : available;
+      if (n > 0) result += client.readBytes(data + result, n);
+    }
+    return result;
+  }
+
+  /// Reads a single character
+  int readByte(Stream& client) {
+    return ring.available() > 0 ? ring.read() : client.read();
+  }
+
+  /// Provides the next character w/o removing it
+  int peekByte(Stream& client) {
+    return ring.available() > 0 ? ring.peek() : client.peek();
+  }
+
+  /// Reads the data which is available w/o waiting: returns true if the
+  /// buffered data contains a complete header (up to the empty line) or if
+  /// the buffer is full, so that the header can be read w/o blocking
+  bool isHeaderAvailable(Stream& client) {
+    allocate();
+    while (client.available() > 0 && ring.availableToWrite() > 0) {
+      int space = 0;
+      char* data = ring.writePtr(space);
+      int n = client.available() < space ? client.available() : space;
+      ring.advanceWrite(client.readBytes(data, n));
+    }
+    if (ring.availableToWrite() == 0) return true;
+    int start = 0;
+    for (int pos = ring.indexOf('\n'); pos >= 0;
+         pos = ring.indexOf('\n', start)) {
+      int len = pos - start;
+      if (len == 0 || (len == 1 && charAt(start) == '\r')) return true;
+      start = pos + 1;
+    }
+    return false;
+  }
+
+  /// Number of characters which have been read from the client but not
+  /// consumed yet
+  int buffered() { return ring.available(); }
+
+  /// Removes the buffered data: e.g. for a new connection
+  void clear() { ring.clear(); }
+
+  /// Defines the max time in ms to wait for a line
+  void setTimeout(uint32_t ms) { timeout = ms; }
+
+ protected:
+  RingBuffer ring;
+  Vector<char> line;
+  uint32_t timeout = DLNA_HTTP_LINE_TIMEOUT;
+  int buffer_size;
+  bool is_allocated = false;
+  bool is_truncated = false;
+
+  /// the buffer is only allocated when it is used
+  void allocate() {
+    if (is_allocated) return;
+    ring.resize(buffer_size);
+    is_allocated = true;
+  }
+
+  /// provides the buffered character at the offset
+  int charAt(int offset) {
+    int len = 0;
+    char* data = ring.peekPtr(offset, len);
+    return len > 0 ? *data : -1;
+  }
 
-    // process characters until we find a new line
-    bool is_buffer_owerflow = false;
-    int j = 0;
+  /// removes the data up to and including the next new line (up to the
+  /// timeout): returns the number of removed characters
+  int discardLine(Stream& client) {
+    int result = 0;
     while (true) {
-      int c = client.read();
-      if (c == -1) {
-        break;
+      int pos = fill(client);
+      if (pos >= 0) {
+        ring.advanceRead(pos + 1);
+        return result + pos + 1;
       }
+      bool is_full = ring.availableToWrite() == 0;
+      result += ring.available();
+      ring.clear();
+      // no new line within the timeout
+      if (!is_full) return result;
+    }
+  }
 
-      if (j < len) {
-        result++;
-      } else {
-        is_buffer_owerflow = true;
-      }
-      if (c == '\n') {
-        if (incl_nl) {
-          str[j] = c;
-          break;
-        } else {
-          // remove cl lf
-          if (j >= 1) {
-            if (str[j - 1] == '\r') {
-              // remove cr
-              str[j - 1] = 0;
-              break;
-              ;
-            } else {
-              // remove nl
-              str[j] = 0;
-              break;
-            }
-          }
-        }
-      }
-      if (!is_buffer_owerflow) {
-        str[j] = c;
+  /// reads blocks until we have a full line in the buffer: returns the
+  /// position of the new line or -1
+  int fill(Stream& client) {
+    allocate();
+    uint32_t end = millis() + timeout;
+    // offset up to which we have searched for the new line
+    int scan_pos = 0;
+    while (true) {
+      int pos = ring.indexOf('\n', scan_pos);
+      if (pos >= 0 || ring.availableToWrite() == 0) return pos;
+      scan_pos = ring.available();
+      int available = client.available();
+      if (available > 0) {
+        int space = 0;
+        char* data = ring.writePtr(space);
+        int n = available < space ? available : space;
+        ring.advanceWrite(client.readBytes(data, n));
+        continue;
       }
-      j++;
+      // wait for the rest of the line
+      if (millis() > end) return -1;
+      delay(1);
     }
-    str[result] = 0;
-    str[result - 1] = 0;
-    if (is_buffer_owerflow) {
-      DlnaLogger.log(DlnaError, "Line cut off:", (const char*)str);
-    }
-    return result;
   }
 };
 
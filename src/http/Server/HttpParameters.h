@@ -13,154 +13,208 @@ namespace tiny_dlna {
 /**
  * @brief API for http parameters: key=value&key1=value1
  *
+ * The data is read into one receive buffer which is percent-decoded in place:
+ * the keys and values are stored as null terminated strings in this buffer
+ * and the parameters are indexed by their offsets. The buffer and the index
+ * are kept for reuse, so that we do not need any allocation for each key.
+ *
+ * For big POST bodies you can use the streaming mode with a callback, which
+ * only needs a buffer of max_len for the actual parameter.
+ * @author Phil Schatzmann
  */
 class HttpParameters {
+  /// offsets of the key and value in the buffer
   struct HttpParameterEntry {
-    HttpParameterEntry() = default;
-    Str key = nullptr;
-    Str value = nullptr;
-    void clear() {
-      key.clear();
-      value.clear();
-    }
+    int key = 0;
+    int value = 0;
   };
 
  public:
-  /// Default Constructor
+  /// Key and value of a parameter: they refer to the receive buffer
+  struct HttpParameter {
+    StrView key;
+    StrView value;
+  };
+
+  /// Default Constructor: maxLen is the max length of a parameter in the
+  /// streaming mode and the initial size of the receive buffer
   HttpParameters(const int maxLen = 256) { max_len = maxLen; };
 
-  /// Destructor
-  ~HttpParameters() { clear(); }
+  /// Constructor which takes the memory from the indicated allocator: e.g.
+  /// the requestAllocator() of the HttpServer in a request handler
+  HttpParameters(Allocator &allocator, const int maxLen = 256)
+      : HttpParameters(maxLen) {
+    setAllocator(allocator);
+  }
+
+  /// Defines the allocator of the buffers: call before parsing
+  void setAllocator(Allocator &allocator) {
+    buffer.setAllocator(allocator);
+    stream_buffer.setAllocator(allocator);
+    entries.setAllocator(allocator);
+  }
 
   /// Parses the parameters in the client stream
   void parse(Stream &in) {
-    char buffer[max_len];
+    clear();
+    buffer.reserve(max_len);
+    int len = 0;
     while (in.available() > 0) {
-      memset(buffer, 0, max_len);
-      in.readBytesUntil('&', buffer, max_len);
-      StrView str(buffer);
-      DlnaLogger.log(DlnaInfo, "parameter: %s", buffer);
-      urldecode2(buffer, buffer);
-      DlnaLogger.log(DlnaInfo, "parameter decoded: %s", buffer);
-      int pos = str.indexOf("=");
-      if (pos > 0) {
-        buffer[pos] = 0;  // delimit key
-        const char *key = buffer;
-        const char *value = buffer + pos + 1;
-        DlnaLogger.log(DlnaDebug, "key: %s", key);
-        DlnaLogger.log(DlnaDebug, "value: %s", value);
-        HttpParameterEntry *entry = getParameter(key);
-        if (entry != nullptr) {
-          entry->value = value;
-        } else {
-          entry = new HttpParameterEntry();
-          entry->key = key;
-          entry->value = value;
-          parameters.push_back(entry);
-        }
-      }
+      int available = in.available();
+      buffer.resize(len + available);
+      len += in.readBytes(buffer.data() + len, available);
     }
+    index(len);
   }
 
-  /// Parses the parameters in the client stream and provides the result via a
-  /// callback method
+  /// Parses the parameters from a string (e.g. the query of an url)
+  void parse(const char *str) {
+    clear();
+    if (str == nullptr) return;
+    int len = strlen(str);
+    buffer.resize(len);
+    memcpy(buffer.data(), str, len);
+    index(len);
+  }
+
+  /// Streaming mode: parses the parameters in the client stream and provides
+  /// the result via a callback method w/o storing them.
   void parse(Stream &in, void (*callback)(const char *key, const char *value)) {
-    char buffer[max_len];
+    stream_buffer.resize(max_len);
+    char *data = stream_buffer.data();
     while (in.available() > 0) {
-      memset(buffer, 0, max_len);
-      in.readBytesUntil('&', buffer, max_len);
-      StrView str(buffer);
-      DlnaLogger.log(DlnaInfo, "parameter: %s", buffer);
-      urldecode2(buffer, buffer);
-      DlnaLogger.log(DlnaInfo, "parameter decoded: %s", buffer);
-      int pos = str.indexOf("=");
-      if (pos > 0) {
-        buffer[pos] = 0;  // delimit key
-        const char *key = buffer;
-        const char *value = buffer + pos + 1;
-        callback(key, value);
+      int len = in.readBytesUntil('&', data, max_len - 1);
+      if (len == max_len - 1 && in.available() > 0 && in.peek() != '&') {
+        DLNA_LOG(DlnaError, "parameter too long: > %d", max_len - 1);
+        // ignore the rest of the parameter
+        while (in.available() > 0 && in.read() != '&');
+        continue;
       }
+      // readBytesUntil does not consume the terminator if the buffer is full
+      if (len == max_len - 1 && in.available() > 0) in.read();
+      data[len] = 0;
+      DLNA_LOG(DlnaDebug, "parameter: %s", data);
+      int value = split(data, len);
+      if (value > 0) callback(data, data + value);
     }
   }
 
-  /// Checks if the parameter exists
-  bool hasKey(const char *key) {
-    for (auto &entry : parameters) {
-      if (entry->key.equals(key)) {
-        return true;
-      }
-    }
-    return false;
-  }
+  /// Number of parameters
+  int size() { return entries.size(); }
 
-  /// Returns a HttpParameterEntry for a parameter id
-  HttpParameterEntry *getParameter(const char *key) {
-    for (auto &entry : parameters) {
-      if (entry->key.equals(key)) {
-        return entry;
-      }
-    }
-    return nullptr;
+  /// Provides the key of the parameter at the indicated index
+  const char *getKey(int idx) { return buffer.data() + entries[idx].key; }
+
+  /// Provides the value of the parameter at the indicated index
+  const char *getValue(int idx) { return buffer.data() + entries[idx].value; }
+
+  /// Checks if the parameter exists
+  bool hasKey(const char *key) { return find(key) >= 0; }
+
+  /// Returns the parameter for a parameter id or nullptr: the result is
+  /// valid until the next call
+  HttpParameter *getParameter(const char *key) {
+    int idx = find(key);
+    if (idx < 0) return nullptr;
+    parameter.key = StrView(getKey(idx));
+    parameter.value = StrView(getValue(idx));
+    return &parameter;
   }
 
   /// Returns the value for a parameter id as string
   const char *getValue(const char *key) {
-    for (auto &entry : parameters) {
-      if (entry->key.equals(key)) {
-        return entry->value.c_str();
-      }
-    }
-    return nullptr;
+    int idx = find(key);
+    return idx < 0 ? nullptr : getValue(idx);
   }
 
   /// Returns the value for a parameter id as float
   float getFloat(const char *key) {
-    for (auto &entry : parameters) {
-      if (entry->key.equals(key)) {
-        return entry->value.toFloat();
-      }
-    }
-    return 0;
+    const char *value = getValue(key);
+    return value == nullptr ? 0 : atof(value);
   }
 
   /// Returns the value for a parameter id as int
   int getInt(const char *key) {
-    for (auto &entry : parameters) {
-      if (entry->key.equals(key)) {
-        return entry->value.toInt();
-      }
-    }
-    return 0;
+    const char *value = getValue(key);
+    return value == nullptr ? 0 : atoi(value);
   }
 
-  /// Clears all values
+  /// Clears all values: the memory is kept for reuse
   void clear() {
-    for (auto entry : parameters) {
-      delete entry;
-    }
-    parameters.clear();
+    buffer.clear();
+    entries.clear();
   }
 
  protected:
-  Vector<HttpParameterEntry *> parameters;
+  Vector<char> buffer;
+  Vector<char> stream_buffer;
+  Vector<HttpParameterEntry> entries;
+  HttpParameter parameter;
   int max_len;
 
-  void urldecode2(char *dst, const char *src) {
-    char a, b;
-    while (*src) {
-      if ((*src == '%') && ((a = src[1]) && (b = src[2])) &&
-          (isxdigit(a) && isxdigit(b))) {
-        if (a >= 'a') a -= 'a' - 'A';
-        if (a >= 'A')
-          a -= ('A' - 10);
-        else
-          a -= '0';
-        if (b >= 'a') b -= 'a' - 'A';
-        if (b >= 'A')
-          b -= ('A' - 10);
-        else
-          b -= '0';
-        *dst++ = 16 * a + b;
+  int find(const char *key) {
+    if (key == nullptr) return -1;
+    for (int j = 0; j < entries.size(); j++) {
+      if (strcmp(getKey(j), key) == 0) return j;
+    }
+    return -1;
+  }
+
+  /// Splits the buffer at & and decodes it in place: the decoded parameter
+  /// is never longer than the encoded one.
+  void index(int len) {
+    // we need space for the terminating 0
+    buffer.resize(len + 1);
+    char *data = buffer.data();
+    data[len] = 0;
+    int start = 0;
+    while (start < len) {
+      int end = start;
+      while (end < len && data[end] != '&') end++;
+      data[end] = 0;
+      int value = split(data + start, end - start);
+      if (value > 0) {
+        HttpParameterEntry entry;
+        entry.key = start;
+        entry.value = start + value;
+        DLNA_LOG(DlnaDebug, "key: %s", data + entry.key);
+        DLNA_LOG(DlnaDebug, "value: %s", data + entry.value);
+        int idx = find(data + entry.key);
+        if (idx >= 0) {
+          entries[idx].value = entry.value;
+        } else {
+          entries.push_back(entry);
+        }
+      }
+      start = end + 1;
+    }
+  }
+
+  /// Splits the parameter at = and decodes the key and value in place:
+  /// returns the offset of the value or -1 if there is no key
+  int split(char *str, int len) {
+    int pos = 0;
+    while (pos < len && str[pos] != '=') pos++;
+    if (pos == 0 || pos == len) return -1;
+    // we decode after the split, so that %3D and %26 can be used in values
+    str[pos] = 0;
+    int key_len = urldecode(str, pos);
+    int value = key_len + 1;
+    int value_len = urldecode(str + pos + 1, len - pos - 1);
+    memmove(str + value, str + pos + 1, value_len);
+    str[value + value_len] = 0;
+    return value;
+  }
+
+  /// Decodes the string in place: returns the decoded length
+  int urldecode(char *str, int len) {
+    char *dst = str;
+    const char *src = str;
+    const char *end = str + len;
+    while (src < end) {
+      if (*src == '%' && end - src > 2 && isxdigit(src[1]) &&
+          isxdigit(src[2])) {
+        *dst++ = 16 * hexValue(src[1]) + hexValue(src[2]);
         src += 3;
       } else if (*src == '+') {
         *dst++ = ' ';
@@ -169,8 +223,15 @@ class HttpParameters {
         *dst++ = *src++;
       }
     }
-    *dst++ = '\0';
+    *dst = 0;
+    return dst - str;
+  }
+
+  int hexValue(char c) {
+    if (c >= 'a') return c - 'a' + 10;
+    if (c >= 'A') return c - 'A' + 10;
+    return c - '0';
   }
 };
 
-}  // namespace tiny_dlna
\ No newline at end of file
+}  // namespace tiny_dlna
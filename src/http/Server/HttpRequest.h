@@ -5,7 +5,9 @@
 #include "HttpHeader.h"
 // #include "Platform/AltClient.h"
 #include "HttpChunkReader.h"
+#include "HttpConnectionPool.h"
 #include "WiFiClient.h"
+#include "basic/StrPrint.h"
 
 namespace tiny_dlna {
 
@@ -14,29 +16,46 @@ namespace tiny_dlna {
  * I tried to use Arduino HttpClient, but I  did not manage to extract the mime
  * type from streaming get requests.
  *
- * The functionality is based on the Arduino Client class.
+ * The functionality is based on the Arduino Client class. The reply data
+ * is buffered, so it must be read via this class and not from the client():
+ * for this purpose it is also available as Stream.
+ * With setKeepAlive() the connections are taken from a HttpConnectionPool
+ * and stop() keeps them open for the next request to the same host if the
+ * server permits it and the reply has been read completely. After stop() the
+ * client of setClient() is used again.
  *
+ * The headers which are defined with request().put() are only valid for the
+ * next request: they are cleared after it has been sent.
  */
 
-class HttpRequest {
+class HttpRequest : public Stream {
  public:
   HttpRequest() {
-    DlnaLogger.log(DlnaInfo, "HttpRequest");
+    DLNA_LOG(DlnaInfo, "HttpRequest");
     // default_client.setInsecure();
     setClient(default_client);
+    reply_header.setLineReader(chunk_reader);
+    request_header.setWriteOnce(false);
   }
 
   HttpRequest(Client &client) {
-    DlnaLogger.log(DlnaInfo, "HttpRequest");
+    DLNA_LOG(DlnaInfo, "HttpRequest");
     setClient(client);
+    reply_header.setLineReader(chunk_reader);
+    request_header.setWriteOnce(false);
   }
 
-  void setClient(Client &client) { this->client_ptr = &client; }
+  /// Defines the client: with setKeepAlive() it is only used when no pooled
+  /// connection is active
+  void setClient(Client &client) {
+    user_client_ptr = &client;
+    if (p_entry == nullptr) client_ptr = &client;
+  }
 
   // the requests usually need a host. This needs to be set if we did not
   // provide a URL
   void setHost(const char *host) {
-    DlnaLogger.log(DlnaInfo, "setHost", host);
+    DLNA_LOG(DlnaInfo, "setHost", host);
     this->host_name = host;
   }
 
@@ -44,70 +63,272 @@ class HttpRequest {
 
   virtual bool connected() { return client_ptr->connected(); }
 
-  virtual int available() {
+  int available() override {
     if (reply_header.isChunked()) {
       return chunk_reader.available();
     }
-    return client_ptr->available();
+    return chunk_reader.buffered() + client_ptr->available();
   }
 
+  /// Ends the request: a pooled connection is kept alive if possible
   virtual void stop() {
-    DlnaLogger.log(DlnaInfo, "stop");
+    DLNA_LOG(DlnaInfo, "stop");
+    if (p_entry != nullptr) {
+      bool keep = is_reusable && isReplyComplete() &&
+                  chunk_reader.buffered() == 0;
+      DLNA_LOG(DlnaInfo, "stop - keep alive: %s", keep ? "true" : "false");
+      release(keep);
+      return;
+    }
     client_ptr->stop();
   }
 
+  /// Reuses the connections to the same host (if the server permits it)
+  void setKeepAlive(bool active) {
+    is_keep_alive = active;
+    connection = active ? CON_KEEP_ALIVE : CON_CLOSE;
+    if (!active) {
+      release(false);
+      pool.end();
+    }
+  }
+
+  /// Returns true if the server permits to send further requests on the
+  /// connection of the last reply
+  bool isConnectionReusable() { return is_reusable; }
+
+  /// Provides the pool of the kept alive connections
+  HttpConnectionPool &connectionPool() { return pool; }
+
+  /// Returns true if all data of the reply has been read
+  bool isReplyComplete() {
+    if (reply_header.isChunked()) return chunk_reader.isEnded();
+    if (content_remaining >= 0) return content_remaining == 0;
+    return !client_ptr->connected() && available() == 0;
+  }
+
+  /// Reads the complete reply data (up to the timeout of the client): returns
+  /// the number of bytes
+  size_t readReply(Print &out) {
+    uint8_t buffer[256];
+    size_t result = 0;
+    uint32_t last_data = millis();
+    while (!isReplyComplete()) {
+      int len = read(buffer, sizeof(buffer));
+      if (len > 0) {
+        result += out.write(buffer, len);
+        last_data = millis();
+      } else if (millis() - last_data > client_ptr->getTimeout()) {
+        DLNA_LOG(DlnaWarning, "readReply: timeout");
+        break;
+      } else {
+        delay(1);
+      }
+    }
+    return result;
+  }
+
+  /// Reads the complete reply into the string: the capacity is reserved
+  /// upfront if the Content-Length is known. Returns 0 if the reply does not
+  /// fit into the string.
+  size_t readReply(StrPrint &out) {
+    long len = contentLength();
+    if (len > 0 && (len > (long)StrPrint::maxLength() ||
+                    !out.reserve(out.length() + len))) {
+      DLNA_LOG(DlnaError, "readReply: reply too big: %ld", len);
+      return 0;
+    }
+    return readReply((Print &)out);
+  }
+
+  /// Provides the Content-Length of the reply (-1 if not defined)
+  long contentLength() {
+    const char *content_len = reply_header.get(CONTENT_LENGTH);
+    return content_len != nullptr ? atol(content_len) : -1;
+  }
+
   virtual int post(Url &url, const char *mime, const char *data, int len = -1) {
-    DlnaLogger.log(DlnaInfo, "post %s", url.url());
+    DLNA_LOG(DlnaInfo, "post %s", url.url());
     return process(T_POST, url, mime, data, len);
   }
 
   virtual int put(Url &url, const char *mime, const char *data, int len = -1) {
-    DlnaLogger.log(DlnaInfo, "put %s", url.url());
+    DLNA_LOG(DlnaInfo, "put %s", url.url());
     return process(T_PUT, url, mime, data, len);
   }
 
   virtual int del(Url &url, const char *mime = nullptr,
                   const char *data = nullptr, int len = -1) {
-    DlnaLogger.log(DlnaInfo, "del %s", url.url());
+    DLNA_LOG(DlnaInfo, "del %s", url.url());
     return process(T_DELETE, url, mime, data, len);
   }
 
   virtual int get(Url &url, const char *acceptMime = nullptr,
                   const char *data = nullptr, int len = -1) {
-    DlnaLogger.log(DlnaInfo, "get %s", str(url.url()));
+    DLNA_LOG(DlnaInfo, "get %s", str(url.url()));
     this->accept = acceptMime;
     return process(T_GET, url, nullptr, data, len);
   }
 
   virtual int head(Url &url, const char *acceptMime = nullptr,
                    const char *data = nullptr, int len = -1) {
-    DlnaLogger.log(DlnaInfo, "head %s", url.url());
+    DLNA_LOG(DlnaInfo, "head %s", url.url());
     this->accept = acceptMime;
     return process(T_HEAD, url, nullptr, data, len);
   }
 
   virtual int subscribe(Url &url) {
-    DlnaLogger.log(DlnaInfo, "post %s", url.url());
+    DLNA_LOG(DlnaInfo, "post %s", url.url());
     return process(T_SUBSCRIBE, url, nullptr, nullptr, 0);
   }
 
+  virtual int unsubscribe(Url &url) {
+    DLNA_LOG(DlnaInfo, "unsubscribe %s", url.url());
+    return process(T_UNSUBSCRIBE, url, nullptr, nullptr, 0);
+  }
+
+  virtual int notify(Url &url, const char *mime, const char *data,
+                     int len = -1) {
+    DLNA_LOG(DlnaInfo, "notify %s", url.url());
+    return process(T_NOTIFY, url, mime, data, len);
+  }
+
   // reads the reply data
   virtual int read(uint8_t *str, int len) {
     if (reply_header.isChunked()) {
       return chunk_reader.read(*client_ptr, str, len);
     } else {
-      return client_ptr->read(str, len);
+      if (content_remaining >= 0 && len > content_remaining)
+        len = content_remaining;
+      int result = chunk_reader.readBytes(*client_ptr, str, len);
+      consumed(result);
+      return result;
     }
   }
 
+  int read() override {
+    uint8_t ch;
+    return read(&ch, 1) == 1 ? ch : -1;
+  }
+
+  int peek() override {
+    if (reply_header.isChunked() && chunk_reader.available() == 0) return -1;
+    return chunk_reader.peekByte(*client_ptr);
+  }
+
+  size_t write(uint8_t ch) override { return client_ptr->write(ch); }
+
+  size_t write(const uint8_t *data, size_t len) override {
+    return client_ptr->write(data, len);
+  }
+
   // read the reply data up to the next new line. For Chunked data we provide
   // the full chunk!
   virtual int readln(uint8_t *str, int len, bool incl_nl = true) {
     if (reply_header.isChunked()) {
       return chunk_reader.readln(*client_ptr, str, len);
     } else {
-      return chunk_reader.readlnInternal(*client_ptr, str, len, incl_nl);
+      int result = chunk_reader.readlnInternal(*client_ptr, str, len, incl_nl);
+      consumed(result);
+      return result;
+    }
+  }
+
+  /// Sends a request without waiting for the reply. On a kept alive
+  /// connection multiple requests can be sent (pipelined) before the replies
+  /// are read with receive() in the same sequence.
+  virtual bool send(TinyMethodID action, Url &url, const char *mime,
+                    const char *data, int len = -1) {
+    if (is_keep_alive && p_entry == nullptr && !acquire(url)) {
+      if (!is_retry_possible) endRequest();
+      return false;
     }
+    if (!connected()) {
+      DLNA_LOG(DlnaInfo, "Connecting to host %s port %d", url.host(),
+               url.port());
+
+      connect(url);
+    }
+
+    if (!connected()) {
+      DLNA_LOG(DlnaInfo, "Connected: %s", connected()? "true" : "false");
+      if (!is_retry_possible) endRequest();
+      return false;
+    }
+
+    request_header.setValues(action, url.path());
+    if (len == -1 && data != nullptr) {
+      len = strlen(data);
+    }
+    if (len > 0) {
+      request_header.put(CONTENT_LENGTH, len);
+    }
+    // the host is determined from the url unless it has been defined
+    char host[100];
+    const char *host_value = host_name.c_str();
+    if (host_name.isEmpty()) {
+      snprintf(host, sizeof(host), "%s:%d", url.host(), url.port());
+      host_value = host;
+    }
+    request_header.put(HOST_C, host_value);
+    if (agent != nullptr) {
+      request_header.put(USER_AGENT, agent);
+    }
+    if (accept_encoding != nullptr) {
+      request_header.put(ACCEPT_ENCODING, accept_encoding);
+    }
+    if (mime != nullptr) {
+      request_header.put(CONTENT_TYPE, mime);
+    }
+
+    request_header.put(CONNECTION, connection);
+    request_header.put(ACCEPT, accept);
+
+    request_header.write(*client_ptr);
+    is_request_sent = true;
+
+    if (len > 0) {
+      DLNA_LOG(DlnaInfo, "process - writing data");
+      client_ptr->write((const uint8_t *)data, len);
+    }
+    if (!is_retry_possible) endRequest();
+    return true;
+  }
+
+  /// Opens the connection to the host of the url (with setKeepAlive() it is
+  /// taken from the pool) w/o sending anything: e.g. to execute the connect
+  /// and the send() in separate steps
+  bool open(Url &url) {
+    if (is_keep_alive) return p_entry != nullptr || acquire(url);
+    if (!connected()) connect(url);
+    return connected();
+  }
+
+  /// Reads the available data w/o blocking: returns true if the reply header
+  /// has been received, so that receive() does not need to wait for it
+  bool isReplyHeaderAvailable() {
+    return chunk_reader.isHeaderAvailable(*client_ptr);
+  }
+
+  /// Reads the reply header of the next sent request: provides the status
+  /// code. Read the reply data before calling it again.
+  virtual int receive(TinyMethodID action = T_GET) {
+    DLNA_LOG(DlnaInfo, "receive");
+    reply_header.read(*client_ptr);
+
+    // determine the length of the content
+    int status = reply_header.statusCode();
+    const char *content_len = reply_header.get(CONTENT_LENGTH);
+    content_remaining = content_len != nullptr ? atol(content_len) : -1;
+    if (action == T_HEAD || status == 204 || status == 304) content_remaining = 0;
+    is_reusable = is_keep_alive && status > 0 && isReusableReply();
+
+    // if we use chunked tranfer we need to read the first chunked length
+    if (reply_header.isChunked() && content_remaining != 0) {
+      chunk_reader.open(*client_ptr);
+    };
+
+    return status;
   }
 
   // provides the head information of the reply
@@ -127,11 +348,28 @@ class HttpRequest {
 
   Client *client() { return client_ptr; }
 
-  void setTimeout(int ms) { client_ptr->setTimeout(ms); }
+  /// Defines the timeout of the client and the pooled connections: this is
+  /// also used for the connect if the client supports it
+  void setTimeout(int ms) {
+    user_client_ptr->setTimeout(ms);
+    client_ptr->setTimeout(ms);
+    pool.setTimeout(ms);
+  }
+
+  /// Takes the agent, accept encoding and timeout from the other request:
+  /// e.g. for additional connections to other hosts
+  void copySettings(HttpRequest &other) {
+    agent = other.agent;
+    accept_encoding = other.accept_encoding;
+    setTimeout(other.user_client_ptr->getTimeout());
+  }
 
  protected:
   WiFiClient default_client;
+  // client which is used for the actual request
   Client *client_ptr;
+  // client defined by setClient()
+  Client *user_client_ptr;
   Url url;
   HttpRequestHeader request_header;
   HttpReplyHeader reply_header;
@@ -141,77 +379,115 @@ class HttpRequest {
   const char *connection = CON_CLOSE;
   const char *accept = ACCEPT_ALL;
   const char *accept_encoding = nullptr;
+  HttpConnectionPool pool;
+  HttpPoolEntry *p_entry = nullptr;
+  bool is_keep_alive = false;
+  bool is_reusable = false;
+  // keeps the request header for a repeated send
+  bool is_retry_possible = false;
+  // some data of the request has been written to the client
+  bool is_request_sent = false;
+  // unread content or -1 if the length is not known
+  long content_remaining = -1;
 
   const char *str(const char *in) { return in == nullptr ? "" : in; }
 
+  /// the request specific headers are only valid for one request
+  void endRequest() { request_header.clear(); }
+
+  void consumed(int len) {
+    if (content_remaining > 0 && len > 0) {
+      content_remaining = len > content_remaining ? 0 : content_remaining - len;
+    }
+  }
+
+  /// takes a connection from the pool
+  bool acquire(Url &url) {
+    release(false);
+    p_entry = pool.acquire(url);
+    if (p_entry == nullptr) return false;
+    client_ptr = &p_entry->client;
+    chunk_reader.clear();
+    return true;
+  }
+
+  /// gives the pooled connection back and uses the client of setClient()
+  /// again
+  void release(bool keepAlive) {
+    if (p_entry == nullptr) return;
+    pool.release(p_entry, keepAlive);
+    p_entry = nullptr;
+    client_ptr = user_client_ptr;
+    chunk_reader.clear();
+  }
+
+  /// determines if the server permits to reuse the connection
+  bool isReusableReply() {
+    StrView con(reply_header.get(CONNECTION));
+    if (con.equalsIgnoreCase(CON_CLOSE)) return false;
+    bool is_http11 = StrView(reply_header.protocol()).equals("HTTP/1.1");
+    if (!is_http11 && !con.equalsIgnoreCase(CON_KEEP_ALIVE)) return false;
+    // the end of the content must be known
+    return reply_header.isChunked() || content_remaining >= 0;
+  }
+
   // opens a connection to the indicated host
   virtual int connect(const char *ip, uint16_t port) {
-    DlnaLogger.log(DlnaInfo, "connect %s", ip);
+    DLNA_LOG(DlnaInfo, "connect %s", ip);
+    // the buffered data belongs to the old connection
+    chunk_reader.clear();
     int rc = this->client_ptr->connect(ip, port);
     uint64_t end = millis() + client_ptr->getTimeout();
-    DlnaLogger.log(DlnaInfo, "Connected: %s (rc=%d) with timeout %ld", connected()? "true" : "false", rc, client_ptr->getTimeout());
+    DLNA_LOG(DlnaInfo, "Connected: %s (rc=%d) with timeout %ld", connected()? "true" : "false", rc, client_ptr->getTimeout());
     return rc;
   }
 
+  // opens a connection to the host of the url: w/o DNS lookup if the host is
+  // an IP address
+  int connect(Url &url) {
+    if (!url.hasAddress()) return connect(url.host(), url.port());
+    DLNA_LOG(DlnaInfo, "connect %s", url.host());
+    chunk_reader.clear();
+    return client_ptr->connect(url.address(), url.port());
+  }
+
   // sends request and reads the reply_header from the server
   virtual int process(TinyMethodID action, Url &url, const char *mime,
                       const char *data, int len = -1) {
-    if (!connected()) {
-      DlnaLogger.log(DlnaInfo, "Connecting to host %s port %d", url.host(),
-                     url.port());
-
-      connect(url.host(), url.port());
-    }
-
-    if (!connected()) {
-      DlnaLogger.log(DlnaInfo, "Connected: %s", connected()? "true" : "false");
-      return -1;
-    }
-
-    if (host_name.isEmpty()) {
-      host_name = url.host();
-      host_name.add(":");
-      host_name.add(url.port());
-    }
-
-    request_header.setValues(action, url.path());
-    if (len == -1 && data != nullptr) {
-      len = strlen(data);
+    // a kept alive connection might have been closed by the server: so we
+    // retry once with a new connection. The server might have processed the
+    // request nevertheless, so we only repeat the idempotent ones.
+    bool is_reused = false;
+    if (is_keep_alive) {
+      uint32_t connects = pool.connectCount();
+      if (!acquire(url)) {
+        endRequest();
+        return -1;
+      }
+      is_reused = pool.connectCount() == connects;
     }
-    if (len > 0) {
-      request_header.put(CONTENT_LENGTH, len);
-    }
-    if (!host_name.isEmpty()) {
-      request_header.put(HOST_C, host_name.c_str());
-    }
-    if (agent != nullptr) {
-      request_header.put(USER_AGENT, agent);
-    }
-    if (accept_encoding != nullptr) {
-      request_header.put(ACCEPT_ENCODING, accept_encoding);
-    }
-    if (mime != nullptr) {
-      request_header.put(CONTENT_TYPE, mime);
-    }
-
-    request_header.put(CONNECTION, connection);
-    request_header.put(ACCEPT, accept);
-
-    request_header.write(*client_ptr);
-
-    if (len > 0) {
-      DlnaLogger.log(DlnaInfo, "process - writing data");
-      client_ptr->write((const uint8_t *)data, len);
+    is_retry_possible = is_reused;
+    is_request_sent = false;
+    int rc = processRequest(action, url, mime, data, len);
+    is_retry_possible = false;
+    bool is_retry = !is_request_sent || HttpRequestHeader::isIdempotent(action);
+    if (rc <= 0 && is_reused && !is_retry) {
+      DLNA_LOG(DlnaWarning, "Kept alive connection failed: %s not repeated",
+               methods[action]);
+      release(false);
+    } else if (rc <= 0 && is_reused) {
+      DLNA_LOG(DlnaInfo, "Kept alive connection failed: reconnecting");
+      release(false);
+      rc = acquire(url) ? processRequest(action, url, mime, data, len) : -1;
     }
+    endRequest();
+    return rc;
+  }
 
-    reply_header.read(*client_ptr);
-
-    // if we use chunked tranfer we need to read the first chunked length
-    if (reply_header.isChunked()) {
-      chunk_reader.open(*client_ptr);
-    };
-
-    return reply_header.statusCode();
+  // sends request and reads the reply_header from the server
+  virtual int processRequest(TinyMethodID action, Url &url, const char *mime,
+                             const char *data, int len = -1) {
+    return send(action, url, mime, data, len) ? receive(action) : -1;
   }
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "HttpHeader.h"
+#include "basic/IntrusiveList.h"
 
 namespace tiny_dlna {
 
@@ -13,21 +14,23 @@ typedef void (*web_callback_fn)(HttpServer* server, const char* requestPath,
                                 HttpRequestHandlerLine* handlerLine);
 
 /**
- * @brief Used to register and process callbacks
+ * @brief Used to register and process callbacks. The handler lines are linked
+ * directly in the handler collection of the HttpServer.
  *
  */
-class HttpRequestHandlerLine {
+class HttpRequestHandlerLine
+    : public IntrusiveListItem<HttpRequestHandlerLine> {
  public:
   HttpRequestHandlerLine(int ctxSize = 0) {
-    DlnaLogger.log(DlnaDebug, "HttpRequestHandlerLine");
+    DLNA_LOG(DlnaDebug, "HttpRequestHandlerLine");
     contextCount = ctxSize;
     context = new void*[ctxSize];
   }
 
   ~HttpRequestHandlerLine() {
-    DlnaLogger.log(DlnaDebug, "~HttpRequestHandlerLine");
+    DLNA_LOG(DlnaDebug, "~HttpRequestHandlerLine");
     if (contextCount > 0) {
-      DlnaLogger.log(DlnaDebug, "HttpRequestHandlerLine %s", "free");
+      DLNA_LOG(DlnaDebug, "HttpRequestHandlerLine %s", "free");
       delete[] context;
     }
   }
@@ -39,6 +42,8 @@ class HttpRequestHandlerLine {
   void** context;
   int contextCount;
   StrView* header = nullptr;
+  // number of processed requests
+  uint32_t request_count = 0;
 };
 
 }  // namespace tiny_dlna
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "basic/IntrusiveList.h"
 #include "basic/Str.h"
 
 namespace tiny_dlna {
@@ -8,7 +9,7 @@ namespace tiny_dlna {
  * @brief Object which  information about the rewrite rule
  *
  */
-class HttpRequestRewrite {
+class HttpRequestRewrite : public IntrusiveListItem<HttpRequestRewrite> {
  public:
   HttpRequestRewrite(const char* from, const char* to) {
     this->from = StrView(from);
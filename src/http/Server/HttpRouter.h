@@ -0,0 +1,171 @@
+#pragma once
+
+#include <string.h>
+
+#include "basic/StrView.h"
+#include "basic/Vector.h"
+
+namespace tiny_dlna {
+
+/**
+ * @brief Index over url patterns which avoids a linear search over all
+ * registered handlers: patterns without wildcards are stored in a hash
+ * table and the patterns with a wild card ('*' or '?') in a prefix trie of
+ * the part before the first wildcard, so that we only need to call
+ * StrView::matches() for the wildcard patterns with a matching prefix. The
+ * key (e.g. the TinyMethodID) is part of the lookup. Add all patterns and
+ * call build() before using find().
+ * @author Phil Schatzmann
+ */
+class HttpRouter {
+ public:
+  /// Removes all entries
+  void clear() {
+    entries.clear();
+    buckets.clear();
+    nodes.clear();
+    result.clear();
+  }
+
+  /// Adds a pattern: the pattern must stay valid
+  void add(const char* pattern, uint8_t key, void* ref) {
+    Entry entry;
+    entry.pattern = pattern == nullptr ? "" : pattern;
+    entry.key = key;
+    entry.ref = ref;
+    entries.push_back(entry);
+  }
+
+  /// Builds the hash table and the trie from the added patterns
+  void build() {
+    // hash table with a load factor <= 0.5
+    int size = 4;
+    while (size < entries.size() * 2) size <<= 1;
+    buckets.resize(size);
+    for (int j = 0; j < size; j++) buckets[j] = -1;
+    nodes.clear();
+    Node root;
+    nodes.push_back(root);
+
+    // insert in reverse order, so that the chains are sorted by the index
+    for (int j = entries.size() - 1; j >= 0; j--) {
+      Entry& entry = entries[j];
+      const char* wildcard = strpbrk(entry.pattern, "*?");
+      if (wildcard == nullptr) {
+        entry.hash = hash(entry.key, entry.pattern);
+        int& head = buckets[entry.hash & (size - 1)];
+        entry.next = head;
+        head = j;
+      } else {
+        int node = child(0, entry.key, true);
+        for (const char* p = entry.pattern; p < wildcard; p++) {
+          node = child(node, *p, true);
+        }
+        entry.next = nodes[node].entry;
+        nodes[node].entry = j;
+      }
+    }
+  }
+
+  /// Provides the references of all matching entries in the sequence in which
+  /// they were added
+  Vector<void*>& find(uint8_t key, const char* path) {
+    result.clear();
+    indexes.clear();
+    if (buckets.size() == 0 || path == nullptr) return result;
+
+    // exact matches
+    uint32_t path_hash = hash(key, path);
+    int pos = buckets[path_hash & (buckets.size() - 1)];
+    for (; pos >= 0; pos = entries[pos].next) {
+      Entry& entry = entries[pos];
+      if (entry.hash == path_hash && entry.key == key &&
+          strcmp(entry.pattern, path) == 0) {
+        indexes.push_back(pos);
+      }
+    }
+
+    // wildcard matches along the path in the trie
+    StrView path_str(path);
+    const char* p = path;
+    int node = child(0, key, false);
+    while (node >= 0) {
+      for (pos = nodes[node].entry; pos >= 0; pos = entries[pos].next) {
+        if (path_str.matches(entries[pos].pattern)) indexes.push_back(pos);
+      }
+      if (*p == 0) break;
+      node = child(node, *p++, false);
+    }
+
+    sortIndexes();
+    for (int j = 0; j < indexes.size(); j++) {
+      result.push_back(entries[indexes[j]].ref);
+    }
+    return result;
+  }
+
+  /// Number of entries
+  int size() { return entries.size(); }
+
+ protected:
+  struct Entry {
+    const char* pattern = nullptr;
+    uint8_t key = 0;
+    void* ref = nullptr;
+    uint32_t hash = 0;
+    // next entry in the same bucket or trie node
+    int next = -1;
+  };
+  struct Node {
+    char ch = 0;
+    int child = -1;
+    int sibling = -1;
+    // first entry which ends at this node
+    int entry = -1;
+  };
+  Vector<Entry> entries;
+  Vector<int> buckets;
+  Vector<Node> nodes;
+  Vector<int> indexes;
+  Vector<void*> result;
+
+  /// FNV-1a hash of the key and the path
+  uint32_t hash(uint8_t key, const char* path) {
+    uint32_t result = (2166136261u ^ key) * 16777619u;
+    for (const char* p = path; *p != 0; p++) {
+      result = (result ^ (uint8_t)*p) * 16777619u;
+    }
+    return result;
+  }
+
+  /// Finds (or creates) the child node with the indicated character
+  int child(int node, char ch, bool create) {
+    int pos = nodes[node].child;
+    for (; pos >= 0; pos = nodes[pos].sibling) {
+      if (nodes[pos].ch == ch) return pos;
+    }
+    if (!create) return -1;
+    Node new_node;
+    new_node.ch = ch;
+    new_node.sibling = nodes[node].child;
+    nodes.push_back(new_node);
+    int result = nodes.size() - 1;
+    nodes[node].child = result;
+    return result;
+  }
+
+  /// insertion sort: we usually have only 1 or 2 entries
+  void sortIndexes() {
+    for (int j = 1; j < indexes.size(); j++) {
+      int value = indexes[j];
+      int k = j - 1;
+      while (k >= 0 && indexes[k] > value) {
+        indexes[k + 1] = indexes[k];
+        k--;
+      }
+      indexes[k + 1] = value;
+    }
+  }
+};
+
+}  // namespace tiny_dlna
@@ -6,31 +6,67 @@
 #include "Client.h"
 #include "HardwareSerial.h"
 #include "HttpChunkWriter.h"
+#include "HttpChunkedPrint.h"
+#include "HttpConnection.h"
 #include "HttpHeader.h"
 #include "HttpRequestHandlerLine.h"
 #include "HttpRequestRewrite.h"
+#include "HttpRouter.h"
 #include "HttpTunnel.h"
 #include "Server.h"
-#include "basic/List.h"
+#include "basic/Allocator.h"
+#include "basic/BufferedPrint.h"
+#include "basic/GzipPrint.h"
+#include "basic/Inflater.h"
+#include "basic/IntrusiveList.h"
+#include "basic/Metrics.h"
+#include "basic/StreamCopy.h"
+
+// time in ms after which an idle keep-alive connection is closed
+#ifndef DLNA_HTTP_KEEP_ALIVE_TIMEOUT
+#define DLNA_HTTP_KEEP_ALIVE_TIMEOUT 5000
+#endif
+
+// max number of connections which are served in parallel
+#ifndef DLNA_HTTP_MAX_CONNECTIONS
+#define DLNA_HTTP_MAX_CONNECTIONS 4
+#endif
+
+// max number of requests per keep-alive connection
+#ifndef DLNA_HTTP_MAX_REQUESTS
+#define DLNA_HTTP_MAX_REQUESTS 20
+#endif
+
+// size of the memory for the temporary objects of a request
+#ifndef DLNA_HTTP_ARENA_SIZE
+#define DLNA_HTTP_ARENA_SIZE 2048
+#endif
+
+// max-age in seconds of the Cache-Control header for static content
+#ifndef DLNA_HTTP_CACHE_MAX_AGE
+#define DLNA_HTTP_CACHE_MAX_AGE 3600
+#endif
 
 namespace tiny_dlna {
 
 /**
  * @brief A Simple Header only implementation of Http Server that allows the
  * registration of callback functions. This is based on the Arduino Server
- * class.
+ * class. Up to DLNA_HTTP_MAX_CONNECTIONS (keep-alive) connections are served in
+ * parallel: copy() reads the request headers without blocking and processes
+ * one complete request per connection.
  *
  */
 class HttpServer {
  public:
-  HttpServer(WiFiServer& server, int bufferSize = 1024) {
-    DlnaLogger.log(DlnaInfo, "HttpServer");
+  HttpServer(WiFiServer& server, int bufferSize = DLNA_STREAM_BLOCK_SIZE) {
+    DLNA_LOG(DlnaInfo, "HttpServer");
     this->server_ptr = &server;
-    this->buffer.resize(bufferSize);
+    stream_copy.setBlockSize(bufferSize);
   }
 
   ~HttpServer() {
-    DlnaLogger.log(DlnaInfo, "~HttpServer");
+    DLNA_LOG(DlnaInfo, "~HttpServer");
     handler_collection.clear();
     request_header.clear(false);
     reply_header.clear(false);
@@ -66,29 +102,32 @@ class HttpServer {
 
   /// Starts the server on the indicated port
   bool begin(int port) {
-    DlnaLogger.log(DlnaInfo, "HttpServer begin at port %d", port);
+    DLNA_LOG(DlnaInfo, "HttpServer begin at port %d", port);
     is_active = true;
+    updateRouter();
     server_ptr->begin(port);
     return true;
   }
 
   /// stops the server_ptr
   void end() {
-    DlnaLogger.log(DlnaInfo, "HttpServer %s", "stop");
+    DLNA_LOG(DlnaInfo, "HttpServer %s", "stop");
     is_active = false;
+    for (int j = 0; j < max_connections; j++) connections[j].close();
   }
 
   /// adds a rewrite rule
   void rewrite(const char* from, const char* to) {
-    DlnaLogger.log(DlnaInfo, "Rewriting %s to %s", from, to);
+    DLNA_LOG(DlnaInfo, "Rewriting %s to %s", from, to);
     HttpRequestRewrite* line = new HttpRequestRewrite(from, to);
     rewrite_collection.push_back(line);
+    is_router_valid = false;
   }
 
   /// register a generic handler
   void on(const char* url, TinyMethodID method, web_callback_fn fn,
           void* ctx[] = nullptr, int ctxCount = 0) {
-    DlnaLogger.log(DlnaInfo, "Serving at %s", url);
+    DLNA_LOG(DlnaInfo, "Serving at %s", url);
     HttpRequestHandlerLine* hl = new HttpRequestHandlerLine(ctxCount);
     hl->path = url;
     hl->fn = fn;
@@ -102,7 +141,7 @@ class HttpServer {
   /// register a handler with mime
   void on(const char* url, TinyMethodID method, const char* mime,
           web_callback_fn fn) {
-    DlnaLogger.log(DlnaInfo, "Serving at %s", url);
+    DLNA_LOG(DlnaInfo, "Serving at %s", url);
     HttpRequestHandlerLine* hl = new HttpRequestHandlerLine();
     hl->path = url;
     hl->fn = fn;
@@ -114,22 +153,26 @@ class HttpServer {
   /// register a handler which provides the indicated string
   void on(const char* url, TinyMethodID method, const char* mime,
           const char* result) {
-    DlnaLogger.log(DlnaInfo, "Serving at %s", url);
+    DLNA_LOG(DlnaInfo, "Serving at %s", url);
 
     auto lambda = [](HttpServer* server_ptr, const char* requestPath,
                      HttpRequestHandlerLine* hl) {
-      DlnaLogger.log(DlnaInfo, "on-strings %s", "lambda");
-      if (hl->contextCount < 2) {
-        DlnaLogger.log(DlnaError, "The context is not available");
+      DLNA_LOG(DlnaInfo, "on-strings %s", "lambda");
+      if (hl->contextCount < 3) {
+        DLNA_LOG(DlnaError, "The context is not available");
         return;
       }
       const char* mime = (const char*)hl->context[0];
       const char* msg = (const char*)hl->context[1];
+      uint32_t* p_etag = (uint32_t*)hl->context[2];
+      if (server_ptr->replyStaticNotModified(*p_etag)) return;
       server_ptr->reply(mime, msg, 200);
     };
-    HttpRequestHandlerLine* hl = new HttpRequestHandlerLine(2);
+    HttpRequestHandlerLine* hl = new HttpRequestHandlerLine(3);
     hl->context[0] = (void*)mime;
     hl->context[1] = (void*)result;
+    // the content is static: so we calculate the ETag only once
+    hl->context[2] = new uint32_t(etag((const uint8_t*)result, strlen(result)));
     hl->path = url;
     hl->fn = lambda;
     hl->method = method;
@@ -139,26 +182,30 @@ class HttpServer {
   /// register a handler which provides the indicated string
   void on(const char* url, TinyMethodID method, const char* mime,
           const uint8_t* data, int len) {
-    DlnaLogger.log(DlnaInfo, "Serving at %s", url);
+    DLNA_LOG(DlnaInfo, "Serving at %s", url);
 
     auto lambda = [](HttpServer* server_ptr, const char* requestPath,
                      HttpRequestHandlerLine* hl) {
-      DlnaLogger.log(DlnaInfo, "on-strings %s", "lambda");
-      if (hl->contextCount < 3) {
-        DlnaLogger.log(DlnaError, "The context is not available");
+      DLNA_LOG(DlnaInfo, "on-strings %s", "lambda");
+      if (hl->contextCount < 4) {
+        DLNA_LOG(DlnaError, "The context is not available");
         return;
       }
       const char* mime = static_cast<char*>(hl->context[0]);
       const uint8_t* data = static_cast<uint8_t*>(hl->context[1]);
       int* p_len = (int*)hl->context[2];
       int len = *p_len;
-      DlnaLogger.log(DlnaDebug, "Mime %d - Len: %d", mime, len);
+      uint32_t* p_etag = (uint32_t*)hl->context[3];
+      DLNA_LOG(DlnaDebug, "Mime %d - Len: %d", mime, len);
+      if (server_ptr->replyStaticNotModified(*p_etag)) return;
       server_ptr->reply(mime, data, len, 200);
     };
-    HttpRequestHandlerLine* hl = new HttpRequestHandlerLine(3);
+    HttpRequestHandlerLine* hl = new HttpRequestHandlerLine(4);
     hl->context[0] = (void*)mime;
     hl->context[1] = (void*)data;
     hl->context[2] = new int(len);
+    // the content is static: so we calculate the ETag only once
+    hl->context[3] = new uint32_t(etag(data, len));
     hl->path = url;
     hl->fn = lambda;
     hl->method = method;
@@ -167,14 +214,14 @@ class HttpServer {
 
   /// register a redirection
   void on(const char* url, TinyMethodID method, Url& redirect) {
-    DlnaLogger.log(DlnaInfo, "Serving at %s", url);
+    DLNA_LOG(DlnaInfo, "Serving at %s", url);
     auto lambda = [](HttpServer* server_ptr, const char* requestPath,
                      HttpRequestHandlerLine* hl) {
       if (hl->contextCount < 1) {
-        DlnaLogger.log(DlnaError, "The context is not available");
+        DLNA_LOG(DlnaError, "The context is not available");
         return;
       }
-      DlnaLogger.log(DlnaInfo, "on-redirect %s", "lambda");
+      DLNA_LOG(DlnaInfo, "on-redirect %s", "lambda");
       HttpReplyHeader reply_header;
       Url* url = static_cast<Url*>(hl->context[0]);
       reply_header.setValues(301, "Moved");
@@ -196,29 +243,40 @@ class HttpServer {
 
   /// register a redirection
   void on(const char* url, TinyMethodID method, HttpTunnel& tunnel) {
-    DlnaLogger.log(DlnaInfo, "Serving at %s", url);
+    DLNA_LOG(DlnaInfo, "Serving at %s", url);
 
     auto lambda = [](HttpServer* server_ptr, const char* requestPath,
                      HttpRequestHandlerLine* hl) {
-      DlnaLogger.log(DlnaInfo, "on-HttpTunnel %s", "lambda");
+      DLNA_LOG(DlnaInfo, "on-HttpTunnel %s", "lambda");
       HttpTunnel* p_tunnel = static_cast<HttpTunnel*>(hl->context[0]);
       if (p_tunnel == nullptr) {
-        DlnaLogger.log(DlnaError, "p_tunnel is null");
+        DLNA_LOG(DlnaError, "p_tunnel is null");
         server_ptr->replyNotFound();
         return;
       }
       const char* mime = hl->mime;
-      // execute T_GET request
-      Stream* p_in = p_tunnel->get();
+      // execute T_GET request: the range is forwarded
+      const char* range = server_ptr->request_header.get(H_RANGE);
+      Stream* p_in = p_tunnel->get(range);
       if (p_in == nullptr) {
-        DlnaLogger.log(DlnaError, "p_in is null");
+        DLNA_LOG(DlnaError, "p_in is null");
         server_ptr->replyNotFound();
         return;
       }
-      const char* content_len = p_tunnel->request().reply().get(CONTENT_LENGTH);
+      HttpReplyHeader& upstream = p_tunnel->request().reply();
+      const char* content_len = upstream.get(CONTENT_LENGTH);
       StrView content_len_str{content_len};
+      const char* content_range = upstream.get(H_CONTENT_RANGE);
       // provide result
-      server_ptr->reply(mime, *p_in, content_len_str.toInt());
+      if (upstream.statusCode() == 206 && content_range != nullptr) {
+        server_ptr->reply_header.put(CONTENT_RANGE, content_range);
+        server_ptr->reply_header.put(ACCEPT_RANGES, BYTES);
+        server_ptr->replyStream(mime, *p_in, content_len_str.toInt(), 206,
+                                PARTIAL_CONTENT);
+      } else {
+        // if the range was ignored we skip the data ourself
+        server_ptr->reply(mime, *p_in, content_len_str.toInt());
+      }
     };
 
     HttpRequestHandlerLine* hl = new HttpRequestHandlerLine(1);
@@ -230,27 +288,46 @@ class HttpServer {
     addHandler(hl);
   }
 
+  /// register a handler which provides the DlnaMetrics and the number of
+  /// requests per route in the Prometheus text format
+  void onMetrics(const char* url = "/metrics") {
+    auto lambda = [](HttpServer* server_ptr, const char* requestPath,
+                     HttpRequestHandlerLine* hl) {
+      Print& out = server_ptr->replyPrint("text/plain");
+      DlnaMetrics.printTo(out);
+      MetricsClass::printType(out, "http_route_requests", "", "counter");
+      char line[160];
+      for (auto handler_line_ptr : server_ptr->handler_collection) {
+        snprintf(line, sizeof(line),
+                 "dlna_http_route_requests{method=\"%s\",path=\"%s\"} %lu",
+                 methods[handler_line_ptr->method],
+                 handler_line_ptr->path.c_str(),
+                 (unsigned long)handler_line_ptr->request_count);
+        out.println(line);
+      }
+      server_ptr->endClient();
+    };
+    on(url, T_GET, lambda);
+  }
+
   /// generic handler - you can overwrite this method to provide your specifc
   /// processing logic
   bool onRequest(const char* path) {
-    DlnaLogger.log(DlnaInfo, "Serving at %s", path);
+    DLNA_LOG(DlnaInfo, "Serving at %s", path);
 
     bool result = false;
-    // check in registered handlers
-    StrView pathStr = StrView(path);
-    for (auto handler_line_ptr : handler_collection) {
-      DlnaLogger.log(DlnaInfo, "onRequest: %s vs: %s %s %s",
-                     path,
-                     nullstr(handler_line_ptr->path.c_str()),
-                     methods[handler_line_ptr->method],
-                     nullstr(handler_line_ptr->mime));
-
-      if (pathStr.matches(handler_line_ptr->path.c_str()) &&
-          request_header.method() == handler_line_ptr->method &&
-          matchesMime(handler_line_ptr->mime, request_header.accept())) {
+    // check the handlers which match the method and path
+    updateRouter();
+    Vector<void*>& candidates =
+        handler_router.find(request_header.method(), path);
+    for (void* candidate : candidates) {
+      HttpRequestHandlerLine* handler_line_ptr =
+          (HttpRequestHandlerLine*)candidate;
+      if (matchesMime(handler_line_ptr->mime, request_header.accept())) {
         // call registed handler function
-        DlnaLogger.log(DlnaInfo, "onRequest %s", "->found",
-                       nullstr(handler_line_ptr->path.c_str()));
+        DLNA_LOG(DlnaInfo, "onRequest %s", "->found",
+                 nullstr(handler_line_ptr->path.c_str()));
+        handler_line_ptr->request_count++;
         handler_line_ptr->fn(this, path, handler_line_ptr);
         result = true;
         break;
@@ -258,63 +335,85 @@ class HttpServer {
     }
 
     if (!result) {
-      DlnaLogger.log(DlnaError, "Request %s not available", path);
+      DLNA_LOG(DlnaError, "Request %s not available", path);
     }
 
     return result;
   }
 
-  /// chunked reply with data from an input stream
+  /// chunked reply with data from an input stream: provide the size if it
+  /// is known, otherwise the data is copied up to the timeout of the
+  /// streamCopy()
   void replyChunked(const char* contentType, Stream& inputStream,
-                    int status = 200, const char* msg = SUCCESS) {
-    replyChunked(contentType, status, msg);
-    HttpChunkWriter chunk_writer;
-    while (inputStream.available()) {
-      int len = inputStream.readBytes(buffer.data(), buffer.size());
-      chunk_writer.writeChunk(*client_ptr, (const char*)buffer.data(), len);
-    }
-    // final chunk
-    chunk_writer.writeEnd(*client_ptr);
+                    int status = 200, const char* msg = SUCCESS,
+                    int size = 0) {
+    DLNA_LOG(DlnaInfo, "reply %s", "replyChunked");
+    beginChunkedReply(contentType, status, msg, isCompressedReply());
+    size_t written = stream_copy.copy(inputStream, replyOut(), size);
+    DlnaMetrics.add(CNT_BYTES_STREAMED, written);
     endClient();
   }
 
-  /// start of chunked reply: use HttpChunkWriter to provde the data
+  /// start of chunked reply: use HttpChunkWriter to provde the data. If the
+  /// reply is compressed (see setCompression()) the data must be written to
+  /// replyOut() instead.
   void replyChunked(const char* contentType, int status = 200,
                     const char* msg = SUCCESS) {
-    DlnaLogger.log(DlnaInfo, "reply %s", "replyChunked");
+    DLNA_LOG(DlnaInfo, "reply %s", "replyChunked");
+    if (isCompressedReply()) {
+      beginChunkedReply(contentType, status, msg, true);
+      return;
+    }
     reply_header.setValues(status, msg);
     reply_header.put(TRANSFER_ENCODING, CHUNKED);
     reply_header.put(CONTENT_TYPE, contentType);
-    reply_header.put(CONNECTION, CON_KEEP_ALIVE);
-    reply_header.write(this->client());
+    writeReplyHeader();
   }
 
-  /// write reply - copies data from input stream with header size
+  /// write reply - copies data from input stream with header size. Range
+  /// requests are answered with 206 (Partial Content): the start position is
+  /// reached with the seek callback or by skipping the data.
   void reply(const char* contentType, Stream& inputStream, int size,
              int status = 200, const char* msg = SUCCESS) {
-    DlnaLogger.log(DlnaInfo, "reply %s", "stream");
-    reply_header.setValues(status, msg);
-    reply_header.put(CONTENT_LENGTH, size);
-    reply_header.put(CONTENT_TYPE, contentType);
-    reply_header.put(CONNECTION, CON_KEEP_ALIVE);
-    reply_header.write(this->client());
-
-    while (inputStream.available()) {
-      int len = inputStream.readBytes(buffer.data(), buffer.size());
-      int written = client_ptr->write((const uint8_t*)buffer.data(), len);
+    DLNA_LOG(DlnaInfo, "reply %s", "stream");
+    if (isCompressedReply()) {
+      replyChunked(contentType, inputStream, status, msg, size);
+      return;
     }
-    // inputStream.close();
-    endClient();
+    int start = 0;
+    int end = size - 1;
+    int range = 0;
+    if (status == 200 && size > 0) {
+      reply_header.put(ACCEPT_RANGES, BYTES);
+      range = request_header.range(size, start, end);
+    }
+    if (range < 0 || (range > 0 && !seek(inputStream, start))) {
+      replyRangeNotSatisfiable(size);
+      return;
+    }
+    if (range > 0) {
+      char content_range[40];
+      snprintf(content_range, sizeof(content_range), "bytes %d-%d/%d", start,
+               end, size);
+      reply_header.put(CONTENT_RANGE, content_range);
+      status = 206;
+      msg = PARTIAL_CONTENT;
+    }
+    replyStream(contentType, inputStream, end - start + 1, status, msg);
   }
 
+  /// Defines the callback which positions the input stream of a Range
+  /// request: return false if this is not possible. Without callback we skip
+  /// the data.
+  void setSeekCallback(bool (*cb)(Stream& in, size_t pos)) { seek_cb = cb; }
+
   /// write reply - using callback that writes to stream
   void reply(const char* contentType, void (*callback)(Stream& out),
              int status = 200, const char* msg = SUCCESS) {
-    DlnaLogger.log(DlnaInfo, "reply %s", "callback");
+    DLNA_LOG(DlnaInfo, "reply %s", "callback");
     reply_header.setValues(status, msg);
     reply_header.put(CONTENT_TYPE, contentType);
-    reply_header.put(CONNECTION, CON_KEEP_ALIVE);
-    reply_header.write(this->client());
+    writeReplyHeader();
     callback(*client_ptr);
     // inputStream.close();
     endClient();
@@ -323,70 +422,314 @@ class HttpServer {
   /// write reply - using callback that writes to stream
   void reply(const char* contentType, void (*callback)(Print& out),
              int status = 200, const char* msg = SUCCESS) {
-    DlnaLogger.log(DlnaInfo, "reply %s", "callback");
-    reply_header.setValues(status, msg);
-    reply_header.put(CONTENT_TYPE, contentType);
-    reply_header.put(CONNECTION, CON_KEEP_ALIVE);
-    reply_header.write(this->client());
-    callback(*client_ptr);
-    // inputStream.close();
+    DLNA_LOG(DlnaInfo, "reply %s", "callback");
+    callback(replyPrint(contentType, status, msg));
     endClient();
   }
 
+  /// Starts a reply which is written to the returned Print: for HTTP/1.1 it is
+  /// sent chunked (and compressed, see setCompression()), so that the
+  /// connection can be kept open. Call endClient() at the end.
+  Print& replyPrint(const char* contentType, int status = 200,
+                    const char* msg = SUCCESS) {
+    if (isChunkedAccepted()) {
+      beginChunkedReply(contentType, status, msg, isCompressedReply());
+    } else {
+      reply_header.setValues(status, msg);
+      reply_header.put(CONTENT_TYPE, contentType);
+      writeReplyHeader();
+    }
+    return replyOut();
+  }
+
   /// write reply - string with header size
   void reply(const char* contentType, const char* str, int status = 200,
              const char* msg = SUCCESS) {
-    DlnaLogger.log(DlnaInfo, "reply %s", "str");
-    int len = strlen(str);
+    reply(contentType, (const uint8_t*)str, strlen(str), status, msg);
+  }
+
+  void reply(const char* contentType, const uint8_t* str, int len,
+             int status = 200, const char* msg = SUCCESS) {
+    DLNA_LOG(DlnaInfo, "reply %s", "str");
+    if (isCompressedReply()) {
+      beginChunkedReply(contentType, status, msg, true);
+      replyOut().write(str, len);
+      endClient();
+      return;
+    }
     reply_header.setValues(status, msg);
     reply_header.put(CONTENT_LENGTH, len);
     reply_header.put(CONTENT_TYPE, contentType);
-    reply_header.put(CONNECTION, CON_KEEP_ALIVE);
-    reply_header.write(this->client());
+    writeReplyHeader();
     client_ptr->write((const uint8_t*)str, len);
     endClient();
   }
 
-  void reply(const char* contentType, const uint8_t* str, int len,
-             int status = 200, const char* msg = SUCCESS) {
-    DlnaLogger.log(DlnaInfo, "reply %s", "str");
+  /// write reply - gzip compressed data: if the client does not accept gzip
+  /// we send the decompressed data with the indicated uncompressed length
+  void replyGzip(const char* contentType, const uint8_t* data, int len,
+                 int uncompressedLen, int status = 200,
+                 const char* msg = SUCCESS) {
+    bool is_gzip = isGzipAccepted();
+    // the content depends on the Accept-Encoding
+    reply_header.put(VARY, ACCEPT_ENCODING);
+    if (status == 200 &&
+        replyNotModified(staticETag(data, len), is_gzip ? GZIP : nullptr)) {
+      return;
+    }
+    DLNA_LOG(DlnaInfo, "reply %s", is_gzip ? "gzip" : "inflated");
     reply_header.setValues(status, msg);
-    reply_header.put(CONTENT_LENGTH, len);
+    reply_header.put(CONTENT_LENGTH, is_gzip ? len : uncompressedLen);
     reply_header.put(CONTENT_TYPE, contentType);
-    reply_header.put(CONNECTION, CON_KEEP_ALIVE);
+    if (is_gzip) reply_header.put(CONTENT_ENCODING, GZIP);
+    writeReplyHeader();
+    if (is_gzip) {
+      client_ptr->write(data, len);
+    } else {
+      Inflater inflater(DLNA_INFLATE_WINDOW_SIZE, requestAllocator());
+      inflater.inflateGzip(data, len, clientOut());
+    }
+    endClient();
+  }
+
+  /// Returns true if the Accept-Encoding of the request contains gzip
+  bool isGzipAccepted() {
+    const char* encoding = request_header.get(ACCEPT_ENCODING);
+    return encoding != nullptr && StrView(encoding).contains(GZIP);
+  }
+
+  /// Activates the (streaming) gzip compression of the replies for the
+  /// clients which accept it: the compressed replies are sent chunked.
+  void setCompression(bool active) {
+    is_compression = active;
+    if (!active) gzip_out.release();
+  }
+
+  /// Returns true if the actual reply will be compressed
+  bool isCompressedReply() {
+    // chunked transfer needs HTTP/1.1
+    return is_compression && isGzipAccepted() && isChunkedAccepted();
+  }
+
+  /// Returns true if the client supports the chunked transfer encoding
+  bool isChunkedAccepted() {
+    return !StrView(request_header.protocol()).equals("HTTP/1.0");
+  }
+
+  /// Activates persistent connections (default true): the client can send
+  /// multiple (pipelined) requests over the same connection
+  void setKeepAlive(bool active) { is_keep_alive = active; }
+
+  /// Defines the time in ms after which an idle connection is closed
+  void setKeepAliveTimeout(uint32_t timeoutMs) {
+    keep_alive_timeout = timeoutMs;
+  }
+
+  /// Defines the max number of parallel connections (<=
+  /// DLNA_HTTP_MAX_CONNECTIONS): with 1 a new client replaces the open
+  /// connection
+  void setMaxConnections(int count) {
+    if (count < 1) count = 1;
+    if (count > DLNA_HTTP_MAX_CONNECTIONS) count = DLNA_HTTP_MAX_CONNECTIONS;
+    for (int j = count; j < max_connections; j++) connections[j].close();
+    max_connections = count;
+  }
+
+  /// Number of open connections
+  int openConnections() {
+    int result = 0;
+    for (int j = 0; j < max_connections; j++) {
+      if (connections[j].isOpen()) result++;
+    }
+    return result;
+  }
+
+  /// Defines the max number of requests per connection
+  void setMaxRequestsPerConnection(int count) { max_requests = count; }
+
+  /// Returns true if the client wants to keep the connection open
+  bool isKeepAliveRequested() {
+    StrView con(request_header.get(CONNECTION));
+    if (!con.isEmpty()) {
+      if (con.equalsIgnoreCase(CON_CLOSE)) return false;
+      if (con.equalsIgnoreCase(CON_KEEP_ALIVE)) return true;
+    }
+    // HTTP/1.1 is persistent by default
+    return isChunkedAccepted();
+  }
+
+  /// Writes the reply header: the connection is only kept open if the end of
+  /// the reply can be determined by the client (Content-Length or chunked)
+  void writeReplyHeader() {
+    // a 304 reply never has a body
+    bool is_delimited = reply_header.get(CONTENT_LENGTH) != nullptr ||
+                        reply_header.get(TRANSFER_ENCODING) != nullptr ||
+                        reply_header.statusCode() == 304;
+    is_keep_alive_reply = is_keep_alive && is_delimited &&
+                          isKeepAliveRequested() &&
+                          p_connection != nullptr &&
+                          p_connection->requestCount() < max_requests;
+    reply_header.put(CONNECTION,
+                     is_keep_alive_reply ? CON_KEEP_ALIVE : CON_CLOSE);
     reply_header.write(this->client());
-    client_ptr->write((const uint8_t*)str, len);
+  }
+
+  /// Defines the max-age in seconds of the Cache-Control header for static
+  /// content: 0 requests a revalidation with the ETag and -1 omits the header
+  void setCacheMaxAge(int sec) { cache_max_age = sec; }
+
+  /// Calculates the ETag of static content (FNV-1a hash)
+  static uint32_t etag(const uint8_t* data, int len) {
+    uint32_t result = 2166136261u;
+    for (int j = 0; j < len; j++) {
+      result = (result ^ data[j]) * 16777619u;
+    }
+    return result;
+  }
+
+  /// Provides the ETag of static content which is only calculated for the
+  /// first request of the data
+  uint32_t staticETag(const uint8_t* data, int len) {
+    for (auto& entry : static_etags) {
+      if (entry.data == data && entry.len == len) return entry.etag;
+    }
+    StaticETag entry;
+    entry.data = data;
+    entry.len = len;
+    entry.etag = etag(data, len);
+    static_etags.push_back(entry);
+    return entry.etag;
+  }
+
+  /// Conditional request: adds the ETag and Cache-Control to the reply header
+  /// and replies with 304 (Not Modified) if the If-None-Match of the request
+  /// matches. Returns true if the reply has been sent. The variant
+  /// distinguishes different representations (e.g. gzip) of the same content.
+  bool replyNotModified(uint32_t etag, const char* variant = nullptr) {
+    char etag_str[24];
+    if (variant == nullptr) {
+      snprintf(etag_str, sizeof(etag_str), "\"%08lx\"", (unsigned long)etag);
+    } else {
+      snprintf(etag_str, sizeof(etag_str), "\"%08lx-%s\"",
+               (unsigned long)etag, variant);
+    }
+    reply_header.put(ETAG, etag_str);
+    if (cache_max_age > 0) {
+      char cache_control[24];
+      snprintf(cache_control, sizeof(cache_control), "max-age=%d",
+               cache_max_age);
+      reply_header.put(CACHE_CONTROL, cache_control);
+    } else if (cache_max_age == 0) {
+      reply_header.put(CACHE_CONTROL, "no-cache");
+    }
+
+    StrView if_none_match(request_header.get(IF_NONE_MATCH));
+    if (if_none_match.isEmpty()) return false;
+    if (!if_none_match.equals("*") && !if_none_match.contains(etag_str)) {
+      return false;
+    }
+    DLNA_LOG(DlnaInfo, "reply %s", "304");
+    reply_header.setValues(304, NOT_MODIFIED);
+    writeReplyHeader();
     endClient();
+    return true;
+  }
+
+  /// Conditional request for static content: with setCompression() the reply
+  /// depends on the Accept-Encoding, so the gzip variant has its own ETag
+  bool replyStaticNotModified(uint32_t etag) {
+    if (!is_compression) return replyNotModified(etag);
+    reply_header.put(VARY, ACCEPT_ENCODING);
+    return replyNotModified(etag, isCompressedReply() ? GZIP : nullptr);
   }
 
   /// write OK reply with 200 SUCCESS
   void replyOK() { reply(200, SUCCESS); }
 
+  /// write 416 reply for a range which is outside of the content
+  void replyRangeNotSatisfiable(int size) {
+    char content_range[30];
+    snprintf(content_range, sizeof(content_range), "bytes */%d", size);
+    reply_header.put(CONTENT_RANGE, content_range);
+    reply(416, "Range Not Satisfiable");
+  }
+
   /// write 404 reply
   void replyNotFound() {
-    DlnaLogger.log(DlnaInfo, "reply %s", "404");
+    DLNA_LOG(DlnaInfo, "reply %s", "404");
     reply(404, "Page Not Found");
   }
 
   /// Writes the status and message to the reply
   void reply(int status, const char* msg) {
-    DlnaLogger.log(DlnaInfo, "reply %d", status);
+    DLNA_LOG(DlnaInfo, "reply %d", status);
     reply_header.setValues(status, msg);
-    reply_header.write(this->client());
+    reply_header.put(CONTENT_LENGTH, 0);
+    writeReplyHeader();
     endClient();
   }
 
+  /// Provides a buffered output to the current client which writes in chunks
+  /// of DLNA_PRINT_BUFFER_SIZE: the data is flushed by endClient()
+  Print& clientOut() {
+    if (!chunked_out.isActive()) client_out.setOutput(*client_ptr);
+    return client_out;
+  }
+
+  /// Provides the output for the reply data: this is compressed and/or
+  /// chunked if the reply header was written for a chunked reply
+  Print& replyOut() {
+    if (gzip_out.isActive()) return gzip_out;
+    return clientOut();
+  }
+
+  /// Provides the engine which copies the reply streams: e.g. to define the
+  /// block size and double buffering or to query the throughput
+  StreamCopy& streamCopy() { return stream_copy; }
+
   /// provides the request header
   HttpRequestHeader& requestHeader() { return request_header; }
 
+  /// Reads the data of the actual request (as defined by the Content-Length)
+  /// into the output: returns the number of bytes
+  size_t readRequestData(Print& out) {
+    const char* len_str = request_header.get(CONTENT_LENGTH);
+    long open = len_str != nullptr ? atol(len_str) : 0;
+    size_t result = 0;
+    uint8_t buffer[128];
+    while (open > 0) {
+      int len = open < (long)sizeof(buffer) ? open : sizeof(buffer);
+      // the connection might have received some data with the header
+      int n = p_connection != nullptr ? p_connection->readBytes(buffer, len)
+                                      : client_ptr->readBytes(buffer, len);
+      if (n <= 0) break;
+      out.write(buffer, n);
+      open -= n;
+      result += n;
+    }
+    return result;
+  }
+
+  /// Allocator for temporary objects (e.g. with Str::setAllocator() or the
+  /// HttpParameters of a request handler) of the actual request: the memory
+  /// is released when the request has been processed, so the objects must
+  /// not be used after that. The request header does not need it because it
+  /// stores its values in a fixed arena.
+  Allocator& requestAllocator() { return request_arena; }
+
   /// provides the reply header
   HttpReplyHeader& replyHeader() { return reply_header; }
 
-  /// closes the connection to the current client_ptr
+  /// ends the reply: the connection to the current client_ptr is closed
+  /// unless it is kept alive for the next request
   void endClient() {
-    DlnaLogger.log(DlnaInfo, "HttpServer %s", "endClient");
+    DLNA_LOG(DlnaInfo, "HttpServer %s", "endClient");
+    // gzip trailer -> buffer -> chunks
+    gzip_out.end();
+    client_out.end();
+    chunked_out.end();
     client_ptr->flush();
-    client_ptr->stop();
+    if (!is_keep_alive_reply) closeClient();
   }
 
   /// print a CR LF
@@ -398,6 +741,7 @@ class HttpServer {
   /// adds a new handler
   void addHandler(HttpRequestHandlerLine* handlerLinePtr) {
     handler_collection.push_back(handlerLinePtr);
+    is_router_valid = false;
   }
 
   /// Legacy method: same as copy();
@@ -410,24 +754,34 @@ class HttpServer {
     if (is_active) {
       WiFiClient client = server_ptr->accept();
       if (client) {
-        DlnaLogger.log(DlnaInfo, "doLoop->hasClient");
-        client_ptr = &client;
+        DLNA_LOG(DlnaInfo, "doLoop->hasClient");
+        openConnection().begin(client);
+        result = true;
+      }
 
-        // process the new client with standard functionality
-        if (client.available() > 5) {
-          processRequest();
+      // advance all open connections: one request per connection and call
+      for (int j = 0; j < max_connections; j++) {
+        HttpConnection& con = connections[j];
+        if (!con.isOpen()) continue;
+        if (con.readHeader()) {
+          processRequest(con);
+          result = true;
+        }
+        // close idle connections
+        if (con.isOpen() && con.isIdle(keep_alive_timeout)) {
+          DLNA_LOG(DlnaInfo, "HttpServer %s", "closing idle client");
+          con.close();
         }
+      }
 
-        // process doLoop of all registed (and opened) extension_collection
-        // processExtensions();
-        result = true;
-      } else {
+      // process doLoop of all registed (and opened) extension_collection
+      // processExtensions();
+      if (!result && no_connect_delay > 0) {
         // give other tasks a chance
         delay(no_connect_delay);
-        // DlnaLogger.log(DlnaDebug, "HttpServer no client available");
       }
     } else {
-      DlnaLogger.log(DlnaWarning, "HttpServer inactive");
+      DLNA_LOG(DlnaWarning, "HttpServer inactive");
     }
     return result;
   }
@@ -438,6 +792,24 @@ class HttpServer {
   /// Provides true if the server has been started
   operator bool() { return is_active; }
 
+  /// (Re)builds the route index: this is done automatically in begin() and
+  /// after adding new handlers or rewrite rules
+  void updateRouter() {
+    if (is_router_valid) return;
+    handler_router.clear();
+    for (auto handler_line_ptr : handler_collection) {
+      handler_router.add(handler_line_ptr->path.c_str(),
+                         handler_line_ptr->method, handler_line_ptr);
+    }
+    handler_router.build();
+    rewrite_router.clear();
+    for (auto rewrite : rewrite_collection) {
+      rewrite_router.add(rewrite->from.c_str(), 0, rewrite);
+    }
+    rewrite_router.build();
+    is_router_valid = true;
+  }
+
   /// Determines the local ip address
   const char* localHost() {
     if (local_host == nullptr) {
@@ -446,49 +818,175 @@ class HttpServer {
     return local_host;
   }
 
+  /// Provides the host of the actual request from the Host header (w/o the
+  /// port): on a multi homed device this is the address of the interface
+  /// which received the request
+  const char* requestHost() {
+    const char* host = request_header.get(HOST_C);
+    if (host == nullptr) return localHost();
+    int len = 0;
+    while (host[len] != 0 && host[len] != ':' &&
+           len < (int)sizeof(request_host) - 1) {
+      len++;
+    }
+    memcpy(request_host, host, len);
+    request_host[len] = 0;
+    return request_host;
+  }
+
   void setNoConnectDelay(int delay) { no_connect_delay = delay; }
 
  protected:
   // data
   HttpRequestHeader request_header;
   HttpReplyHeader reply_header;
-  List<HttpRequestHandlerLine*> handler_collection;
+  char request_host[40] = {0};
+  IntrusiveList<HttpRequestHandlerLine> handler_collection;
   // List<Extension*> extension_collection;
-  List<HttpRequestRewrite*> rewrite_collection;
+  IntrusiveList<HttpRequestRewrite> rewrite_collection;
+  HttpRouter handler_router;
+  HttpRouter rewrite_router;
+  bool is_router_valid = false;
   Client* client_ptr;
+  HttpConnection connections[DLNA_HTTP_MAX_CONNECTIONS];
+  HttpConnection* p_connection = nullptr;
+  int max_connections = DLNA_HTTP_MAX_CONNECTIONS;
+  bool is_keep_alive = true;
+  bool is_keep_alive_reply = false;
+  uint32_t keep_alive_timeout = DLNA_HTTP_KEEP_ALIVE_TIMEOUT;
+  int max_requests = DLNA_HTTP_MAX_REQUESTS;
+  int cache_max_age = DLNA_HTTP_CACHE_MAX_AGE;
+  /// ETag of static content
+  struct StaticETag {
+    const uint8_t* data = nullptr;
+    int len = 0;
+    uint32_t etag = 0;
+  };
+  Vector<StaticETag> static_etags;
   WiFiServer* server_ptr;
   bool is_active;
-  Vector<char> buffer{0};
+  StreamCopy stream_copy;
+  ArenaAllocator request_arena{DLNA_HTTP_ARENA_SIZE};
+  bool (*seek_cb)(Stream& in, size_t pos) = nullptr;
+  BufferedPrint client_out;
+  HttpChunkedPrint chunked_out;
+  GzipPrint gzip_out;
+  bool is_compression = false;
   const char* local_host = nullptr;
   int no_connect_delay = 5;
 
+  /// Writes the header of a chunked reply and sets up the output:
+  /// (gzip ->) client_out -> chunked_out -> client
+  void beginChunkedReply(const char* contentType, int status,
+                         const char* msg, bool isGzip) {
+    reply_header.setValues(status, msg);
+    reply_header.put(TRANSFER_ENCODING, CHUNKED);
+    if (isGzip) reply_header.put(CONTENT_ENCODING, GZIP);
+    reply_header.put(CONTENT_TYPE, contentType);
+    writeReplyHeader();
+    chunked_out.setClient(*client_ptr);
+    client_out.setOutput(chunked_out);
+    if (isGzip) gzip_out.begin(client_out);
+  }
+
+  /// Provides a free connection: if all are in use we replace the one with
+  /// the oldest activity
+  HttpConnection& openConnection() {
+    HttpConnection* result = &connections[0];
+    for (int j = 0; j < max_connections; j++) {
+      HttpConnection& con = connections[j];
+      if (!con.isOpen()) return con;
+      if (con.lastActivity() < result->lastActivity()) result = &con;
+    }
+    DLNA_LOG(DlnaWarning, "HttpServer: closing oldest connection");
+    result->close();
+    return *result;
+  }
+
+  /// Closes the connection to the client
+  void closeClient() {
+    if (p_connection != nullptr) {
+      p_connection->close();
+    } else {
+      client_ptr->stop();
+    }
+    is_keep_alive_reply = false;
+  }
+
+  /// copies the input stream with the indicated size to the client
+  void replyStream(const char* contentType, Stream& inputStream, int size,
+                   int status, const char* msg) {
+    reply_header.setValues(status, msg);
+    reply_header.put(CONTENT_LENGTH, size);
+    reply_header.put(CONTENT_TYPE, contentType);
+    writeReplyHeader();
+
+    size_t written = stream_copy.copy(inputStream, *client_ptr, size);
+    DlnaMetrics.add(CNT_BYTES_STREAMED, written);
+    if (written < (size_t)size) {
+      // the client would wait for the missing data
+      DLNA_LOG(DlnaError, "reply: only %d of %d bytes written",
+               (int)written, size);
+      is_keep_alive_reply = false;
+    }
+    endClient();
+  }
+
+  /// moves the input stream to the indicated position
+  bool seek(Stream& in, int pos) {
+    if (seek_cb != nullptr) return seek_cb(in, pos);
+    // skip the data
+    uint8_t tmp[128];
+    while (pos > 0) {
+      int n = pos < (int)sizeof(tmp) ? pos : sizeof(tmp);
+      n = in.readBytes(tmp, n);
+      if (n <= 0) return false;
+      pos -= n;
+    }
+    return true;
+  }
+
   /// Converts null to an empty string
   const char* nullstr(const char* in) { return in == nullptr ? "" : in; }
 
   // process a full request and send the reply
-  void processRequest() {
-    DlnaLogger.log(DlnaInfo, "processRequest");
-    request_header.read(this->client());
+  void processRequest(HttpConnection& con) {
+    DLNA_LOG(DlnaInfo, "processRequest");
+    p_connection = &con;
+    client_ptr = &con.getClient();
+    request_header.parse(con.headerData());
+    con.nextRequest();
+    is_keep_alive_reply = false;
+    // e.g. unread body of the last request
+    if (request_header.method() == T_UNDEFINED) {
+      DLNA_LOG(DlnaWarning, "Invalid request: closing connection");
+      closeClient();
+      return;
+    }
     // provide reply with empty header
     reply_header.clear();
     // determine the path
     const char* path = request_header.urlPath();
     path = resolveRewrite(path);
+    DlnaMetrics.add(CNT_HTTP_REQUESTS);
+    uint32_t start = millis();
     bool processed = onRequest(path);
     if (!processed) {
-        replyNotFound();
+      DlnaMetrics.add(CNT_HTTP_NOT_FOUND);
+      replyNotFound();
     }
+    DlnaMetrics.record(HIST_HTTP_REQUEST_MS, millis() - start);
+    // release the temporary objects of the request
+    request_arena.clear();
   }
 
   /// determiens the potentially rewritten url which should be used for the
   /// further processing
   const char* resolveRewrite(const char* from) {
-    for (auto i = rewrite_collection.begin(); i != rewrite_collection.end();
-         ++i) {
-      HttpRequestRewrite* rewrite = (*i);
-      if (rewrite->from.matches(from)) {
-        return rewrite->to.c_str();
-      }
+    updateRouter();
+    Vector<void*>& candidates = rewrite_router.find(0, from);
+    if (candidates.size() > 0) {
+      return ((HttpRequestRewrite*)candidates[0])->to.c_str();
     }
     return from;
   }
@@ -4,7 +4,25 @@
 #include "HttpStreamedOutput.h"
 #include "WiFi.h"
 #include "basic/List.h"
+#include "basic/Metrics.h"
+#include "basic/RingBuffer.h"
 #include "basic/Str.h"
+#include "basic/Vector.h"
+
+// number of clients for which we keep the list nodes
+#ifndef DLNA_MULTI_OUTPUT_CLIENTS
+#define DLNA_MULTI_OUTPUT_CLIENTS 4
+#endif
+
+// size of the send buffer which is shared by all clients
+#ifndef DLNA_MULTI_OUTPUT_BUFFER_SIZE
+#define DLNA_MULTI_OUTPUT_BUFFER_SIZE 8192
+#endif
+
+// max time in ms that close() waits for the clients to receive the pending data
+#ifndef DLNA_MULTI_OUTPUT_CLOSE_TIMEOUT
+#define DLNA_MULTI_OUTPUT_CLOSE_TIMEOUT 1000
+#endif
 
 namespace tiny_dlna {
 
@@ -15,13 +33,22 @@ namespace tiny_dlna {
  * the client.
  *
  * The output (write, print ...) functions are sending the same output to all
- * open clients.
+ * open clients: the data is chunk encoded only once into a send buffer which
+ * is shared by all clients, and each client has its own read position in it.
+ * The clients are served w/o blocking in write() and doLoop(): a client which
+ * falls behind by more than the buffer size is dropped, so that a slow
+ * listener does not throttle the others.
+ *
+ * If a maxHistoryLength is defined, the last bytes of the output are kept in a
+ * circular buffer and sent to new clients, so that late joiners can start
+ * immediately.
  *
  * The id is used to identify the output stream so that we can potentially send
  * different content to different clients.
  *
  * We automatically manage all the clients which are open and clean up the
- * closed clients to release the memory.
+ * closed clients to release the memory. The list nodes of the clients are
+ * pooled, so connecting and disconnecting clients does not allocate memory.
  */
 
 class HttpStreamedMultiOutput : public HttpStreamedOutput {
@@ -29,19 +56,24 @@ class HttpStreamedMultiOutput : public HttpStreamedOutput {
   HttpStreamedMultiOutput(const char *mime, const char *startHtml = nullptr,
                           const char *endHtml = nullptr,
                           int maxHistoryLength = 0) {
-    DlnaLogger.log(DlnaInfo, "HttpStreamedMultiOutput");
+    DLNA_LOG(DlnaInfo, "HttpStreamedMultiOutput");
     this->start = startHtml;
     this->end = endHtml;
     this->mime_type = mime;
     this->max_history_length = maxHistoryLength;
+    clients.setPoolSize(DLNA_MULTI_OUTPUT_CLIENTS);
     if (maxHistoryLength > 0) {
-      this->history = new Str(maxHistoryLength);
+      history.resize(maxHistoryLength);
     }
   }
 
   // provides the mime type
   virtual const char *mime() { return mime_type; }
 
+  /// Defines the size of the shared send buffer: call this before opening
+  /// the first client
+  void setBufferSize(int size) { buffer_size = size; }
+
   // checks if the client is valid
   virtual bool isValid(WiFiClient &client) {
     bool valid = client.connected();
@@ -50,7 +82,7 @@ class HttpStreamedMultiOutput : public HttpStreamedOutput {
 
   // content that is written when the request is opened
   virtual void open(WiFiClient &client) {
-    DlnaLogger.log(DlnaInfo, "HttpStreamedMultiOutput::open");
+    DLNA_LOG(DlnaInfo, "HttpStreamedMultiOutput::open");
     if (client.connected()) {
       // create a copy
       // we handle only valid clents
@@ -58,69 +90,80 @@ class HttpStreamedMultiOutput : public HttpStreamedOutput {
         int len = strlen(start);
         writer.writeChunk(client, start, len);
       }
-      if (history != nullptr && history->length() > 0) {
-        writer.writeChunk(client, history->c_str(), history->length());
+      if (history.available() > 0) {
+        // the history is in max 2 contiguous blocks
+        int len = 0;
+        int len1 = 0;
+        char *data = history.peekPtr(0, len);
+        char *data1 = history.peekPtr(len, len1);
+        writer.writeChunk(client, data, len, data1, len1);
       }
 
-      // add client to list of open clients
-      DlnaLogger.log(DlnaWarning, "new client");
-      clients.push_back(client);
+      // add client to list of open clients: it starts at the actual
+      // position of the send buffer
+      DLNA_LOG(DlnaWarning, "new client");
+      if (buffer.size() == 0) buffer.resize(buffer_size);
+      StreamClient stream_client;
+      stream_client.client = client;
+      stream_client.pos = write_total;
+      clients.push_back(stream_client);
     }
   }
 
   // checks if we have any open clients
   virtual bool isOpen() {
     cleanup();
-    for (auto i = clients.begin(); i != clients.end(); ++i) {
-      WiFiClient client = (*i);
-      if (isValid(client)) {
-        return true;
-      }
-    }
-    return false;
+    return !clients.empty();
   }
 
   // end processing by wr
   virtual void close() {
-    for (auto i = clients.begin(); i != clients.end(); ++i) {
-      WiFiClient client = *i;
-      if (isValid(client)) {
-        if (end != nullptr) {
-          // send end to all clients
-          print(end);
-        }
-        writer.writeEnd(client);
-      }
+    if (!isOpen()) return;
+    if (end != nullptr) {
+      // send end to all clients
+      print(end);
+    }
+    addChunk("", 0);
+    // give the clients a chance to receive the pending data
+    uint32_t start_time = millis();
+    while (!flush() && millis() - start_time < DLNA_MULTI_OUTPUT_CLOSE_TIMEOUT) {
+      delay(1);
     }
     cleanup();
   }
 
-  /// Do not accept any writes if we are not connected
-  virtual int availableForWrite() { return isOpen() ? 1024 : 0; }
+  /// Provides the number of bytes which can be written w/o dropping a
+  /// client (0 if we are not connected)
+  virtual int availableForWrite() {
+    if (!isOpen()) return 0;
+    uint64_t max_pending = 0;
+    for (auto i = clients.begin(); i != clients.end(); ++i) {
+      uint64_t pending = write_total - (*i).pos;
+      if (pending > max_pending) max_pending = pending;
+    }
+    int64_t result = (int64_t)buffer.size() - (int64_t)max_pending -
+                     chunk_overhead;
+    return result > 0 ? (int)result : 0;
+  }
 
   // write the content to the HttpStreamedMultiOutput
   virtual size_t write(uint8_t *content, int len) {
-    cleanup();
-    for (auto i = clients.begin(); i != clients.end(); ++i) {
-      WiFiClient client = *i;
-      if (isValid(client)) {
-        DlnaLogger.log(DlnaDebug, "HttpStreamedMultiOutput::write");
-        writer.writeChunk(client, (const char *)content, len);
-      }
+    DLNA_LOG(DlnaDebug, "HttpStreamedMultiOutput::write");
+    if (isOpen()) {
+      addChunks((const char *)content, len);
+      flush();
     }
+    addHistory((const char *)content, false, len);
     return len;
   }
 
   // writes a line
   virtual size_t print(const char *str) {
-    cleanup();
     int len = strlen(str);
-    for (auto i = clients.begin(); i != clients.end(); ++i) {
-      WiFiClient client = *i;
-      if (isValid(client)) {
-        DlnaLogger.log(DlnaDebug, "HttpStreamedMultiOutput::print");
-        writer.writeChunk(client, (const char *)str, len);
-      }
+    if (isOpen()) {
+      DLNA_LOG(DlnaDebug, "HttpStreamedMultiOutput::print");
+      addChunks(str, len);
+      flush();
     }
     addHistory(str, false, len);
     return len;
@@ -128,26 +171,50 @@ class HttpStreamedMultiOutput : public HttpStreamedOutput {
 
   // writes a line which terminates with a html line break
   virtual size_t println(const char *str) {
-    cleanup();
     int len = strlen(str);
-    for (auto i = clients.begin(); i != clients.end(); ++i) {
-      WiFiClient client = *i;
-      if (isValid(client)) {
-        DlnaLogger.log(DlnaDebug, "HttpStreamedMultiOutput::println");
-        writer.writeChunk(client, str, len, "<br>", 4);
+    if (isOpen()) {
+      DLNA_LOG(DlnaDebug, "HttpStreamedMultiOutput::println");
+      if (len + 4 + chunk_overhead <= buffer.size()) {
+        addChunk(str, len, "<br>", 4);
+      } else {
+        addChunks(str, len);
+        addChunk("<br>", 4);
       }
+      flush();
     }
     addHistory(str, true, len);
     return len;
   }
 
-  // actually we do nothing here - but some subclasses might
-  virtual void doLoop() {}
+  /// sends the pending data to the clients
+  virtual void doLoop() { flush(); }
+
+  /// Sends the pending data w/o blocking: returns true if all clients have
+  /// received all data
+  bool flush() {
+    bool result = true;
+    for (auto i = clients.begin(); i != clients.end(); ++i) {
+      if (!send(*i)) result = false;
+    }
+    return result;
+  }
 
  protected:
+  struct StreamClient {
+    WiFiClient client;
+    // position in the total written data: 64 bits, so that the modulo of
+    // the buffer index stays valid on long running streams
+    uint64_t pos = 0;
+  };
+  // max size of the chunk header and trailer
+  static const int chunk_overhead = 12;
   HttpChunkWriter writer;
-  List<WiFiClient> clients;
-  Str *history = nullptr;
+  List<StreamClient> clients;
+  Vector<uint8_t> buffer;
+  int buffer_size = DLNA_MULTI_OUTPUT_BUFFER_SIZE;
+  // total number of bytes which were written to the buffer
+  uint64_t write_total = 0;
+  RingBuffer history{0};
   int max_history_length;
   const char *start = nullptr;
   const char *end = nullptr;
@@ -156,49 +223,95 @@ class HttpStreamedMultiOutput : public HttpStreamedOutput {
 
   // clenaup closed clients
   void cleanup() {
-    for (int pos = clients.size() - 1; pos >= 0; pos--) {
-      WiFiClient client = clients[pos];
-      if (!isValid(client)) {
-        DlnaLogger.log(DlnaWarning, "HttpStreamedMultiOutput::closed");
-        clients.erase(clients.begin() + pos);
+    auto i = clients.begin();
+    while (i != clients.end()) {
+      auto next = i + 1;
+      if (!isValid((*i).client)) {
+        DLNA_LOG(DlnaWarning, "HttpStreamedMultiOutput::closed");
+        clients.erase(i);
       }
+      i = next;
     }
   }
 
-  /// content that is written when the request is opened
-  void onClose(WiFiClient &client) {
-    if (end != nullptr) {
-      DlnaLogger.log(DlnaInfo, "HttpStreamedMultiOutput::onClose");
-      int len = strlen(end);
-      writer.writeChunk(client, end, len);
+  /// sends the pending data of the client w/o blocking: returns true if
+  /// there is no pending data any more
+  bool send(StreamClient &stream_client) {
+    int size = buffer.size();
+    while (stream_client.pos != write_total) {
+      uint64_t pending = write_total - stream_client.pos;
+      int idx = stream_client.pos % size;
+      int n = size - idx;
+      if (pending < (uint64_t)n) n = (int)pending;
+      int written = stream_client.client.write(buffer.data() + idx, n);
+      if (written <= 0) return false;
+      stream_client.pos += written;
+      DlnaMetrics.add(CNT_BYTES_STREAMED, written);
     }
+    return true;
+  }
 
-    clients.push_back(client);
-  }
-
-  /// adds the line to the history - removest oldest lines
-  void addHistory(const char *line, bool delimiter, int len) {
-    if (history != nullptr) {
-      int available = max_history_length - history->length();
-      // make space
-      while (len > available && history->length() > 0) {
-        int pos = history->indexOf("<br>");
-        if (pos >= 0) {
-          *history << (pos + 4);
-        } else {
-          history->clear();
-        }
-        available = max_history_length - history->length();
-      }
-      // add to history if it is not too big
-      if (len <= available) {
-        *history += line;
-        if (delimiter) {
-          *history += "<br>";
-        }
+  /// adds the data as chunks which fit into the buffer
+  void addChunks(const char *data, int len) {
+    int max_chunk = buffer.size() / 2;
+    while (len > 0) {
+      int n = len < max_chunk ? len : max_chunk;
+      addChunk(data, n);
+      data += n;
+      len -= n;
+    }
+  }
+
+  /// chunk encodes the data into the shared buffer
+  void addChunk(const char *data, int len, const char *data1 = nullptr,
+                int len1 = 0) {
+    char header[chunk_overhead];
+    int header_len = snprintf(header, sizeof(header), "%X\r\n", len + len1);
+    makeRoom(header_len + len + len1 + 2);
+    append(header, header_len);
+    append(data, len);
+    append(data1, len1);
+    append("\r\n", 2);
+  }
+
+  /// drops the clients which would loose some data
+  void makeRoom(int len) {
+    flush();
+    uint64_t size = buffer.size();
+    auto i = clients.begin();
+    while (i != clients.end()) {
+      auto next = i + 1;
+      StreamClient &stream_client = *i;
+      if (write_total + len - stream_client.pos > size) {
+        DLNA_LOG(DlnaWarning, "HttpStreamedMultiOutput: dropping slow client");
+        DlnaMetrics.add(CNT_STREAM_DROPPED);
+        stream_client.client.stop();
+        clients.erase(i);
       }
+      i = next;
     }
   }
+
+  /// copies the data into the (circular) buffer
+  void append(const char *data, int len) {
+    int size = buffer.size();
+    while (data != nullptr && len > 0) {
+      int idx = write_total % size;
+      int n = size - idx;
+      if (len < n) n = len;
+      memcpy(buffer.data() + idx, data, n);
+      write_total += n;
+      data += n;
+      len -= n;
+    }
+  }
+
+  /// adds the data to the history: the oldest data is overwritten
+  void addHistory(const char *data, bool delimiter, int len) {
+    if (max_history_length <= 0) return;
+    history.writeOverwrite((uint8_t *)data, len);
+    if (delimiter) history.writeOverwrite((uint8_t *)"<br>", 4);
+  }
 };
 
 }  // namespace tiny_dlna
@@ -12,16 +12,24 @@ namespace tiny_dlna {
 class HttpTunnel {
  public:
   HttpTunnel(const char* url, const char* mime = "text/html") {
-    DlnaLogger.log(DlnaInfo, "HttpTunnel: %s", url);
+    DLNA_LOG(DlnaInfo, "HttpTunnel: %s", url);
     v_url.setUrl(url);
     v_mime = mime;
   }
 
-  /// Executes the get request
-  Stream* get() {
-    DlnaLogger.log(DlnaInfo, "HttpTunnel::get");
+  /// Executes the get request: optionally for the indicated Range header
+  /// value. Check the status code of request().reply() for 206 (Partial
+  /// Content)
+  Stream* get(const char* range = nullptr) {
+    DLNA_LOG(DlnaInfo, "HttpTunnel::get");
+    // a Range from a prior call must not be sent again
+    if (StrView(range).isEmpty()) {
+      v_request.request().remove(RANGE);
+    } else {
+      v_request.request().put(RANGE, range);
+    }
     if (isOk(v_request.get(v_url, v_mime))) {
-      return v_request.client();
+      return &v_request;
     }
     return nullptr;
   }